@@ -0,0 +1,119 @@
+import lab_bit_vector;
+import lab_vector;
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Every third bit set on average, in the same pattern for every container.
+ */
+template<typename Bits>
+auto MakeBits(
+  std::int64_t size,  //
+  std::uint64_t seed
+) -> Bits {
+  std::mt19937_64 engine{seed};
+  Bits bits;
+  for (std::int64_t i{}; i < size; ++i) {
+    if constexpr (requires { bits.PushBack(true); }) {
+      bits.PushBack(engine() % 3 == 0);
+    } else {
+      bits.push_back(engine() % 3 == 0);
+    }
+  }
+  return bits;
+}
+
+template<typename Bits>
+auto CountSet(const Bits& bits) -> std::size_t {
+  if constexpr (requires { bits.Count(); }) {
+    return bits.Count();
+  } else {
+    return static_cast<std::size_t>(std::ranges::count(bits, true));
+  }
+}
+
+/**
+ * @brief `lhs &= rhs`, `std::vector<bool>` has no bulk operation so it goes bit by bit.
+ */
+template<typename Bits>
+auto Intersect(
+  Bits& lhs,  //
+  const Bits& rhs
+) -> void {
+  if constexpr (requires { lhs.And(rhs); }) {
+    lhs.And(rhs);
+  } else if constexpr (std::same_as<Bits, std::vector<bool>>) {
+    for (std::size_t i{}; i < lhs.size(); ++i) {
+      lhs[i] = lhs[i] && rhs[i];
+    }
+  } else {
+    for (std::size_t i{}; i < lhs.Size(); ++i) {
+      lhs[i] = lhs[i] && rhs[i];
+    }
+  }
+}
+
+}  // namespace
+
+template<typename Bits>
+static auto BM_PushBack(benchmark::State& state) -> void {
+  for (auto _ : state) {
+    auto bits{MakeBits<Bits>(state.range(0), 1)};
+    benchmark::DoNotOptimize(bits);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Bits>
+static auto BM_Count(benchmark::State& state) -> void {
+  const auto bits{MakeBits<Bits>(state.range(0), 1)};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CountSet(bits));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Bits>
+static auto BM_And(benchmark::State& state) -> void {
+  auto lhs{MakeBits<Bits>(state.range(0), 1)};
+  const auto rhs{MakeBits<Bits>(state.range(0), 2)};
+  for (auto _ : state) {
+    Intersect(lhs, rhs);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static auto BM_FindNext(benchmark::State& state) -> void {
+  const auto bits{MakeBits<lab::BitVector<>>(state.range(0), 1)};
+  for (auto _ : state) {
+    std::size_t sum{};
+    for (auto i{bits.FindFirst()}; i != bits.Size(); i = bits.FindNext(i)) {
+      sum += i;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(BM_PushBack, lab::BitVector<>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PushBack, std::vector<bool>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PushBack, lab::Vector<bool>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Count, lab::BitVector<>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Count, std::vector<bool>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Count, lab::Vector<bool>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_And, lab::BitVector<>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_And, std::vector<bool>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_And, lab::Vector<bool>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(BM_FindNext)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+// clang-format on
@@ -0,0 +1,284 @@
+import lab_forward_list;
+import lab_vector;
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <forward_list>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Trivially copyable element of `kSize` bytes, used to compare containers across element sizes.
+ */
+template<std::size_t kSize>
+struct Payload {
+  explicit Payload(std::int64_t value) noexcept { bytes.fill(static_cast<std::byte>(value)); }
+
+  [[nodiscard]] auto Key() const noexcept -> std::int64_t { return static_cast<std::int64_t>(bytes.front()); }
+
+  std::array<std::byte, kSize> bytes;
+};
+
+using Small = Payload<4>;
+using Medium = Payload<64>;
+using Large = Payload<256>;
+
+/**
+ * @brief Upper bound of the memory a single benchmarked container may hold.
+ */
+inline constexpr std::int64_t kMemoryBudget{std::int64_t{1} << 30};
+
+inline constexpr std::int64_t kMinCount{16};
+inline constexpr std::int64_t kMaxCount{100'000'000};
+
+/**
+ * @brief Registers N = 16, 256, ... up to 100M, capped so that `kElementBytes * N` fits in `kMemoryBudget`.
+ */
+template<std::size_t kElementBytes>
+auto ApplyCounts(benchmark::internal::Benchmark* benchmark) -> void {
+  const std::int64_t max_count{std::min(kMaxCount, kMemoryBudget / static_cast<std::int64_t>(kElementBytes))};
+  benchmark->RangeMultiplier(16)->Range(kMinCount, max_count)->Unit(benchmark::kMicrosecond);
+}
+
+/**
+ * @brief Approximate footprint of a singly linked node: payload, link and allocator bookkeeping.
+ */
+template<typename Element>
+inline constexpr std::size_t kNodeBytes{sizeof(Element) + 2 * sizeof(void*)};
+
+template<typename Container>
+auto Build(std::int64_t count) -> Container {
+  using Element = Container::value_type;
+  Container container;
+  if constexpr (requires { container.PushFront(Element{0}); }) {
+    for (std::int64_t i{}; i < count; ++i) {
+      container.PushFront(Element{i});
+    }
+  } else if constexpr (requires { container.push_front(Element{0}); }) {
+    for (std::int64_t i{}; i < count; ++i) {
+      container.push_front(Element{i});
+    }
+  } else if constexpr (requires { container.EmplaceBack(0); }) {
+    for (std::int64_t i{}; i < count; ++i) {
+      container.EmplaceBack(i);
+    }
+  } else {
+    for (std::int64_t i{}; i < count; ++i) {
+      container.emplace_back(i);
+    }
+  }
+  return container;
+}
+
+}  // namespace
+
+template<typename Container>
+static auto BM_PushBack(benchmark::State& state) -> void {
+  using Element = Container::value_type;
+  const auto count{static_cast<std::int64_t>(state.range(0))};
+  for (auto _ : state) {
+    Container container;
+    for (std::int64_t i{}; i < count; ++i) {
+      const Element element{i};
+      if constexpr (requires { container.PushBack(element); }) {
+        container.PushBack(element);
+      } else {
+        container.push_back(element);
+      }
+    }
+    benchmark::DoNotOptimize(container);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template<typename Container>
+static auto BM_EmplaceBack(benchmark::State& state) -> void {
+  const auto count{static_cast<std::int64_t>(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Build<Container>(count));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template<typename Container>
+static auto BM_Iteration(benchmark::State& state) -> void {
+  const auto count{static_cast<std::int64_t>(state.range(0))};
+  const auto container{Build<Container>(count)};
+  for (auto _ : state) {
+    std::int64_t sum{};
+    for (const auto& element : container) {
+      sum += element.Key();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template<typename Container>
+static auto BM_RandomAccess(benchmark::State& state) -> void {
+  const auto count{static_cast<std::int64_t>(state.range(0))};
+  const auto container{Build<Container>(count)};
+  std::vector<std::size_t> indices(static_cast<std::size_t>(std::min(count, std::int64_t{1} << 16)));
+  std::uniform_int_distribution<std::size_t> distribution{0, static_cast<std::size_t>(count - 1)};
+  std::ranges::generate(indices, [&, engine = std::mt19937_64{42}] mutable { return distribution(engine); });
+  for (auto _ : state) {
+    std::int64_t sum{};
+    for (const auto index : indices) {
+      sum += container[index].Key();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(indices.size()));
+}
+
+template<typename Container>
+static auto BM_CopyConstruction(benchmark::State& state) -> void {
+  const auto count{static_cast<std::int64_t>(state.range(0))};
+  const auto source{Build<Container>(count)};
+  for (auto _ : state) {
+    Container copy{source};
+    benchmark::DoNotOptimize(copy);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template<typename Container>
+static auto BM_MoveConstruction(benchmark::State& state) -> void {
+  const auto count{static_cast<std::int64_t>(state.range(0))};
+  auto source{Build<Container>(count)};
+  for (auto _ : state) {
+    Container moved{std::move(source)};
+    benchmark::DoNotOptimize(moved);
+    source = std::move(moved);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Container>
+static auto BM_Teardown(benchmark::State& state) -> void {
+  const auto count{static_cast<std::int64_t>(state.range(0))};
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto container{Build<Container>(count)};
+    benchmark::DoNotOptimize(container);
+    state.ResumeTiming();
+    {
+      [[maybe_unused]] const auto destroyed{std::move(container)};
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template<typename Container>
+static auto BM_PushFront(benchmark::State& state) -> void {
+  const auto count{static_cast<std::int64_t>(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Build<Container>(count));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+/**
+ * @brief Inserts a node after every element, doubling the list while walking it once.
+ */
+template<typename Container>
+static auto BM_InsertAfter(benchmark::State& state) -> void {
+  using Element = Container::value_type;
+  const auto count{static_cast<std::int64_t>(state.range(0))};
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto container{Build<Container>(count)};
+    state.ResumeTiming();
+    for (auto position{container.begin()}; position != container.end(); ++position) {
+      if constexpr (requires { container.InsertAfter(position, Element{0}); }) {
+        position = container.InsertAfter(position, Element{0});
+      } else {
+        position = container.insert_after(position, Element{0});
+      }
+    }
+    benchmark::DoNotOptimize(container);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+/**
+ * @brief Erases every second node in a single pass, the erase loop pattern of singly linked lists.
+ */
+template<typename Container>
+static auto BM_Erase(benchmark::State& state) -> void {
+  const auto count{static_cast<std::int64_t>(state.range(0))};
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto container{Build<Container>(count)};
+    state.ResumeTiming();
+    for (auto position{container.begin()}; position != container.end() && std::next(position) != container.end();
+         ++position) {
+      if constexpr (requires { container.EraseAfter(position); }) {
+        container.EraseAfter(position);
+      } else {
+        container.erase_after(position);
+      }
+    }
+    benchmark::DoNotOptimize(container);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * count / 2);
+}
+
+// clang-format off
+#define LAB_CONTIGUOUS_BENCHMARKS(Element)                                                                        \
+  BENCHMARK_TEMPLATE(BM_PushBack, lab::Vector<Element>)->Apply(ApplyCounts<sizeof(Element)>);                    \
+  BENCHMARK_TEMPLATE(BM_PushBack, std::vector<Element>)->Apply(ApplyCounts<sizeof(Element)>);                    \
+  BENCHMARK_TEMPLATE(BM_EmplaceBack, lab::Vector<Element>)->Apply(ApplyCounts<sizeof(Element)>);                 \
+  BENCHMARK_TEMPLATE(BM_EmplaceBack, std::vector<Element>)->Apply(ApplyCounts<sizeof(Element)>);                 \
+  BENCHMARK_TEMPLATE(BM_Iteration, lab::Vector<Element>)->Apply(ApplyCounts<sizeof(Element)>);                   \
+  BENCHMARK_TEMPLATE(BM_Iteration, std::vector<Element>)->Apply(ApplyCounts<sizeof(Element)>);                   \
+  BENCHMARK_TEMPLATE(BM_RandomAccess, lab::Vector<Element>)->Apply(ApplyCounts<sizeof(Element)>);                \
+  BENCHMARK_TEMPLATE(BM_RandomAccess, std::vector<Element>)->Apply(ApplyCounts<sizeof(Element)>);                \
+  BENCHMARK_TEMPLATE(BM_CopyConstruction, lab::Vector<Element>)->Apply(ApplyCounts<2 * sizeof(Element)>);        \
+  BENCHMARK_TEMPLATE(BM_CopyConstruction, std::vector<Element>)->Apply(ApplyCounts<2 * sizeof(Element)>);        \
+  BENCHMARK_TEMPLATE(BM_MoveConstruction, lab::Vector<Element>)->Apply(ApplyCounts<sizeof(Element)>);            \
+  BENCHMARK_TEMPLATE(BM_MoveConstruction, std::vector<Element>)->Apply(ApplyCounts<sizeof(Element)>);            \
+  BENCHMARK_TEMPLATE(BM_Teardown, lab::Vector<Element>)->Apply(ApplyCounts<sizeof(Element)>);                    \
+  BENCHMARK_TEMPLATE(BM_Teardown, std::vector<Element>)->Apply(ApplyCounts<sizeof(Element)>)
+
+#define LAB_NODE_BENCHMARKS(Element)                                                                              \
+  BENCHMARK_TEMPLATE(BM_PushFront, lab::containers::ForwardList<Element>)->Apply(ApplyCounts<kNodeBytes<Element>>);        \
+  BENCHMARK_TEMPLATE(BM_PushFront, std::forward_list<Element>)->Apply(ApplyCounts<kNodeBytes<Element>>);                   \
+  BENCHMARK_TEMPLATE(BM_InsertAfter, lab::containers::ForwardList<Element>)->Apply(ApplyCounts<2 * kNodeBytes<Element>>);  \
+  BENCHMARK_TEMPLATE(BM_InsertAfter, std::forward_list<Element>)->Apply(ApplyCounts<2 * kNodeBytes<Element>>);             \
+  BENCHMARK_TEMPLATE(BM_Erase, lab::containers::ForwardList<Element>)->Apply(ApplyCounts<kNodeBytes<Element>>);            \
+  BENCHMARK_TEMPLATE(BM_Erase, std::forward_list<Element>)->Apply(ApplyCounts<kNodeBytes<Element>>);                       \
+  BENCHMARK_TEMPLATE(BM_Iteration, lab::containers::ForwardList<Element>)->Apply(ApplyCounts<kNodeBytes<Element>>);        \
+  BENCHMARK_TEMPLATE(BM_Iteration, std::forward_list<Element>)->Apply(ApplyCounts<kNodeBytes<Element>>);                   \
+  BENCHMARK_TEMPLATE(BM_CopyConstruction, lab::containers::ForwardList<Element>)->Apply(ApplyCounts<2 * kNodeBytes<Element>>); \
+  BENCHMARK_TEMPLATE(BM_CopyConstruction, std::forward_list<Element>)->Apply(ApplyCounts<2 * kNodeBytes<Element>>);        \
+  BENCHMARK_TEMPLATE(BM_MoveConstruction, lab::containers::ForwardList<Element>)->Apply(ApplyCounts<kNodeBytes<Element>>); \
+  BENCHMARK_TEMPLATE(BM_MoveConstruction, std::forward_list<Element>)->Apply(ApplyCounts<kNodeBytes<Element>>);            \
+  BENCHMARK_TEMPLATE(BM_Teardown, lab::containers::ForwardList<Element>)->Apply(ApplyCounts<kNodeBytes<Element>>);         \
+  BENCHMARK_TEMPLATE(BM_Teardown, std::forward_list<Element>)->Apply(ApplyCounts<kNodeBytes<Element>>)
+
+LAB_CONTIGUOUS_BENCHMARKS(Small);
+LAB_CONTIGUOUS_BENCHMARKS(Medium);
+LAB_CONTIGUOUS_BENCHMARKS(Large);
+LAB_NODE_BENCHMARKS(Small);
+LAB_NODE_BENCHMARKS(Medium);
+LAB_NODE_BENCHMARKS(Large);
+
+#undef LAB_NODE_BENCHMARKS
+#undef LAB_CONTIGUOUS_BENCHMARKS
+// clang-format on
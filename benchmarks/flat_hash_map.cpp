@@ -0,0 +1,104 @@
+import lab_flat_hash_map;
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Seeds differ between building and probing, otherwise node maps would be probed in allocation order.
+ */
+auto ShuffledKeys(
+  std::int64_t count,  //
+  std::uint64_t seed = 42
+) -> std::vector<std::uint64_t> {
+  std::vector<std::uint64_t> keys(static_cast<std::size_t>(count));
+  std::iota(keys.begin(), keys.end(), std::uint64_t{});
+  std::ranges::shuffle(keys, std::mt19937_64{seed});
+  return keys;
+}
+
+template<typename Map>
+auto BuildMap(const std::vector<std::uint64_t>& keys) -> Map {
+  Map map;
+  for (const auto key : keys) {
+    map[key] = key;
+  }
+  return map;
+}
+
+}  // namespace
+
+template<typename Map>
+static auto BM_FindHit(benchmark::State& state) -> void {
+  const auto map{BuildMap<Map>(ShuffledKeys(state.range(0)))};
+  const auto keys{ShuffledKeys(state.range(0), 7)};
+  for (auto _ : state) {
+    std::uint64_t sum{};
+    for (const auto key : keys) {
+      if constexpr (requires { map.Find(key); }) {
+        sum += map.Find(key)->second;
+      } else {
+        sum += map.find(key)->second;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Map>
+static auto BM_FindMiss(benchmark::State& state) -> void {
+  const auto map{BuildMap<Map>(ShuffledKeys(state.range(0)))};
+  const auto keys{ShuffledKeys(state.range(0), 7)};
+  const auto offset{static_cast<std::uint64_t>(state.range(0))};
+  for (auto _ : state) {
+    std::int64_t found{};
+    for (const auto key : keys) {
+      if constexpr (requires { map.Contains(key); }) {
+        found += map.Contains(key + offset);
+      } else {
+        found += map.contains(key + offset);
+      }
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Map>
+static auto BM_InsertRange(benchmark::State& state) -> void {
+  const auto keys{ShuffledKeys(state.range(0))};
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> values;
+  values.reserve(keys.size());
+  for (const auto key : keys) {
+    values.emplace_back(key, key);
+  }
+  for (auto _ : state) {
+    Map map;
+    if constexpr (requires { map.InsertRange(values); }) {
+      map.InsertRange(values);
+    } else {
+      map.insert(values.begin(), values.end());
+    }
+    benchmark::DoNotOptimize(map);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(BM_FindHit, lab::FlatHashMap<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_FindHit, std::unordered_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_FindMiss, lab::FlatHashMap<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_FindMiss, std::unordered_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_InsertRange, lab::FlatHashMap<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_InsertRange, std::unordered_map<std::uint64_t, std::uint64_t>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+// clang-format on
@@ -0,0 +1,128 @@
+import lab_flat_map;
+import lab_vector;
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Key = std::uint64_t;
+
+using SortedMap = lab::FlatMap<Key, Key>;
+using EytzingerMap = lab::FlatMap<Key, Key, std::less<Key>, lab::Vector<Key>, lab::Vector<Key>, lab::FlatEytzingerLayout>;
+
+/**
+ * @brief Hand-rolled baseline: sorted `lab::Vector` keys searched with `std::ranges::lower_bound`.
+ */
+struct SortedVector {
+  lab::Vector<Key> keys;
+  lab::Vector<Key> values;
+};
+
+/**
+ * @brief Even keys, so every odd probe misses.
+ */
+auto ShuffledKeys(
+  std::int64_t count,  //
+  std::uint64_t seed
+) -> std::vector<Key> {
+  std::vector<Key> keys(static_cast<std::size_t>(count));
+  std::iota(keys.begin(), keys.end(), Key{});
+  for (auto& key : keys) {
+    key *= 2;
+  }
+  std::ranges::shuffle(keys, std::mt19937_64{seed});
+  return keys;
+}
+
+template<typename Map>
+auto BuildMap(const std::vector<Key>& keys) -> Map {
+  if constexpr (std::same_as<Map, SortedVector>) {
+    Map map;
+    std::vector<Key> sorted{keys};
+    std::ranges::sort(sorted);
+    map.keys.AppendRange(sorted);
+    map.values.AppendRange(sorted);
+    return map;
+  } else {
+    std::vector<std::pair<Key, Key>> values;
+    for (const auto key : keys) {
+      values.emplace_back(key, key);
+    }
+    Map map;
+    if constexpr (requires { map.InsertRange(values); }) {
+      map.InsertRange(values);
+    } else {
+      map.insert(values.begin(), values.end());
+    }
+    return map;
+  }
+}
+
+template<typename Map>
+auto Lookup(
+  const Map& map,  //
+  Key key
+) -> Key {
+  if constexpr (std::same_as<Map, SortedVector>) {
+    const auto it{std::ranges::lower_bound(map.keys, key)};
+    return it != map.keys.end() && *it == key ? map.values[static_cast<std::size_t>(it - map.keys.begin())] : 0;
+  } else if constexpr (requires { map.Find(key); }) {
+    const auto it{map.Find(key)};
+    return it != map.end() ? it->second : 0;
+  } else {
+    const auto it{map.find(key)};
+    return it != map.end() ? it->second : 0;
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Half of the probes hit, in an order unrelated to the build order.
+ */
+template<typename Map>
+static auto BM_Find(benchmark::State& state) -> void {
+  const auto map{BuildMap<Map>(ShuffledKeys(state.range(0), 42))};
+  auto probes{ShuffledKeys(state.range(0), 7)};
+  for (std::size_t i{}; i < probes.size(); i += 2) {
+    ++probes[i];
+  }
+  for (auto _ : state) {
+    Key sum{};
+    for (const auto key : probes) {
+      sum += Lookup(map, key);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Map>
+static auto BM_InsertRange(benchmark::State& state) -> void {
+  const auto keys{ShuffledKeys(state.range(0), 42)};
+  for (auto _ : state) {
+    auto map{BuildMap<Map>(keys)};
+    benchmark::DoNotOptimize(map);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(BM_Find, SortedMap)->RangeMultiplier(8)->Range(1 << 4, 1 << 16);
+BENCHMARK_TEMPLATE(BM_Find, EytzingerMap)->RangeMultiplier(8)->Range(1 << 4, 1 << 16);
+BENCHMARK_TEMPLATE(BM_Find, SortedVector)->RangeMultiplier(8)->Range(1 << 4, 1 << 16);
+BENCHMARK_TEMPLATE(BM_Find, std::map<Key, Key>)->RangeMultiplier(8)->Range(1 << 4, 1 << 16);
+BENCHMARK_TEMPLATE(BM_InsertRange, SortedMap)->RangeMultiplier(8)->Range(1 << 4, 1 << 16);
+BENCHMARK_TEMPLATE(BM_InsertRange, std::map<Key, Key>)->RangeMultiplier(8)->Range(1 << 4, 1 << 16);
+// clang-format on
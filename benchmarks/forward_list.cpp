@@ -0,0 +1,118 @@
+import lab_forward_list;
+import lab_list;
+import lab_unrolled_forward_list;
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <forward_list>
+#include <numeric>
+#include <random>
+#include <vector>
+
+template<typename Container>
+static auto BM_Traversal(benchmark::State& state) -> void {
+  std::vector<std::int64_t> values(static_cast<std::size_t>(state.range(0)));
+  std::iota(values.begin(), values.end(), std::int64_t{});
+  Container container(values.begin(), values.end());
+  for (auto _ : state) {
+    std::int64_t sum{};
+    for (const auto value : container) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Container>
+static auto BM_Sort(benchmark::State& state) -> void {
+  std::vector<std::int64_t> values(static_cast<std::size_t>(state.range(0)));
+  std::iota(values.begin(), values.end(), std::int64_t{});
+  std::ranges::shuffle(values, std::mt19937_64{42});
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container container(values.begin(), values.end());
+    state.ResumeTiming();
+    if constexpr (requires { container.Sort(); }) {
+      container.Sort();
+    } else {
+      container.sort();
+    }
+    benchmark::DoNotOptimize(container);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @brief List whose traversal order is unrelated to the memory order of its nodes: shuffled values, then sorted.
+ */
+static auto MakeScatteredList(std::int64_t size) -> lab::containers::ForwardList<std::int64_t> {
+  std::vector<std::int64_t> values(static_cast<std::size_t>(size));
+  std::iota(values.begin(), values.end(), std::int64_t{});
+  std::ranges::shuffle(values, std::mt19937_64{42});
+  lab::containers::ForwardList<std::int64_t> list(values.begin(), values.end());
+  list.Sort();
+  return list;
+}
+
+static auto BM_ScatteredTraversal(benchmark::State& state) -> void {
+  const auto list{MakeScatteredList(state.range(0))};
+  for (auto _ : state) {
+    std::int64_t sum{};
+    for (const auto value : list) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static auto BM_ScatteredForEachBatched(benchmark::State& state) -> void {
+  const auto list{MakeScatteredList(state.range(0))};
+  for (auto _ : state) {
+    std::int64_t sum{};
+    list.ForEachBatched([&sum](std::int64_t value) { sum += value; }, static_cast<std::size_t>(state.range(1)));
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static auto BM_CompactedTraversal(benchmark::State& state) -> void {
+  auto list{MakeScatteredList(state.range(0))};
+  list.Compact();
+  for (auto _ : state) {
+    std::int64_t sum{};
+    for (const auto value : list) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static auto BM_Compact(benchmark::State& state) -> void {
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto list{MakeScatteredList(state.range(0))};
+    state.ResumeTiming();
+    list.Compact();
+    benchmark::DoNotOptimize(list);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(BM_Traversal, lab::containers::ForwardList<std::int64_t>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_Traversal, lab::containers::UnrolledForwardList<std::int64_t>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_Traversal, lab::containers::List<std::int64_t>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_Traversal, std::forward_list<std::int64_t>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_Sort, lab::containers::ForwardList<std::int64_t>)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Sort, lab::containers::List<std::int64_t>)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Sort, std::forward_list<std::int64_t>)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_ScatteredTraversal)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_ScatteredForEachBatched)->ArgsProduct({benchmark::CreateRange(1 << 10, 1 << 22, 8), {4, 16}});
+BENCHMARK(BM_CompactedTraversal)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_Compact)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+// clang-format on
@@ -0,0 +1,80 @@
+import lab_mapped_vector;
+import lab_vector;
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+
+namespace {
+
+auto DatasetPath() -> std::filesystem::path {
+  return std::filesystem::temp_directory_path() / "lab-mapped-vector-benchmark.bin";
+}
+
+/**
+ * @brief Writes `size` consecutive integers to the dataset file.
+ */
+auto WriteDataset(std::int64_t size) -> void {
+  std::filesystem::remove(DatasetPath());
+  lab::MappedVector<std::uint64_t> dataset{DatasetPath()};
+  dataset.Resize(static_cast<std::size_t>(size));
+  std::iota(dataset.begin(), dataset.end(), std::uint64_t{});
+}
+
+}  // namespace
+
+/**
+ * @brief Opens the dataset zero-copy and touches every element once.
+ */
+static auto BM_OpenMapped(benchmark::State& state) -> void {
+  WriteDataset(state.range(0));
+  for (auto _ : state) {
+    const lab::MappedVector<const std::uint64_t> dataset{DatasetPath(), lab::AccessHint::kSequential};
+    benchmark::DoNotOptimize(std::accumulate(dataset.begin(), dataset.end(), std::uint64_t{}));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(std::uint64_t)));
+  std::filesystem::remove(DatasetPath());
+}
+
+/**
+ * @brief Reads the dataset into a `lab::Vector` before touching every element once.
+ */
+static auto BM_ReadIntoVector(benchmark::State& state) -> void {
+  WriteDataset(state.range(0));
+  for (auto _ : state) {
+    std::ifstream file{DatasetPath(), std::ios::binary};
+    lab::Vector<std::uint64_t> dataset(static_cast<std::size_t>(state.range(0)));
+    file.read(
+      reinterpret_cast<char*>(dataset.Data()),  //
+      static_cast<std::streamsize>(dataset.Size() * sizeof(std::uint64_t))
+    );
+    benchmark::DoNotOptimize(std::accumulate(dataset.begin(), dataset.end(), std::uint64_t{}));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(std::uint64_t)));
+  std::filesystem::remove(DatasetPath());
+}
+
+/**
+ * @brief Appends to an initially empty file, growing it page by page.
+ */
+static auto BM_PushBackMapped(benchmark::State& state) -> void {
+  for (auto _ : state) {
+    std::filesystem::remove(DatasetPath());
+    lab::MappedVector<std::uint64_t> dataset{DatasetPath()};
+    for (std::int64_t i{}; i < state.range(0); ++i) {
+      dataset.PushBack(static_cast<std::uint64_t>(i));
+    }
+    benchmark::DoNotOptimize(dataset.Data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  std::filesystem::remove(DatasetPath());
+}
+
+// clang-format off
+BENCHMARK(BM_OpenMapped)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(BM_ReadIntoVector)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(BM_PushBackMapped)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+// clang-format on
@@ -0,0 +1,79 @@
+import lab_ring_deque;
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <deque>
+#include <list>
+
+namespace {
+
+template<typename Queue>
+auto Push(
+  Queue& queue,  //
+  std::int64_t value
+) -> void {
+  if constexpr (requires { queue.PushBack(value); }) {
+    queue.PushBack(value);
+  } else {
+    queue.push_back(value);
+  }
+}
+
+template<typename Queue>
+auto Pop(Queue& queue) -> std::int64_t {
+  if constexpr (requires { queue.PopFront(); }) {
+    const std::int64_t value{queue.Front()};
+    queue.PopFront();
+    return value;
+  } else {
+    const std::int64_t value{queue.front()};
+    queue.pop_front();
+    return value;
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Work queue in steady state: `range(0)` queued items, every iteration retires one and enqueues one.
+ */
+template<typename Queue>
+static auto BM_Fifo(benchmark::State& state) -> void {
+  Queue queue;
+  for (std::int64_t i{}; i < state.range(0); ++i) {
+    Push(queue, i);
+  }
+  std::int64_t next{state.range(0)};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Pop(queue));
+    Push(queue, next++);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief Fills a fresh queue and drains it, growth included.
+ */
+template<typename Queue>
+static auto BM_FillAndDrain(benchmark::State& state) -> void {
+  for (auto _ : state) {
+    Queue queue;
+    for (std::int64_t i{}; i < state.range(0); ++i) {
+      Push(queue, i);
+    }
+    for (std::int64_t i{}; i < state.range(0); ++i) {
+      benchmark::DoNotOptimize(Pop(queue));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(BM_Fifo, lab::RingDeque<std::int64_t>)->RangeMultiplier(32)->Range(1 << 5, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Fifo, std::deque<std::int64_t>)->RangeMultiplier(32)->Range(1 << 5, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Fifo, std::list<std::int64_t>)->RangeMultiplier(32)->Range(1 << 5, 1 << 20);
+BENCHMARK_TEMPLATE(BM_FillAndDrain, lab::RingDeque<std::int64_t>)->RangeMultiplier(32)->Range(1 << 5, 1 << 20);
+BENCHMARK_TEMPLATE(BM_FillAndDrain, std::deque<std::int64_t>)->RangeMultiplier(32)->Range(1 << 5, 1 << 20);
+BENCHMARK_TEMPLATE(BM_FillAndDrain, std::list<std::int64_t>)->RangeMultiplier(32)->Range(1 << 5, 1 << 20);
+// clang-format on
@@ -0,0 +1,141 @@
+import lab_forward_list;
+import lab_serialize;
+import lab_vector;
+
+#include <benchmark/benchmark.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <numeric>
+
+namespace {
+
+/**
+ * @brief Scratch file rewound before every iteration, so every pass hits the page cache the same way.
+ */
+class ScratchFile {
+ public:
+  ScratchFile()
+    : fd_{::open(Path().c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644)} { }
+
+  ScratchFile(const ScratchFile&) = delete;
+  auto operator=(const ScratchFile&) -> ScratchFile& = delete;
+
+  ~ScratchFile() {
+    ::close(fd_);
+    std::filesystem::remove(Path());
+  }
+
+  [[nodiscard]] auto Rewind() const -> int {
+    ::lseek(fd_, 0, SEEK_SET);
+    return fd_;
+  }
+
+ private:
+  [[nodiscard]] static auto Path() -> std::filesystem::path {
+    return std::filesystem::temp_directory_path() / "lab-serialize-benchmark.bin";
+  }
+
+  int fd_;
+};
+
+auto MakeValues(std::int64_t size) -> lab::Vector<std::uint64_t> {
+  lab::Vector<std::uint64_t> values(static_cast<std::size_t>(size));
+  std::iota(values.begin(), values.end(), std::uint64_t{});
+  return values;
+}
+
+/**
+ * @brief Baseline: one `write` per element after the header.
+ */
+template<typename Range>
+auto WriteEach(
+  int fd,  //
+  const Range& range,
+  std::uint64_t size
+) -> void {
+  const auto header{lab::SerializedHeader::For<std::uint64_t>(size)};
+  benchmark::DoNotOptimize(::write(fd, &header, sizeof(header)));
+  for (const std::uint64_t& value : range) {
+    benchmark::DoNotOptimize(::write(fd, &value, sizeof(value)));
+  }
+}
+
+}  // namespace
+
+static auto BM_WriteVectorEach(benchmark::State& state) -> void {
+  const ScratchFile file;
+  const auto values{MakeValues(state.range(0))};
+  for (auto _ : state) {
+    WriteEach(file.Rewind(), values, values.Size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static auto BM_WriteVector(benchmark::State& state) -> void {
+  const ScratchFile file;
+  const auto values{MakeValues(state.range(0))};
+  for (auto _ : state) {
+    lab::WriteVector(file.Rewind(), values);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static auto BM_WriteForwardListEach(benchmark::State& state) -> void {
+  const ScratchFile file;
+  const auto values{MakeValues(state.range(0))};
+  const lab::containers::ForwardList<std::uint64_t> list{values.begin(), values.end()};
+  for (auto _ : state) {
+    WriteEach(file.Rewind(), list, values.Size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static auto BM_WriteForwardList(benchmark::State& state) -> void {
+  const ScratchFile file;
+  const auto values{MakeValues(state.range(0))};
+  const lab::containers::ForwardList<std::uint64_t> list{values.begin(), values.end()};
+  for (auto _ : state) {
+    lab::WriteForwardList(file.Rewind(), list);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static auto BM_ReadVectorEach(benchmark::State& state) -> void {
+  const ScratchFile file;
+  lab::WriteVector(file.Rewind(), MakeValues(state.range(0)));
+  for (auto _ : state) {
+    const int fd{file.Rewind()};
+    lab::SerializedHeader header;
+    benchmark::DoNotOptimize(::read(fd, &header, sizeof(header)));
+    lab::Vector<std::uint64_t> values;
+    for (std::uint64_t i{}; i < header.size; ++i) {
+      std::uint64_t value;
+      benchmark::DoNotOptimize(::read(fd, &value, sizeof(value)));
+      values.PushBack(value);
+    }
+    benchmark::DoNotOptimize(values.Data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static auto BM_ReadVector(benchmark::State& state) -> void {
+  const ScratchFile file;
+  lab::WriteVector(file.Rewind(), MakeValues(state.range(0)));
+  for (auto _ : state) {
+    const auto values{lab::ReadVector<std::uint64_t>(file.Rewind())};
+    benchmark::DoNotOptimize(values.Data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// clang-format off
+BENCHMARK(BM_WriteVectorEach)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK(BM_WriteVector)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(BM_WriteForwardListEach)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK(BM_WriteForwardList)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(BM_ReadVectorEach)->RangeMultiplier(16)->Range(1 << 8, 1 << 16);
+BENCHMARK(BM_ReadVector)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+// clang-format on
@@ -0,0 +1,59 @@
+import lab_simd;
+import lab_vector;
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <ranges>
+
+namespace {
+
+/**
+ * @brief Vector `0, 1, ..., size - 1`, searched for the missing value `-1` (full linear scan).
+ */
+auto MakeIota(std::int64_t size) -> lab::Vector<std::int32_t> {
+  lab::Vector<std::int32_t> vector(static_cast<lab::Vector<std::int32_t>::SizeType>(size));
+  std::iota(vector.begin(), vector.end(), 0);
+  return vector;
+}
+
+}  // namespace
+
+static auto BM_FindStd(benchmark::State& state) -> void {
+  const auto vector{MakeIota(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::ranges::find(vector, -1));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static auto BM_FindSimd(benchmark::State& state) -> void {
+  const auto vector{MakeIota(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lab::Find(vector, -1));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static auto BM_MinMaxStd(benchmark::State& state) -> void {
+  const auto vector{MakeIota(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::ranges::minmax(vector));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static auto BM_MinMaxSimd(benchmark::State& state) -> void {
+  const auto vector{MakeIota(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(lab::MinMax(vector));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_FindStd)->RangeMultiplier(8)->Range(16, 1 << 16);
+BENCHMARK(BM_FindSimd)->RangeMultiplier(8)->Range(16, 1 << 16);
+BENCHMARK(BM_MinMaxStd)->RangeMultiplier(8)->Range(16, 1 << 16);
+BENCHMARK(BM_MinMaxSimd)->RangeMultiplier(8)->Range(16, 1 << 16);
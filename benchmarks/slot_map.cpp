@@ -0,0 +1,100 @@
+import lab_forward_list;
+import lab_slot_map;
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Entity {
+  std::int64_t position;
+  std::int64_t velocity;
+};
+
+/**
+ * @brief Map after a round of erasures and re-insertions, as an entity table looks after a while.
+ */
+auto MakeEntities(std::int64_t size) -> std::pair<lab::SlotMap<Entity>, std::vector<lab::SlotMap<Entity>::Handle>> {
+  lab::SlotMap<Entity> entities;
+  std::vector<lab::SlotMap<Entity>::Handle> handles;
+  for (std::int64_t i{}; i < size; ++i) {
+    handles.push_back(entities.Insert({i, 1}));
+  }
+  std::ranges::shuffle(handles, std::mt19937_64{42});
+  for (auto& handle : handles | std::views::take(handles.size() / 2)) {
+    entities.Erase(handle);
+    handle = entities.Insert({0, 1});
+  }
+  std::ranges::shuffle(handles, std::mt19937_64{7});
+  return {std::move(entities), std::move(handles)};
+}
+
+}  // namespace
+
+static auto BM_IterateSlotMap(benchmark::State& state) -> void {
+  auto [entities, handles]{MakeEntities(state.range(0))};
+  for (auto _ : state) {
+    for (auto& entity : entities) {
+      entity.position += entity.velocity;
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @brief Baseline: pointer-stable entities in a `ForwardList`, inserted in shuffled order and then sorted.
+ */
+static auto BM_IterateForwardList(benchmark::State& state) -> void {
+  std::vector<Entity> values;
+  for (std::int64_t i{}; i < state.range(0); ++i) {
+    values.push_back({i, 1});
+  }
+  std::ranges::shuffle(values, std::mt19937_64{42});
+  lab::containers::ForwardList<Entity> entities(values.begin(), values.end());
+  entities.Sort([](const Entity& lhs, const Entity& rhs) { return lhs.position < rhs.position; });
+  for (auto _ : state) {
+    for (auto& entity : entities) {
+      entity.position += entity.velocity;
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static auto BM_LookupSlotMap(benchmark::State& state) -> void {
+  const auto [entities, handles]{MakeEntities(state.range(0))};
+  for (auto _ : state) {
+    std::int64_t sum{};
+    for (const auto handle : handles) {
+      sum += entities[handle].velocity;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static auto BM_ChurnSlotMap(benchmark::State& state) -> void {
+  auto [entities, handles]{MakeEntities(state.range(0))};
+  for (auto _ : state) {
+    for (auto& handle : handles) {
+      entities.Erase(handle);
+      handle = entities.Insert({0, 1});
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// clang-format off
+BENCHMARK(BM_IterateSlotMap)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_IterateForwardList)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_LookupSlotMap)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_ChurnSlotMap)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+// clang-format on
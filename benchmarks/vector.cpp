@@ -0,0 +1,131 @@
+import lab_vector;
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Trivially copyable record, relocated by `std::memcpy` on growth.
+ */
+struct Record {
+  explicit Record(std::int64_t key) noexcept : key{key}, value{key} { }
+
+  std::int64_t key;
+  std::int64_t value;
+};
+
+/**
+ * @brief Same layout as `Record`, but user provided copy/move operations force per-element relocation.
+ */
+struct ElementwiseRecord {
+  explicit ElementwiseRecord(std::int64_t key) noexcept : key{key}, value{key} { }
+
+  ElementwiseRecord(const ElementwiseRecord& other) noexcept : key{other.key}, value{other.value} { }
+
+  ElementwiseRecord(ElementwiseRecord&& other) noexcept : key{other.key}, value{other.value} { }
+
+  auto operator=(const ElementwiseRecord& other) noexcept -> ElementwiseRecord& = default;
+
+  auto operator=(ElementwiseRecord&& other) noexcept -> ElementwiseRecord& = default;
+
+  ~ElementwiseRecord() { }
+
+  std::int64_t key;
+  std::int64_t value;
+};
+
+/**
+ * @brief String-like handle owning a heap buffer, opted in as trivially relocatable.
+ */
+struct Handle {
+  explicit Handle(std::int64_t value) : value_{std::make_unique<std::int64_t>(value)} { }
+
+  std::unique_ptr<std::int64_t> value_;
+};
+
+/**
+ * @brief Same as `Handle`, but relocated element by element (move construct + destroy).
+ */
+struct ElementwiseHandle {
+  explicit ElementwiseHandle(std::int64_t value) : value_{std::make_unique<std::int64_t>(value)} { }
+
+  std::unique_ptr<std::int64_t> value_;
+};
+
+}  // namespace
+
+template<>
+struct lab::IsTriviallyRelocatable<Handle> : std::true_type { };
+
+static_assert(lab::kIsTriviallyRelocatable<Record>);
+static_assert(!lab::kIsTriviallyRelocatable<ElementwiseRecord>);
+static_assert(lab::kIsTriviallyRelocatable<Handle>);
+static_assert(!lab::kIsTriviallyRelocatable<ElementwiseHandle>);
+
+template<typename Container>
+static auto BM_EmplaceBackGrowth(benchmark::State& state) -> void {
+  const auto count{static_cast<std::int64_t>(state.range(0))};
+  for (auto _ : state) {
+    Container container;
+    for (std::int64_t i{}; i < count; ++i) {
+      if constexpr (requires { container.EmplaceBack(i); }) {
+        container.EmplaceBack(i);
+      } else {
+        container.emplace_back(i);
+      }
+    }
+    benchmark::DoNotOptimize(container);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+template<typename Container>
+static auto BM_Reallocation(benchmark::State& state) -> void {
+  const auto count{static_cast<std::int64_t>(state.range(0))};
+  for (auto _ : state) {
+    state.PauseTiming();
+    Container container;
+    for (std::int64_t i{}; i < count; ++i) {
+      if constexpr (requires { container.EmplaceBack(i); }) {
+        container.EmplaceBack(i);
+      } else {
+        container.emplace_back(i);
+      }
+    }
+    if constexpr (requires { container.ShrinkToFit(); }) {
+      container.ShrinkToFit();
+    } else {
+      container.shrink_to_fit();
+    }
+    state.ResumeTiming();
+    if constexpr (requires { container.EmplaceBack(count); }) {
+      container.EmplaceBack(count);
+    } else {
+      container.emplace_back(count);
+    }
+    benchmark::DoNotOptimize(container);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(BM_EmplaceBackGrowth, lab::Vector<Record>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_EmplaceBackGrowth, lab::Vector<ElementwiseRecord>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_EmplaceBackGrowth, std::vector<Record>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_EmplaceBackGrowth, lab::Vector<Handle>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_EmplaceBackGrowth, lab::Vector<ElementwiseHandle>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_EmplaceBackGrowth, std::vector<Handle>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_Reallocation, lab::Vector<Record>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_Reallocation, lab::Vector<ElementwiseRecord>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_Reallocation, std::vector<Record>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_Reallocation, lab::Vector<Handle>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_Reallocation, lab::Vector<ElementwiseHandle>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_Reallocation, std::vector<Handle>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+// clang-format on
@@ -7,6 +7,7 @@ class Containers(ConanFile):
 
     def requirements(self) -> None:
         self.requires("catch2/3.11.0")
+        self.requires("benchmark/1.9.1")
 
     def generate(self) -> None:
         tc = CMakeToolchain(self)
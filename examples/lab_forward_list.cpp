@@ -1,6 +1,7 @@
 import lab_forward_list;
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <print>
 #include <ranges>
@@ -16,13 +17,17 @@ auto GenerateRange(lab::containers::ForwardList<int>& list) -> void {
 }
 
 auto EraseElements(lab::containers::ForwardList<int>& list, std::initializer_list<int> elements) -> void {
-  for (const int value : elements) {
-    auto position{std::ranges::find(list, value)};
-    if (position == std::ranges::cend(list)) {
-      std::println(stderr, "Missing value {} in ForwardList instance", value);
+  std::size_t erased_count{};
+  for (auto previous{list.BeforeBegin()}; std::next(previous) != std::ranges::end(list);) {
+    if (std::ranges::find(elements, *std::next(previous)) != elements.end()) {
+      list.EraseAfter(previous);
+      ++erased_count;
       continue;
     }
-    list.Erase(position);
+    ++previous;
+  }
+  if (erased_count != elements.size()) {
+    std::println(stderr, "Missing {} value(s) in ForwardList instance", elements.size() - erased_count);
   }
 }
 
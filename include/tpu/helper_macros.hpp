@@ -4,9 +4,25 @@
   #define LAB_TRY try
   #define LAB_CATCH(exception) catch (exception)
   #define LAB_PROPAGATE_EXCEPTION throw
+  #define LAB_TRY_BEGIN \
+    try                 \
+    {
+  #define LAB_TRY_END }
+  #define LAB_CATCH_BEGIN(exception) \
+    catch (exception)                \
+    {
+  #define LAB_CATCH_END }
 #else
   #define LAB_TRY if constexpr (true)
   #define LAB_CATCH(exception) if constexpr (false)
   #define LAB_PROPAGATE_EXCEPTION \
     (void) int { }
+  #define LAB_TRY_BEGIN \
+    if (true)           \
+    {
+  #define LAB_TRY_END }
+  #define LAB_CATCH_BEGIN(exception) \
+    if (false)                       \
+    {
+  #define LAB_CATCH_END }
 #endif
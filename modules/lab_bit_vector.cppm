@@ -0,0 +1,499 @@
+module;
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+#include <utility>
+
+export module lab_bit_vector;
+
+export import lab_vector;
+
+import lab_simd;
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Dynamic array of bits packed into 64-bit words.
+ * @class
+ *
+ * @tparam Allocator Allocator type, rebound to the word type for the storage
+ * @tparam GrowthPolicy Capacity growth policy of the word storage, see `IsGrowthPolicy`
+ *
+ * @details Bit `i` lives in word `i / 64` at position `i % 64`, the words are a `Vector` with the same growth policy
+ * as any other `Vector`, so `PushBack` reallocates exactly as often as a `Vector<std::uint64_t>` would per 64 bits.
+ * Bits past `Size()` in the last word are always zero, which lets `Count`, `FindFirst`/`FindNext`, `==` and the
+ * `And`/`Or`/`Xor` kernels work on whole words (SIMD dispatched through `lab_simd`) without masking.
+ *
+ * @note Element access goes through the `Reference` proxy, as with `std::vector<bool>`. Iterators and references are
+ * invalidated by every reallocation.
+ */
+template<typename Allocator = std::allocator<bool>, IsGrowthPolicy GrowthPolicy = OneAndHalfGrowth>
+class [[nodiscard]] BitVector {
+ public:
+  using WordType = std::uint64_t;
+  using ValueType = bool;
+  using value_type = bool;
+  using ConstReference = bool;
+  using const_reference = bool;
+  using DifferenceType = std::ptrdiff_t;
+  using difference_type = std::ptrdiff_t;
+  using SizeType = std::size_t;
+  using size_type = std::size_t;
+  using AllocatorType = Allocator;
+  using allocator_type = Allocator;
+  using GrowthPolicyType = GrowthPolicy;
+
+  /**
+   * @brief Proxy to a single bit.
+   * @class
+   *
+   * @details Assignment writes the bit, even through a `const Reference` (required by `std::indirectly_writable`).
+   */
+  class Reference {
+    friend BitVector;
+
+    Reference(
+      WordType* word,  //
+      WordType mask
+    ) noexcept
+      : word_{word}
+      , mask_{mask} { }
+
+   public:
+    Reference(const Reference&) noexcept = default;
+
+    auto operator=(const Reference& other) noexcept -> Reference& {
+      *this = static_cast<bool>(other);
+      return *this;
+    }
+
+    auto operator=(bool value) const noexcept -> const Reference& {
+      *word_ = value ? *word_ | mask_ : *word_ & ~mask_;
+      return *this;
+    }
+
+    ~Reference() = default;
+
+    operator bool() const noexcept { return (*word_ & mask_) != 0; }
+
+    auto Flip() const noexcept -> void { *word_ ^= mask_; }
+
+    friend auto swap(
+      Reference lhs,  //
+      Reference rhs
+    ) noexcept -> void {
+      const bool value{lhs};
+      lhs = static_cast<bool>(rhs);
+      rhs = value;
+    }
+
+   private:
+    WordType* word_;
+    WordType mask_;
+  };
+
+  using reference = Reference;
+  using Iterator = detail::IndexIterator<false, BitVector>;
+  using iterator = Iterator;
+  using ConstIterator = detail::IndexIterator<true, BitVector>;
+  using const_iterator = ConstIterator;
+  using ReverseIterator = std::reverse_iterator<Iterator>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static constexpr SizeType kWordBits{std::numeric_limits<WordType>::digits};
+
+ private:
+  using WordAllocator = std::allocator_traits<Allocator>::template rebind_alloc<WordType>;
+  using WordVector = Vector<WordType, WordAllocator, GrowthPolicy>;
+
+ public:
+  BitVector() noexcept(std::is_nothrow_default_constructible_v<WordAllocator>) = default;
+
+  explicit BitVector(const AllocatorType& allocator) noexcept : words_{WordAllocator{allocator}} { }
+
+  BitVector(
+    SizeType count,  //
+    bool value = false,
+    const AllocatorType& allocator = AllocatorType{}
+  )
+    : words_{WordAllocator{allocator}} {
+    Resize(count, value);
+  }
+
+  BitVector(
+    std::initializer_list<bool> values,  //
+    const AllocatorType& allocator = AllocatorType{}
+  )
+    : words_{WordAllocator{allocator}} {
+    Reserve(values.size());
+    for (const bool value : values) {
+      PushBack(value);
+    }
+  }
+
+  BitVector(const BitVector&) = default;
+
+  BitVector(
+    const BitVector& other,  //
+    const AllocatorType& allocator
+  )
+    : words_{other.words_, WordAllocator{allocator}}
+    , size_{other.size_} { }
+
+  BitVector(BitVector&& other) noexcept
+    : words_{std::move(other.words_)}
+    , size_{std::exchange(other.size_, 0)} { }
+
+  BitVector(
+    BitVector&& other,  //
+    const AllocatorType& allocator
+  )
+    : words_{std::move(other.words_), WordAllocator{allocator}}
+    , size_{other.size_} {
+    other.Clear();
+  }
+
+  auto operator=(const BitVector&) -> BitVector& = default;
+
+  /**
+   * @brief Move assignment.
+   * @public
+   *
+   * @details Leaves `other` empty even when unequal allocators force `Vector` to move word by word.
+   */
+  auto operator=(BitVector&& other) noexcept(std::is_nothrow_move_assignable_v<WordVector>) -> BitVector& {
+    if (this != &other) {
+      words_ = std::move(other.words_);
+      size_ = other.size_;
+      other.Clear();
+    }
+    return *this;
+  }
+
+  ~BitVector() = default;
+
+  [[nodiscard]] auto begin() noexcept -> Iterator { return {this, 0}; }
+
+  [[nodiscard]] auto end() noexcept -> Iterator { return {this, Size()}; }
+
+  [[nodiscard]] auto begin() const noexcept -> ConstIterator { return {this, 0}; }
+
+  [[nodiscard]] auto end() const noexcept -> ConstIterator { return {this, Size()}; }
+
+  [[nodiscard]] auto cbegin() const noexcept -> ConstIterator { return begin(); }
+
+  [[nodiscard]] auto cend() const noexcept -> ConstIterator { return end(); }
+
+  [[nodiscard]] auto rbegin() noexcept -> ReverseIterator { return ReverseIterator{end()}; }
+
+  [[nodiscard]] auto rend() noexcept -> ReverseIterator { return ReverseIterator{begin()}; }
+
+  [[nodiscard]] auto crbegin() const noexcept -> ConstReverseIterator { return ConstReverseIterator{cend()}; }
+
+  [[nodiscard]] auto crend() const noexcept -> ConstReverseIterator { return ConstReverseIterator{cbegin()}; }
+
+  [[nodiscard]] auto Size() const noexcept -> SizeType { return size_; }
+
+  [[nodiscard]] auto Empty() const noexcept -> bool { return size_ == 0; }
+
+  /**
+   * @brief Number of bits that fit without reallocation.
+   */
+  [[nodiscard]] auto Capacity() const noexcept -> SizeType { return words_.Capacity() * kWordBits; }
+
+  [[nodiscard]] auto GetAllocator() const noexcept -> AllocatorType { return AllocatorType{words_.GetAllocator()}; }
+
+  [[nodiscard]] auto GetGrowthPolicy() noexcept -> GrowthPolicyType& { return words_.GetGrowthPolicy(); }
+
+  [[nodiscard]] auto GetGrowthPolicy() const noexcept -> const GrowthPolicyType& { return words_.GetGrowthPolicy(); }
+
+  /**
+   * @brief Underlying words, bit `i` is `(Words()[i / 64] >> (i % 64)) & 1`.
+   * @public
+   *
+   * @details Bits past `Size()` in the last word are zero.
+   */
+  [[nodiscard]] auto Words() const noexcept -> std::span<const WordType> { return {words_.Data(), words_.Size()}; }
+
+  [[nodiscard]] auto operator[](SizeType index) noexcept -> Reference {
+    return {words_.Data() + index / kWordBits, WordType{1} << (index % kWordBits)};
+  }
+
+  [[nodiscard]] auto operator[](SizeType index) const noexcept -> ConstReference { return Test(index); }
+
+ private:
+  auto RangeCheck(SizeType index) const -> void {
+    if (index >= Size()) {
+      throw std::out_of_range{
+        std::format("BitVector::RangeCheck: index (which is {}) >= this->size() (which is {})", index, Size())
+      };
+    }
+  }
+
+ public:
+  [[nodiscard]] auto At(SizeType index) -> Reference {
+    RangeCheck(index);
+    return (*this)[index];
+  }
+
+  [[nodiscard]] auto At(SizeType index) const -> ConstReference {
+    RangeCheck(index);
+    return (*this)[index];
+  }
+
+  [[nodiscard]] auto Front() noexcept -> Reference { return (*this)[0]; }
+
+  [[nodiscard]] auto Front() const noexcept -> ConstReference { return (*this)[0]; }
+
+  [[nodiscard]] auto Back() noexcept -> Reference { return (*this)[Size() - 1]; }
+
+  [[nodiscard]] auto Back() const noexcept -> ConstReference { return (*this)[Size() - 1]; }
+
+  [[nodiscard]] auto Test(SizeType index) const noexcept -> bool {
+    return ((words_[index / kWordBits] >> (index % kWordBits)) & 1) != 0;
+  }
+
+  auto Set(
+    SizeType index,  //
+    bool value = true
+  ) noexcept -> void {
+    (*this)[index] = value;
+  }
+
+  auto Reset(SizeType index) noexcept -> void { Set(index, false); }
+
+  auto Flip(SizeType index) noexcept -> void { (*this)[index].Flip(); }
+
+  /**
+   * @brief Complements every bit.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  auto Flip() noexcept -> void {
+    for (auto& word : words_) {
+      word = ~word;
+    }
+    ClearUnusedBits();
+  }
+
+  auto Reserve(SizeType bits) -> void { words_.Reserve(WordCount(bits)); }
+
+  auto ShrinkToFit() -> void { words_.ShrinkToFit(); }
+
+  auto Clear() noexcept -> void {
+    words_.Clear();
+    size_ = 0;
+  }
+
+  /**
+   * @brief Resizes to `count` bits, new bits are set to `value`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  auto Resize(
+    SizeType count,  //
+    bool value = false
+  ) -> void {
+    if (count > size_ && value && size_ % kWordBits != 0) {
+      words_.Back() |= ~WordType{} << (size_ % kWordBits);
+    }
+    words_.Resize(WordCount(count), value ? ~WordType{} : WordType{});
+    size_ = count;
+    ClearUnusedBits();
+  }
+
+  /**
+   * @brief Appends one bit, a new word is appended (with `Vector` growth) every 64 bits.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  auto PushBack(bool value) -> void {
+    const SizeType offset{size_ % kWordBits};
+    if (offset == 0) {
+      words_.PushBack(WordType{value});
+    } else {
+      words_.Back() |= WordType{value} << offset;
+    }
+    ++size_;
+  }
+
+  /**
+   * @brief Removes the last bit.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   * - the container is empty
+   */
+  auto PopBack() noexcept -> void {
+    assert(!Empty());
+    --size_;
+    if (size_ % kWordBits == 0) {
+      words_.PopBack();
+    } else {
+      words_.Back() &= ~(WordType{1} << (size_ % kWordBits));
+    }
+  }
+
+  /**
+   * @brief Number of set bits.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] auto Count() const noexcept -> SizeType {
+    return detail::SimdPopCountWords(words_.Data(), words_.Size());
+  }
+
+  /**
+   * @brief Index of the first set bit, `Size()` if there is none.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] auto FindFirst() const noexcept -> SizeType { return FindFromWord(0); }
+
+  /**
+   * @brief Index of the first set bit after `index`, `Size()` if there is none.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @details Whole zero words are skipped, each non-zero word costs one `std::countr_zero`.
+   */
+  [[nodiscard]] auto FindNext(SizeType index) const noexcept -> SizeType {
+    ++index;
+    if (index >= size_) {
+      return size_;
+    }
+    const SizeType word_index{index / kWordBits};
+    const WordType word{words_[word_index] & (~WordType{} << (index % kWordBits))};
+    if (word != 0) {
+      return word_index * kWordBits + static_cast<SizeType>(std::countr_zero(word));
+    }
+    return FindFromWord(word_index + 1);
+  }
+
+  /**
+   * @brief In-place intersection with `other`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   * - `other.Size() != Size()`
+   */
+  auto And(const BitVector& other) noexcept -> BitVector& { return Apply<std::bit_and<>>(other); }
+
+  /**
+   * @brief In-place union with `other`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   * - `other.Size() != Size()`
+   */
+  auto Or(const BitVector& other) noexcept -> BitVector& { return Apply<std::bit_or<>>(other); }
+
+  /**
+   * @brief In-place symmetric difference with `other`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   * - `other.Size() != Size()`
+   */
+  auto Xor(const BitVector& other) noexcept -> BitVector& { return Apply<std::bit_xor<>>(other); }
+
+  auto operator&=(const BitVector& other) noexcept -> BitVector& { return And(other); }
+
+  auto operator|=(const BitVector& other) noexcept -> BitVector& { return Or(other); }
+
+  auto operator^=(const BitVector& other) noexcept -> BitVector& { return Xor(other); }
+
+  auto Swap(BitVector& other) noexcept -> void {
+    words_.Swap(other.words_);
+    std::swap(size_, other.size_);
+  }
+
+  [[nodiscard]] friend auto operator==(
+    const BitVector& lhs,  //
+    const BitVector& rhs
+  ) noexcept -> bool {
+    return lhs.size_ == rhs.size_ && Equal(lhs.words_, rhs.words_);
+  }
+
+ private:
+  [[nodiscard]] static constexpr auto WordCount(SizeType bits) noexcept -> SizeType {
+    return (bits + kWordBits - 1) / kWordBits;
+  }
+
+  auto ClearUnusedBits() noexcept -> void {
+    if (size_ % kWordBits != 0) {
+      words_.Back() &= ~(~WordType{} << (size_ % kWordBits));
+    }
+  }
+
+  [[nodiscard]] auto FindFromWord(SizeType word_index) const noexcept -> SizeType {
+    const SizeType word_count{words_.Size()};
+    for (; word_index < word_count; ++word_index) {
+      if (const WordType word{words_[word_index]}; word != 0) {
+        return word_index * kWordBits + static_cast<SizeType>(std::countr_zero(word));
+      }
+    }
+    return size_;
+  }
+
+  template<typename Op>
+  auto Apply(const BitVector& other) noexcept -> BitVector& {
+    assert(other.size_ == size_);
+    detail::SimdTransformWords<Op>(words_.Data(), other.words_.Data(), words_.Size());
+    return *this;
+  }
+
+  WordVector words_;
+  SizeType size_{};
+};
+
+namespace pmr {
+
+/**
+ * @brief `BitVector` allocating its words from a `std::pmr::memory_resource`.
+ */
+template<IsGrowthPolicy GrowthPolicy = OneAndHalfGrowth>
+using BitVector = lab::BitVector<std::pmr::polymorphic_allocator<bool>, GrowthPolicy>;
+
+}  // namespace pmr
+
+}  // namespace lab
+
+END_EXPORT_SECTION
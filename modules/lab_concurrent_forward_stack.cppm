@@ -0,0 +1,577 @@
+module;
+
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+#include <utility>
+
+export module lab_concurrent_forward_stack;
+
+/**
+ * @brief Concept for type validation
+ * @internal
+ * @concept IsValidConcurrentForwardStackType
+ */
+template<typename T>
+concept IsValidConcurrentForwardStackType = std::move_constructible<T> && std::destructible<T>;
+
+/**
+ * @brief Concept for allocator validation
+ * @internal
+ * @concept IsValidConcurrentForwardStackAllocatorType
+ */
+template<typename Allocator, typename T>
+concept IsValidConcurrentForwardStackAllocatorType =
+  IsValidConcurrentForwardStackType<typename std::allocator_traits<Allocator>::value_type> &&
+  std::same_as<typename std::allocator_traits<Allocator>::value_type, T>;
+
+/**
+ * @brief Internal node type for concurrent stack
+ * @internal
+ * @struct
+ *
+ * @tparam T Value type to store in node
+ *
+ * @details `next_` is atomic because a losing `PopFront` may read it while the node is recycled by another thread,
+ * `value_` is only touched by the thread owning the node.
+ */
+template<typename T>
+struct [[nodiscard]] ConcurrentForwardStackNode final {
+  constexpr ConcurrentForwardStackNode() noexcept { }
+
+  constexpr ~ConcurrentForwardStackNode() { }
+
+  std::atomic<ConcurrentForwardStackNode*> next_{nullptr};
+
+  union {
+    T value_;
+  };
+};
+
+/**
+ * @brief Node pointer paired with a modification counter, compared and swapped as one double-width word
+ * @internal
+ * @class
+ *
+ * @tparam Node Node type
+ *
+ * @details The pointer keeps all of its bits, so nothing is assumed about the virtual address width (5-level paging,
+ * AArch64 top byte tags). Every successful CAS increments the counter, so a stale head with the same address fails
+ * to compare equal (ABA). A false match would need the counter to wrap between the load and the CAS of one thread:
+ * 2^64 operations on 64-bit targets, 2^32 on 32-bit ones.
+ */
+template<typename Node>
+class alignas(2 * sizeof(void*)) TaggedNodePointer final {
+ public:
+  constexpr TaggedNodePointer() noexcept = default;
+
+  constexpr TaggedNodePointer(Node* pointer, std::uintptr_t tag) noexcept
+    : pointer_{pointer}  //
+    , tag_{tag} { }
+
+  [[nodiscard]] constexpr auto Pointer() const noexcept -> Node* { return pointer_; }
+
+  [[nodiscard]] constexpr auto Tag() const noexcept -> std::uintptr_t { return tag_; }
+
+  /**
+   * @brief Returns tagged `pointer` with the next counter value.
+   */
+  [[nodiscard]] constexpr auto Next(Node* pointer) const noexcept -> TaggedNodePointer { return {pointer, tag_ + 1}; }
+
+  [[nodiscard]] friend constexpr auto operator==(TaggedNodePointer, TaggedNodePointer) noexcept -> bool = default;
+
+ private:
+  Node* pointer_{nullptr};
+  std::uintptr_t tag_{};
+};
+
+/**
+ * @brief Whether `std::atomic<Tagged>` is a lock-free double-width CAS
+ * @internal
+ *
+ * @details GCC never reports 16-byte atomics as always lock-free: it calls libatomic, which uses `cmpxchg16b` (or
+ * `casp`) when the target has it, as announced by `__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16` (`-mcx16` on x86-64).
+ */
+template<typename Tagged>
+inline constexpr bool kIsTaggedPointerLockFree{
+  std::atomic<Tagged>::is_always_lock_free
+#if defined(__GNUC__) && !defined(__clang__) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+  || sizeof(Tagged) == 16
+#endif
+};
+
+/**
+ * @brief Treiber stack of nodes with tagged head
+ * @internal
+ * @class
+ *
+ * @tparam Node Node type
+ */
+template<typename Node>
+class TaggedNodeStack final {
+  using Tagged = TaggedNodePointer<Node>;
+
+ public:
+  /**
+   * @brief Links chain [`first`, `last`] (already linked through `next_`) in one CAS.
+   */
+  auto PushChain(Node* first, Node* last) noexcept -> void {
+    assert(first && last);
+    Tagged head{head_.load(std::memory_order_relaxed)};
+    do {
+      last->next_.store(head.Pointer(), std::memory_order_relaxed);
+    } while (!head_.compare_exchange_weak(head, head.Next(first), std::memory_order_release, std::memory_order_relaxed)
+    );
+  }
+
+  auto Push(Node* node) noexcept -> void { PushChain(node, node); }
+
+  /**
+   * @brief Unlinks the top node or returns `nullptr` if the stack is empty.
+   *
+   * @details The node memory stays valid while the owning container lives (nodes are recycled, never freed), so
+   * reading `next_` of a node concurrently popped by another thread is benign, the CAS fails on the tag.
+   */
+  [[nodiscard]] auto Pop() noexcept -> Node* {
+    Tagged head{head_.load(std::memory_order_acquire)};
+    while (Node* node{head.Pointer()}) {
+      Node* next{node->next_.load(std::memory_order_relaxed)};
+      if (head_.compare_exchange_weak(head, head.Next(next), std::memory_order_acquire, std::memory_order_acquire)) {
+        return node;
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief Detaches the whole chain in one atomic operation.
+   */
+  [[nodiscard]] auto TakeAll() noexcept -> Node* {
+    Tagged head{head_.load(std::memory_order_relaxed)};
+    while (head.Pointer() &&
+           !head_.compare_exchange_weak(head, head.Next(nullptr), std::memory_order_acquire, std::memory_order_relaxed)
+    ) { }
+    return head.Pointer();
+  }
+
+  [[nodiscard]] auto Empty() const noexcept -> bool { return !head_.load(std::memory_order_relaxed).Pointer(); }
+
+ private:
+  static_assert(sizeof(Tagged) == 2 * sizeof(void*), "TaggedNodeStack: the CAS compares padding-free words");
+  static_assert(
+    kIsTaggedPointerLockFree<Tagged>,
+    "TaggedNodeStack: a lock-free double-width CAS is required (build with -mcx16 on x86-64)"
+  );
+
+  std::atomic<Tagged> head_{};
+};
+
+/**
+ * @brief Iterator for detached chains of ConcurrentForwardStack
+ * @internal
+ * @class
+ *
+ * @tparam IsConst Boolean value for const iterator check
+ * @tparam Batch Batch class type for traversing
+ */
+template<bool IsConst, typename Batch>
+class ConcurrentForwardStackIteratorBase final {
+  friend Batch;
+  friend ConcurrentForwardStackIteratorBase<!IsConst, Batch>;
+  using NodePointer = Batch::NodePointer;
+
+ public:
+  using ValueType = Batch::ValueType;
+  using value_type = Batch::ValueType;
+  using Reference = std::conditional_t<IsConst, const ValueType&, ValueType&>;
+  using reference = Reference;
+  using Pointer = std::conditional_t<IsConst, const ValueType*, ValueType*>;
+  using pointer = Pointer;
+  using DifferenceType = std::ptrdiff_t;
+  using difference_type = std::ptrdiff_t;
+  using IteratorCategory = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+
+  constexpr ConcurrentForwardStackIteratorBase() noexcept = default;
+
+ private:
+  constexpr ConcurrentForwardStackIteratorBase(NodePointer node) noexcept : current_{node} { }
+
+ public:
+  constexpr ConcurrentForwardStackIteratorBase(const ConcurrentForwardStackIteratorBase<!IsConst, Batch> other
+  ) noexcept
+    : current_{other.current_} { }
+
+  auto operator*() const noexcept -> Reference {
+    assert(current_);
+    return current_->value_;
+  }
+
+  auto operator->() const noexcept -> Pointer {
+    assert(current_);
+    return &current_->value_;
+  }
+
+  auto operator++() noexcept -> ConcurrentForwardStackIteratorBase& {
+    assert(current_);
+    current_ = current_->next_.load(std::memory_order_relaxed);
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> ConcurrentForwardStackIteratorBase {
+    auto temp{*this};
+    ++*this;
+    return temp;
+  }
+
+  [[nodiscard]] friend constexpr auto operator==(
+    const ConcurrentForwardStackIteratorBase lhs,  //
+    const ConcurrentForwardStackIteratorBase rhs
+  ) noexcept -> bool {
+    return lhs.current_ == rhs.current_;
+  }
+
+ private:
+  NodePointer current_{nullptr};
+};
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab::containers
+ */
+namespace lab::containers {
+
+/**
+ * @brief Lock-free multi-producer/multi-consumer stack (Treiber stack)
+ * @class
+ *
+ * @tparam T Value type to store in container
+ * @tparam Allocator Allocator type to use in container, must be thread-safe
+ *
+ * @details Singly-linked layout of `ForwardList` with an atomic tagged head. Popped nodes are recycled through an
+ * internal lock-free free list and only returned to the allocator on destruction, which keeps concurrent reads of
+ * `next_` memory safe without hazard pointers. The head pairs the pointer with a full-width counter updated by a
+ * double-width CAS, which rules out ABA short of the counter wrapping around.
+ *
+ * @note Destruction, like construction, must not race with other operations.
+ */
+template<
+  IsValidConcurrentForwardStackType T,
+  IsValidConcurrentForwardStackAllocatorType<T> Allocator = std::allocator<T>>
+class [[nodiscard]] ConcurrentForwardStack {
+  using Node = ConcurrentForwardStackNode<T>;
+  using InternalAllocatorType = std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using AllocatorTraits = std::allocator_traits<InternalAllocatorType>;
+  using NodePointer = Node*;
+
+ public:
+  using ValueType = T;
+  using value_type = T;
+  using Reference = ValueType&;
+  using reference = value_type&;
+  using ConstReference = const ValueType&;
+  using const_reference = const value_type&;
+  using AllocatorType = InternalAllocatorType;
+  using allocator_type = InternalAllocatorType;
+  using SizeType = AllocatorTraits::size_type;
+  using size_type = AllocatorTraits::size_type;
+
+  /**
+   * @brief Single-threaded chain detached by `TakeAll`, most recently pushed element first.
+   * @class
+   *
+   * @details Elements are destroyed and nodes are handed back to the stack free list on destruction, the batch must
+   * not outlive the stack.
+   */
+  class [[nodiscard]] Batch {
+    friend ConcurrentForwardStack;
+    friend ConcurrentForwardStackIteratorBase<true, Batch>;
+    friend ConcurrentForwardStackIteratorBase<false, Batch>;
+    using NodePointer = Node*;
+
+   public:
+    using ValueType = T;
+    using value_type = T;
+    using Iterator = ConcurrentForwardStackIteratorBase<false, Batch>;
+    using iterator = Iterator;
+    using ConstIterator = ConcurrentForwardStackIteratorBase<true, Batch>;
+    using const_iterator = ConstIterator;
+
+    Batch(const Batch&) = delete;
+
+    auto operator=(const Batch&) -> Batch& = delete;
+
+    Batch(Batch&& other) noexcept
+      : owner_{other.owner_}  //
+      , head_{std::exchange(other.head_, nullptr)} { }
+
+    auto operator=(Batch&& other) noexcept -> Batch& {
+      assert(this != &other);
+      Clear();
+      owner_ = other.owner_;
+      head_ = std::exchange(other.head_, nullptr);
+      return *this;
+    }
+
+    ~Batch() { Clear(); }
+
+    [[nodiscard]] auto begin() noexcept -> Iterator { return {head_}; }
+
+    [[nodiscard]] auto end() noexcept -> Iterator { return {}; }
+
+    [[nodiscard]] auto begin() const noexcept -> ConstIterator { return {head_}; }
+
+    [[nodiscard]] auto end() const noexcept -> ConstIterator { return {}; }
+
+    [[nodiscard]] auto Empty() const noexcept -> bool { return !head_; }
+
+    /**
+     * @brief Moves out the first element of the batch.
+     * @public
+     *
+     * @throws Propagates exception thrown by move constructor of `T`, the batch is left unchanged.
+     */
+    [[nodiscard]] auto PopFront() -> T {
+      assert(head_);
+      T value{std::move(head_->value_)};
+      NodePointer node{std::exchange(head_, head_->next_.load(std::memory_order_relaxed))};
+      owner_->RecycleNode(node);
+      return value;
+    }
+
+    /**
+     * @brief Reverses the batch into push (FIFO) order.
+     * @public
+     *
+     * @throws None (no-throw guarantee).
+     */
+    auto Reverse() noexcept -> void {
+      NodePointer reversed{nullptr};
+      while (head_) {
+        NodePointer next{head_->next_.load(std::memory_order_relaxed)};
+        head_->next_.store(reversed, std::memory_order_relaxed);
+        reversed = std::exchange(head_, next);
+      }
+      head_ = reversed;
+    }
+
+    /**
+     * @brief Destroys elements and recycles the whole chain with one CAS.
+     * @public
+     *
+     * @throws None (no-throw guarantee).
+     */
+    auto Clear() noexcept -> void {
+      if (!head_) {
+        return;
+      }
+      NodePointer tail{head_};
+      for (NodePointer node{head_}; node; node = node->next_.load(std::memory_order_relaxed)) {
+        owner_->DestroyValue(node);
+        tail = node;
+      }
+      owner_->free_nodes_.PushChain(std::exchange(head_, nullptr), tail);
+    }
+
+   private:
+    Batch(ConcurrentForwardStack* owner, NodePointer head) noexcept
+      : owner_{owner}  //
+      , head_{head} { }
+
+    ConcurrentForwardStack* owner_;
+    NodePointer head_;
+  };
+
+  /**
+   * @brief Default constructor for `ConcurrentForwardStack`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  ConcurrentForwardStack() noexcept = default;
+
+  /**
+   * @brief Constructs `ConcurrentForwardStack` with allocator.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  explicit ConcurrentForwardStack(const Allocator& allocator) noexcept : allocator_{allocator} { }
+
+  ConcurrentForwardStack(const ConcurrentForwardStack&) = delete;
+
+  auto operator=(const ConcurrentForwardStack&) -> ConcurrentForwardStack& = delete;
+
+  /**
+   * @brief Destructor for `ConcurrentForwardStack`.
+   * @public
+   *
+   * @details Destroys remaining elements and returns every node (including recycled ones) to the allocator.
+   */
+  ~ConcurrentForwardStack() {
+    for (NodePointer node{nodes_.TakeAll()}; node;) {
+      DestroyValue(node);
+      DeallocateNode(std::exchange(node, node->next_.load(std::memory_order_relaxed)));
+    }
+    for (NodePointer node{free_nodes_.TakeAll()}; node;) {
+      DeallocateNode(std::exchange(node, node->next_.load(std::memory_order_relaxed)));
+    }
+  }
+
+  /**
+   * @brief Provides the ability to check underlying container state.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @details The result is a snapshot and may be outdated as soon as it is returned.
+   */
+  [[nodiscard]] auto Empty() const noexcept -> bool { return nodes_.Empty(); }
+
+  [[nodiscard]] auto GetAllocator() const noexcept -> AllocatorType { return allocator_; }
+
+  /**
+   * @brief Constructs the object at the top of the stack with `args`, lock-free.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  auto EmplaceFront(auto&&... args) -> void {
+    NodePointer node{ConstructNode(std::forward<decltype(args)>(args)...)};
+    nodes_.Push(node);
+  }
+
+  /**
+   * @brief Copy constructs the element at the top of the stack, lock-free.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  auto PushFront(const ValueType& value) -> void { EmplaceFront(value); }
+
+  /**
+   * @brief Move constructs the element at the top of the stack, lock-free.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  auto PushFront(ValueType&& value) -> void { EmplaceFront(std::move(value)); }
+
+  /**
+   * @brief Pushes every element of `range` with one CAS, the last element of `range` ends up on top.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception,
+   * nothing is pushed in that case.
+   *
+   * @details The chain is built privately and published at once, so other threads never observe a partial range.
+   */
+  template<std::ranges::input_range R>
+  auto PushFrontRange(R&& range) -> void {
+    NodePointer first{nullptr};
+    NodePointer last{nullptr};
+    LAB_TRY {
+      for (auto&& value : range) {
+        NodePointer node{ConstructNode(std::forward<decltype(value)>(value))};
+        node->next_.store(first, std::memory_order_relaxed);
+        first = node;
+        if (!last) {
+          last = node;
+        }
+      }
+    }
+    LAB_CATCH(...) {
+      if (first) {
+        Batch{this, first}.Clear();
+      }
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    if (first) {
+      nodes_.PushChain(first, last);
+    }
+  }
+
+  /**
+   * @brief Pops the element from the top of the stack, lock-free.
+   * @public
+   *
+   * @throws Propagates exception thrown by move constructor of `T`, the element is pushed back in that case.
+   *
+   * @return `std::optional<T>` with the popped element or `std::nullopt` if the stack was empty.
+   */
+  [[nodiscard]] auto PopFront() -> std::optional<T> {
+    NodePointer node{nodes_.Pop()};
+    if (!node) {
+      return std::nullopt;
+    }
+    std::optional<T> result;
+    LAB_TRY { result.emplace(std::move(node->value_)); }
+    LAB_CATCH(...) {
+      nodes_.Push(node);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    RecycleNode(node);
+    return result;
+  }
+
+  /**
+   * @brief Detaches every element with one atomic operation.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Batch` owning the detached elements (last pushed first).
+   */
+  [[nodiscard]] auto TakeAll() noexcept -> Batch { return Batch{this, nodes_.TakeAll()}; }
+
+ private:
+  auto ConstructNode(auto&&... args) -> NodePointer {
+    NodePointer node{free_nodes_.Pop()};
+    if (!node) {
+      node = AllocatorTraits::allocate(allocator_, 1);
+      std::construct_at(node);
+    }
+    LAB_TRY { AllocatorTraits::construct(allocator_, &node->value_, std::forward<decltype(args)>(args)...); }
+    LAB_CATCH(...) {
+      free_nodes_.Push(node);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    return node;
+  }
+
+  auto DestroyValue(NodePointer node) noexcept -> void {
+    if constexpr (!std::is_trivially_destructible_v<ValueType>) {
+      AllocatorTraits::destroy(allocator_, &node->value_);
+    }
+  }
+
+  auto RecycleNode(NodePointer node) noexcept -> void {
+    DestroyValue(node);
+    free_nodes_.Push(node);
+  }
+
+  auto DeallocateNode(NodePointer node) noexcept -> void {
+    std::destroy_at(node);
+    AllocatorTraits::deallocate(allocator_, node, 1);
+  }
+
+  TaggedNodeStack<Node> nodes_;
+  TaggedNodeStack<Node> free_nodes_;
+  [[no_unique_address]] AllocatorType allocator_;
+};
+
+}  // namespace lab::containers
+
+END_EXPORT_SECTION
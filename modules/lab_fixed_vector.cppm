@@ -0,0 +1,496 @@
+module;
+
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+#include <utility>
+
+export module lab_fixed_vector;
+
+import lab_vector_base;
+
+/**
+ * @brief Element storage of FixedVector for trivially copyable, trivially default constructible `T`
+ * @internal
+ *
+ * @details A plain array, so the container is trivially copyable and every operation is a constant expression.
+ */
+template<typename T, std::size_t kCapacity, bool IsTrivial>
+struct FixedVectorStorage {
+  T values[kCapacity ? kCapacity : 1];
+};
+
+/**
+ * @brief Element storage of FixedVector for other `T`
+ * @internal
+ *
+ * @details Elements are constructed into the inactive union member, which defers construction to `FixedVector`.
+ */
+template<typename T, std::size_t kCapacity>
+struct FixedVectorStorage<T, kCapacity, false> {
+  constexpr FixedVectorStorage() noexcept { }
+
+  FixedVectorStorage(const FixedVectorStorage&) = delete;
+  auto operator=(const FixedVectorStorage&) -> FixedVectorStorage& = delete;
+
+  constexpr ~FixedVectorStorage() { }
+
+  union {
+    T values[kCapacity ? kCapacity : 1];
+  };
+};
+
+/**
+ * @brief Smallest unsigned type counting up to `kCapacity`.
+ * @internal
+ */
+template<std::size_t kCapacity>
+using FixedVectorSizeStorage = std::conditional_t<
+  kCapacity <= std::numeric_limits<std::uint8_t>::max(),
+  std::uint8_t,
+  std::conditional_t<
+    kCapacity <= std::numeric_limits<std::uint16_t>::max(),
+    std::uint16_t,
+    std::conditional_t<kCapacity <= std::numeric_limits<std::uint32_t>::max(), std::uint32_t, std::size_t>>>;
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Dynamic array with a fixed capacity of `N` elements stored inline, `std::inplace_vector`-style.
+ * @class
+ *
+ * @tparam T Value type to store in container
+ * @tparam N Maximal number of elements
+ *
+ * @details Never allocates. For trivially copyable, trivially default constructible `T` the container itself is
+ * trivially copyable and fully usable in constant expressions, so lookup tables computed at compile time can be kept
+ * in `constexpr` variables without static initialization at startup. Other `T` live in a union and are constructed
+ * in place, which constant evaluation accepts from C++26 on (GCC already does). The element count is stored in the
+ * smallest unsigned type that holds `N`.
+ *
+ * @note Growing past `N` throws `std::length_error`, the `Try...` members report it instead.
+ */
+template<typename T, std::size_t N>
+class [[nodiscard]] FixedVector {
+  static constexpr bool kIsTrivial{std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T>};
+  using SizeStorage = FixedVectorSizeStorage<N>;
+
+ public:
+  using ValueType = T;
+  using value_type = T;
+  using Reference = T&;
+  using reference = T&;
+  using ConstReference = const T&;
+  using const_reference = const T&;
+  using Pointer = T*;
+  using pointer = T*;
+  using ConstPointer = const T*;
+  using const_pointer = const T*;
+  using DifferenceType = std::ptrdiff_t;
+  using difference_type = std::ptrdiff_t;
+  using SizeType = std::size_t;
+  using size_type = std::size_t;
+  using Iterator = Pointer;
+  using iterator = pointer;
+  using ConstIterator = ConstPointer;
+  using const_iterator = const_pointer;
+  using ReverseIterator = std::reverse_iterator<Iterator>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_pointer>;
+
+  /**
+   * @brief Default constructor, constant evaluation also value-initializes the unused trivial slots.
+   * @public
+   *
+   * @details Constant expressions may not hold indeterminate values, which the defaulted copy of the whole array
+   * would read otherwise. At run time the slots are left untouched.
+   */
+  constexpr FixedVector() noexcept {
+    if constexpr (kIsTrivial) {
+      if consteval {
+        std::ranges::fill(storage_.values, T{});
+      }
+    }
+  }
+
+  explicit constexpr FixedVector(SizeType n)
+    : FixedVector{} {
+    CapacityCheck(n);
+    for (; size_ < n; ++size_) {
+      std::construct_at(Data() + size_);
+    }
+  }
+
+  constexpr FixedVector(
+    SizeType n,  //
+    const ValueType& value
+  )
+    : FixedVector{} {
+    CapacityCheck(n);
+    for (; size_ < n; ++size_) {
+      std::construct_at(Data() + size_, value);
+    }
+  }
+
+  template<std::input_iterator InputIterator, std::sentinel_for<InputIterator> Sentinel>
+  constexpr FixedVector(
+    InputIterator first,  //
+    Sentinel last
+  )
+    : FixedVector{} {
+    AppendRange(std::ranges::subrange{std::move(first), std::move(last)});
+  }
+
+  constexpr FixedVector(std::initializer_list<ValueType> values)
+    : FixedVector{values.begin(), values.end()} { }
+
+  FixedVector(const FixedVector&)
+    requires(kIsTrivial)
+  = default;
+
+  constexpr FixedVector(const FixedVector& other)
+    : FixedVector{} {
+    AppendRange(other);
+  }
+
+  FixedVector(FixedVector&&)
+    requires(kIsTrivial)
+  = default;
+
+  /**
+   * @brief Move constructor, moves the elements one by one and leaves them moved-from in `other`.
+   * @public
+   */
+  constexpr FixedVector(FixedVector&& other) noexcept(std::is_nothrow_move_constructible_v<ValueType>)
+    : FixedVector{} {
+    AppendRange(std::ranges::subrange{std::make_move_iterator(other.begin()), std::make_move_iterator(other.end())});
+  }
+
+  auto operator=(const FixedVector&) -> FixedVector&
+    requires(kIsTrivial)
+  = default;
+
+  constexpr auto operator=(const FixedVector& other) -> FixedVector& {
+    if (this != &other) {
+      AssignFrom(other.begin(), other.Size());
+    }
+    return *this;
+  }
+
+  auto operator=(FixedVector&&) -> FixedVector&
+    requires(kIsTrivial)
+  = default;
+
+  constexpr auto operator=(FixedVector&& other) noexcept(
+    std::is_nothrow_move_constructible_v<ValueType> && std::is_nothrow_move_assignable_v<ValueType>
+  ) -> FixedVector& {
+    if (this != &other) {
+      AssignFrom(std::make_move_iterator(other.begin()), other.Size());
+    }
+    return *this;
+  }
+
+  ~FixedVector()
+    requires(std::is_trivially_destructible_v<ValueType>)
+  = default;
+
+  constexpr ~FixedVector() { Clear(); }
+
+  [[nodiscard]] constexpr auto begin() noexcept -> Iterator { return Data(); }
+
+  [[nodiscard]] constexpr auto end() noexcept -> Iterator { return Data() + size_; }
+
+  [[nodiscard]] constexpr auto begin() const noexcept -> ConstIterator { return Data(); }
+
+  [[nodiscard]] constexpr auto end() const noexcept -> ConstIterator { return Data() + size_; }
+
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> ConstIterator { return begin(); }
+
+  [[nodiscard]] constexpr auto cend() const noexcept -> ConstIterator { return end(); }
+
+  [[nodiscard]] constexpr auto rbegin() noexcept -> ReverseIterator { return ReverseIterator{end()}; }
+
+  [[nodiscard]] constexpr auto rend() noexcept -> ReverseIterator { return ReverseIterator{begin()}; }
+
+  [[nodiscard]] constexpr auto crbegin() const noexcept -> ConstReverseIterator {
+    return ConstReverseIterator{cend()};
+  }
+
+  [[nodiscard]] constexpr auto crend() const noexcept -> ConstReverseIterator {
+    return ConstReverseIterator{cbegin()};
+  }
+
+  [[nodiscard]] constexpr auto Size() const noexcept -> SizeType { return size_; }
+
+  [[nodiscard]] static constexpr auto Capacity() noexcept -> SizeType { return N; }
+
+  [[nodiscard]] static constexpr auto MaxSize() noexcept -> SizeType { return N; }
+
+  [[nodiscard]] constexpr auto Empty() const noexcept -> bool { return size_ == 0; }
+
+  [[nodiscard]] constexpr auto Full() const noexcept -> bool { return size_ == N; }
+
+  [[nodiscard]] constexpr auto Data() noexcept -> Pointer { return storage_.values; }
+
+  [[nodiscard]] constexpr auto Data() const noexcept -> ConstPointer { return storage_.values; }
+
+  [[nodiscard]] constexpr auto operator[](SizeType index) noexcept -> Reference { return Data()[index]; }
+
+  [[nodiscard]] constexpr auto operator[](SizeType index) const noexcept -> ConstReference { return Data()[index]; }
+
+ private:
+  constexpr auto RangeCheck(SizeType index) const -> void {
+    if (index >= Size()) {
+      throw std::out_of_range{
+        std::format("FixedVector::RangeCheck: index (which is {}) >= this->size() (which is {})", index, Size())
+      };
+    }
+  }
+
+  static constexpr auto CapacityCheck(SizeType size) -> void {
+    if (size > N) {
+      throw std::length_error{
+        std::format("FixedVector::CapacityCheck: size (which is {}) > this->capacity() (which is {})", size, N)
+      };
+    }
+  }
+
+ public:
+  [[nodiscard]] constexpr auto At(SizeType index) -> Reference {
+    RangeCheck(index);
+    return Data()[index];
+  }
+
+  [[nodiscard]] constexpr auto At(SizeType index) const -> ConstReference {
+    RangeCheck(index);
+    return Data()[index];
+  }
+
+  [[nodiscard]] constexpr auto Front() noexcept -> Reference { return Data()[0]; }
+
+  [[nodiscard]] constexpr auto Front() const noexcept -> ConstReference { return Data()[0]; }
+
+  [[nodiscard]] constexpr auto Back() noexcept -> Reference { return Data()[size_ - 1]; }
+
+  [[nodiscard]] constexpr auto Back() const noexcept -> ConstReference { return Data()[size_ - 1]; }
+
+  /**
+   * @brief Constructs an element at the end.
+   * @public
+   *
+   * @throws `std::length_error` if the container is full or propagates user defined exception.
+   */
+  template<typename... Args>
+  constexpr auto EmplaceBack(Args&&... args) -> Reference {
+    CapacityCheck(size_ + SizeType{1});
+    return UncheckedEmplaceBack(std::forward<Args>(args)...);
+  }
+
+  constexpr auto PushBack(const ValueType& value) -> Reference { return EmplaceBack(value); }
+
+  constexpr auto PushBack(ValueType&& value) -> Reference { return EmplaceBack(std::move(value)); }
+
+  /**
+   * @brief Constructs an element at the end if there is room left.
+   * @public
+   *
+   * @throws Propagates user defined exception.
+   *
+   * @return `false` and leaves `args` untouched if the container is full.
+   */
+  template<typename... Args>
+  constexpr auto TryEmplaceBack(Args&&... args) -> bool {
+    if (Full()) {
+      return false;
+    }
+    UncheckedEmplaceBack(std::forward<Args>(args)...);
+    return true;
+  }
+
+  constexpr auto TryPushBack(const ValueType& value) -> bool { return TryEmplaceBack(value); }
+
+  constexpr auto TryPushBack(ValueType&& value) -> bool { return TryEmplaceBack(std::move(value)); }
+
+  /**
+   * @brief Constructs an element at the end without checking the capacity.
+   * @public
+   *
+   * @warning **Undefined Behaviour** if:
+   * - the container is full
+   */
+  template<typename... Args>
+  constexpr auto UncheckedEmplaceBack(Args&&... args) -> Reference {
+    assert(!Full());
+    Pointer element{std::construct_at(Data() + size_, std::forward<Args>(args)...)};
+    ++size_;
+    return *element;
+  }
+
+  /**
+   * @brief Appends the elements of `range`.
+   * @public
+   *
+   * @throws `std::length_error` if the elements do not fit or propagates user defined exception.
+   *
+   * @details Sized and forward ranges are checked up front and leave the container unchanged on overflow, other
+   * input ranges keep the elements appended before the overflow.
+   */
+  template<std::ranges::input_range Range>
+    requires std::constructible_from<ValueType, std::ranges::range_reference_t<Range>>
+  constexpr auto AppendRange(Range&& range) -> void {
+    if constexpr (std::ranges::forward_range<Range> || std::ranges::sized_range<Range>) {
+      CapacityCheck(size_ + static_cast<SizeType>(std::ranges::distance(range)));
+      for (auto&& value : range) {
+        UncheckedEmplaceBack(std::forward<decltype(value)>(value));
+      }
+    } else {
+      for (auto&& value : range) {
+        EmplaceBack(std::forward<decltype(value)>(value));
+      }
+    }
+  }
+
+  /**
+   * @brief Removes the last element.
+   * @public
+   *
+   * @warning **Undefined Behaviour** if:
+   * - the container is empty
+   */
+  constexpr auto PopBack() noexcept -> void {
+    assert(!Empty());
+    --size_;
+    std::destroy_at(Data() + size_);
+  }
+
+  constexpr auto Clear() noexcept -> void {
+    std::destroy(begin(), end());
+    size_ = 0;
+  }
+
+  /**
+   * @brief Resizes to `new_size` elements, new elements are value-initialized.
+   * @public
+   *
+   * @throws `std::length_error` if `new_size > Capacity()` or propagates user defined exception.
+   */
+  constexpr auto Resize(SizeType new_size) -> void {
+    CapacityCheck(new_size);
+    EraseAtEnd(std::min(new_size, Size()));
+    while (size_ < new_size) {
+      UncheckedEmplaceBack();
+    }
+  }
+
+  constexpr auto Resize(
+    SizeType new_size,  //
+    const ValueType& value
+  ) -> void {
+    CapacityCheck(new_size);
+    EraseAtEnd(std::min(new_size, Size()));
+    while (size_ < new_size) {
+      UncheckedEmplaceBack(value);
+    }
+  }
+
+  constexpr auto Erase(ConstIterator position) noexcept(std::is_nothrow_move_assignable_v<ValueType>) -> Iterator {
+    return Erase(position, position + 1);
+  }
+
+  /**
+   * @brief Erases [`first`, `last`) and closes the gap by move assignment.
+   * @public
+   *
+   * @return `Iterator` following the last erased element.
+   */
+  constexpr auto Erase(
+    ConstIterator first,  //
+    ConstIterator last
+  ) noexcept(std::is_nothrow_move_assignable_v<ValueType>) -> Iterator {
+    const Iterator gap{begin() + (first - cbegin())};
+    EraseAtEnd(static_cast<SizeType>(std::move(begin() + (last - cbegin()), end(), gap) - begin()));
+    return gap;
+  }
+
+  constexpr auto Swap(FixedVector& other) noexcept(std::is_nothrow_swappable_v<ValueType> &&
+                                                   std::is_nothrow_move_constructible_v<ValueType>) -> void {
+    FixedVector& shorter{size_ <= other.size_ ? *this : other};
+    FixedVector& longer{size_ <= other.size_ ? other : *this};
+    const SizeType common{shorter.size_};
+    std::ranges::swap_ranges(shorter.begin(), shorter.end(), longer.begin(), longer.begin() + common);
+    shorter.AppendRange(
+      std::ranges::subrange{std::make_move_iterator(longer.begin() + common), std::make_move_iterator(longer.end())}
+    );
+    longer.EraseAtEnd(common);
+  }
+
+  [[nodiscard]] friend constexpr auto operator==(
+    const FixedVector& lhs,  //
+    const FixedVector& rhs
+  ) -> bool {
+    return std::ranges::equal(lhs, rhs);
+  }
+
+  [[nodiscard]] friend constexpr auto operator<=>(
+    const FixedVector& lhs,  //
+    const FixedVector& rhs
+  ) {
+    return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+ private:
+  constexpr auto EraseAtEnd(SizeType new_size) noexcept -> void {
+    std::destroy(begin() + new_size, end());
+    size_ = static_cast<SizeStorage>(new_size);
+  }
+
+  /**
+   * @brief Assigns `count` elements read from `source`, reusing the live elements.
+   */
+  template<std::input_iterator InputIterator>
+  constexpr auto AssignFrom(
+    InputIterator source,  //
+    SizeType count
+  ) -> void {
+    const SizeType common{std::min(count, Size())};
+    for (SizeType i{}; i < common; ++i, ++source) {
+      Data()[i] = *source;
+    }
+    EraseAtEnd(common);
+    for (SizeType i{common}; i < count; ++i, ++source) {
+      UncheckedEmplaceBack(*source);
+    }
+  }
+
+  FixedVectorStorage<ValueType, N, kIsTrivial> storage_;
+  SizeStorage size_{};
+};
+
+/**
+ * @brief Inline storage has no self references, so a `FixedVector` relocates like its elements.
+ */
+template<typename T, std::size_t N>
+struct IsTriviallyRelocatable<FixedVector<T, N>> : std::bool_constant<kIsTriviallyRelocatable<T>> { };
+
+}  // namespace lab
+
+END_EXPORT_SECTION
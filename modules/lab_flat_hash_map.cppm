@@ -0,0 +1,1144 @@
+module;
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <stdexcept>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+  #include <emmintrin.h>
+  #define LAB_FLAT_HASH_MAP_SSE2 1
+#endif
+
+export module lab_flat_hash_map;
+
+import lab_vector;
+
+/**
+ * @brief Control byte of a slot that never held an element, stops lookups.
+ * @internal
+ */
+inline constexpr std::int8_t kFlatHashMapEmpty{-128};
+
+/**
+ * @brief Control byte of an erased slot (tombstone), lookups probe past it.
+ * @internal
+ */
+inline constexpr std::int8_t kFlatHashMapDeleted{-2};
+
+/**
+ * @brief Control byte past the last slot, stops iteration.
+ * @internal
+ */
+inline constexpr std::int8_t kFlatHashMapSentinel{-1};
+
+/**
+ * @brief Slots probed at once, the capacity is a power of two multiple of it.
+ * @internal
+ */
+inline constexpr std::size_t kFlatHashMapGroupWidth{16};
+
+/**
+ * @brief Spreads the entropy of weak hashes (e.g. the identity `std::hash<int>`) over all bits.
+ * @internal
+ */
+[[nodiscard]] constexpr auto FlatHashMapMix(std::size_t hash) noexcept -> std::size_t {
+#ifdef __SIZEOF_INT128__
+  const auto product{static_cast<unsigned __int128>(hash) * 0x9E37'79B9'7F4A'7C15ULL};
+  return static_cast<std::size_t>(product) ^ static_cast<std::size_t>(product >> 64);
+#else
+  hash ^= hash >> 33;
+  hash *= static_cast<std::size_t>(0xFF51'AFD7'ED55'8CCDULL);
+  return hash ^ (hash >> 33);
+#endif
+}
+
+/**
+ * @brief Low 7 bits of the hash, stored in the control byte of a full slot.
+ * @internal
+ */
+[[nodiscard]] constexpr auto FlatHashMapH2(std::size_t hash) noexcept -> std::int8_t {
+  return static_cast<std::int8_t>(hash & 0x7F);
+}
+
+/**
+ * @brief Sixteen control bytes compared at once, bit `i` of every mask refers to byte `i` of the group.
+ * @internal
+ * @class
+ *
+ * @details Uses SSE2 on x86, the scalar fallback is a loop the compiler is free to vectorize.
+ */
+class FlatHashMapGroup final {
+ public:
+  explicit FlatHashMapGroup(const std::int8_t* control) noexcept {
+#if LAB_FLAT_HASH_MAP_SSE2
+    control_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+#else
+    std::memcpy(control_, control, kFlatHashMapGroupWidth);
+#endif
+  }
+
+  [[nodiscard]] auto Match(std::int8_t h2) const noexcept -> std::uint32_t {
+#if LAB_FLAT_HASH_MAP_SSE2
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(control_, _mm_set1_epi8(h2))));
+#else
+    return MatchIf([h2](std::int8_t control) { return control == h2; });
+#endif
+  }
+
+  [[nodiscard]] auto MatchEmpty() const noexcept -> std::uint32_t {
+#if LAB_FLAT_HASH_MAP_SSE2
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(control_, _mm_set1_epi8(kFlatHashMapEmpty))));
+#else
+    return MatchIf([](std::int8_t control) { return control == kFlatHashMapEmpty; });
+#endif
+  }
+
+  /**
+   * @brief Empty and deleted control bytes are the only negative ones inside a group, so their sign bits suffice.
+   */
+  [[nodiscard]] auto MatchEmptyOrDeleted() const noexcept -> std::uint32_t {
+#if LAB_FLAT_HASH_MAP_SSE2
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(control_));
+#else
+    return MatchIf([](std::int8_t control) { return control < 0; });
+#endif
+  }
+
+ private:
+#if LAB_FLAT_HASH_MAP_SSE2
+  __m128i control_;
+#else
+  auto MatchIf(auto predicate) const noexcept -> std::uint32_t {
+    std::uint32_t mask{};
+    for (std::size_t i{}; i < kFlatHashMapGroupWidth; ++i) {
+      mask |= static_cast<std::uint32_t>(predicate(control_[i])) << i;
+    }
+    return mask;
+  }
+
+  std::int8_t control_[kFlatHashMapGroupWidth];
+#endif
+};
+
+/**
+ * @brief Triangular probing over groups, visits every group of a power of two table exactly once.
+ * @internal
+ * @class
+ */
+class FlatHashMapProbe final {
+ public:
+  FlatHashMapProbe(
+    std::size_t hash,  //
+    std::size_t capacity
+  ) noexcept
+    : mask_{capacity - 1}
+    , offset_{((hash >> 7) * kFlatHashMapGroupWidth) & mask_} { }
+
+  [[nodiscard]] auto Offset() const noexcept -> std::size_t { return offset_; }
+
+  auto Next() noexcept -> void {
+    index_ += kFlatHashMapGroupWidth;
+    offset_ = (offset_ + index_) & mask_;
+  }
+
+ private:
+  std::size_t mask_;
+  std::size_t offset_;
+  std::size_t index_{0};
+};
+
+/**
+ * @brief Raw storage of one slot, kept in a `lab::Vector` without being constructed.
+ * @internal
+ */
+template<typename Slot>
+struct FlatHashMapSlotStorage {
+  alignas(Slot) std::byte bytes[sizeof(Slot)];
+};
+
+/**
+ * @brief Exposes the `VectorBase` helpers for the slot type.
+ * @internal
+ */
+template<typename Slot, typename Allocator>
+struct FlatHashMapSlotOps final
+  : lab::detail::VectorBase<Slot, typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>> {
+  using Base = lab::detail::VectorBase<Slot, typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>>;
+  using typename Base::AllocatorTraits;
+  using typename Base::AllocatorType;
+  using Base::DestroyUsingAllocator;
+  using Base::UninitializedCopyUsingAllocator;
+  using Base::UninitializedRelocateUsingAllocator;
+};
+
+/**
+ * @brief Forward iterator over the full slots of a FlatHashMap
+ * @internal
+ * @class
+ *
+ * @tparam IsConst Boolean value for const iterator check
+ * @tparam Map FlatHashMap class type for traversing
+ *
+ * @details Walks the control bytes and stops at the sentinel that follows the last slot.
+ */
+template<bool IsConst, typename Map>
+class FlatHashMapIteratorBase final {
+  friend Map;
+  friend FlatHashMapIteratorBase<!IsConst, Map>;
+  using SlotPointer =
+    std::conditional_t<IsConst, const typename Map::SlotStorageType*, typename Map::SlotStorageType*>;
+
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using iterator_concept = std::forward_iterator_tag;
+  using value_type = Map::ValueType;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+  using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+  FlatHashMapIteratorBase() noexcept = default;
+
+  FlatHashMapIteratorBase(const FlatHashMapIteratorBase<!IsConst, Map>& other) noexcept
+    requires IsConst
+    : control_{other.control_}
+    , slot_{other.slot_} { }
+
+  [[nodiscard]] auto operator*() const noexcept -> reference { return *Map::ValuePointer(slot_); }
+
+  [[nodiscard]] auto operator->() const noexcept -> pointer { return Map::ValuePointer(slot_); }
+
+  auto operator++() noexcept -> FlatHashMapIteratorBase& {
+    ++control_;
+    ++slot_;
+    SkipFree();
+    return *this;
+  }
+
+  auto operator++(int) noexcept -> FlatHashMapIteratorBase {
+    FlatHashMapIteratorBase temp{*this};
+    ++*this;
+    return temp;
+  }
+
+  [[nodiscard]] friend auto operator==(
+    const FlatHashMapIteratorBase lhs,  //
+    const FlatHashMapIteratorBase rhs
+  ) noexcept -> bool {
+    return lhs.control_ == rhs.control_;
+  }
+
+ private:
+  FlatHashMapIteratorBase(
+    const std::int8_t* control,  //
+    SlotPointer slot
+  ) noexcept
+    : control_{control}
+    , slot_{slot} { }
+
+  /**
+   * @brief Moves forward to the next full slot or to the sentinel.
+   *
+   * @details Empty and deleted control bytes compare below the sentinel, full ones above it.
+   */
+  auto SkipFree() noexcept -> void {
+    while (*control_ < kFlatHashMapSentinel) {
+      ++control_;
+      ++slot_;
+    }
+  }
+
+  const std::int8_t* control_{nullptr};
+  SlotPointer slot_{nullptr};
+};
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Open addressing hash map with Swiss table style control bytes and SIMD group probing.
+ * @class
+ *
+ * @tparam Key Key type
+ * @tparam Mapped Mapped type
+ * @tparam Hash Hash function, lookups by other key types are enabled when both `Hash` and `KeyEqual` define
+ * `is_transparent`
+ * @tparam KeyEqual Key equality predicate
+ * @tparam Allocator Allocator of `std::pair<const Key, Mapped>`, rebound for the slot and control buffers
+ *
+ * @details Elements live directly in a flat slot array owned by a `lab::Vector`, next to a `lab::Vector` of one
+ * control byte per slot: `kEmpty`, `kDeleted`, or the low 7 hash bits of a full slot. A lookup compares those bits
+ * against a whole 16-slot group with one SIMD instruction and touches the slots only on a match, so read-mostly
+ * tables stay cache-resident. The table keeps at most 7/8 of its slots occupied and rehashes by relocating every
+ * element, a plain `std::memcpy` per slot when the key and mapped types are trivially relocatable.
+ *
+ * @note Iterators and references are invalidated by every rehash; `Reserve` or `InsertRange` avoid repeated ones.
+ */
+template<
+  typename Key,
+  typename Mapped,
+  typename Hash = std::hash<Key>,
+  typename KeyEqual = std::equal_to<Key>,
+  typename Allocator = std::allocator<std::pair<const Key, Mapped>>>
+class [[nodiscard]] FlatHashMap {
+  friend FlatHashMapIteratorBase<false, FlatHashMap>;
+  friend FlatHashMapIteratorBase<true, FlatHashMap>;
+
+  using SlotType = std::pair<Key, Mapped>;
+  using SlotStorageType = FlatHashMapSlotStorage<SlotType>;
+  using SlotOps = FlatHashMapSlotOps<SlotType, Allocator>;
+  using SlotAllocatorType = SlotOps::AllocatorType;
+  using SlotAllocatorTraits = SlotOps::AllocatorTraits;
+  using ControlVector = Vector<std::int8_t, typename std::allocator_traits<Allocator>::template rebind_alloc<std::int8_t>>;
+  using SlotVector =
+    Vector<SlotStorageType, typename std::allocator_traits<Allocator>::template rebind_alloc<SlotStorageType>>;
+  using SlotStorageAllocatorTraits = std::allocator_traits<typename SlotVector::AllocatorType>;
+  using HashVector = Vector<std::size_t, typename std::allocator_traits<Allocator>::template rebind_alloc<std::size_t>>;
+  static constexpr bool kIsTransparent{
+    requires { typename Hash::is_transparent; } && requires { typename KeyEqual::is_transparent; }
+  };
+  static constexpr bool kIsNothrowRelocatable{
+    kIsTriviallyRelocatable<SlotType> || std::is_nothrow_move_constructible_v<SlotType>
+  };
+  static constexpr bool kIsNothrowHashable{std::is_nothrow_invocable_v<const Hash&, const Key&>};
+  static constexpr bool kPropagatesOnCopyAssignment{
+    std::allocator_traits<Allocator>::propagate_on_container_copy_assignment::value
+  };
+  static constexpr bool kPropagatesOnMoveAssignment{
+    std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value
+  };
+  static constexpr bool kIsAllocatorAlwaysEqual{std::allocator_traits<Allocator>::is_always_equal::value};
+
+  // Full slots hold a `std::pair<Key, Mapped>` and are handed out as `std::pair<const Key, Mapped>`, which keeps
+  // keys movable on rehash (the same layout punning as in Abseil's and Boost's flat maps).
+  static_assert(sizeof(SlotType) == sizeof(std::pair<const Key, Mapped>));
+  static_assert(alignof(SlotType) == alignof(std::pair<const Key, Mapped>));
+
+ public:
+  using KeyType = Key;
+  using key_type = Key;
+  using MappedType = Mapped;
+  using mapped_type = Mapped;
+  using ValueType = std::pair<const Key, Mapped>;
+  using value_type = ValueType;
+  using Reference = ValueType&;
+  using reference = Reference;
+  using ConstReference = const ValueType&;
+  using const_reference = ConstReference;
+  using SizeType = std::size_t;
+  using size_type = std::size_t;
+  using DifferenceType = std::ptrdiff_t;
+  using difference_type = std::ptrdiff_t;
+  using Hasher = Hash;
+  using hasher = Hash;
+  using KeyEqualType = KeyEqual;
+  using key_equal = KeyEqual;
+  using AllocatorType = Allocator;
+  using allocator_type = Allocator;
+  using Iterator = FlatHashMapIteratorBase<false, FlatHashMap>;
+  using iterator = Iterator;
+  using ConstIterator = FlatHashMapIteratorBase<true, FlatHashMap>;
+  using const_iterator = ConstIterator;
+
+  /**
+   * @brief Slots compared by one probe step.
+   */
+  static constexpr SizeType kGroupWidth{kFlatHashMapGroupWidth};
+
+  FlatHashMap() noexcept(std::is_nothrow_default_constructible_v<AllocatorType> &&
+                         std::is_nothrow_default_constructible_v<Hash> &&
+                         std::is_nothrow_default_constructible_v<KeyEqual>) = default;
+
+  explicit FlatHashMap(const AllocatorType& allocator) noexcept
+    : control_{typename ControlVector::AllocatorType{allocator}}
+    , slots_{typename SlotVector::AllocatorType{allocator}} { }
+
+  /**
+   * @brief Constructs an empty map that holds `n` elements without rehashing.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator).
+   */
+  explicit FlatHashMap(
+    SizeType n,  //
+    const Hash& hash = Hash{},
+    const KeyEqual& key_equal = KeyEqual{},
+    const AllocatorType& allocator = AllocatorType{}
+  )
+    : control_{typename ControlVector::AllocatorType{allocator}}
+    , slots_{typename SlotVector::AllocatorType{allocator}}
+    , hash_{hash}
+    , key_equal_{key_equal} {
+    Reserve(n);
+  }
+
+  template<std::input_iterator InputIterator, std::sentinel_for<InputIterator> Sentinel>
+  FlatHashMap(
+    InputIterator first,  //
+    Sentinel last,
+    SizeType n = 0,
+    const Hash& hash = Hash{},
+    const KeyEqual& key_equal = KeyEqual{},
+    const AllocatorType& allocator = AllocatorType{}
+  )
+    : FlatHashMap{n, hash, key_equal, allocator} {
+    InsertRange(std::ranges::subrange{std::move(first), std::move(last)});
+  }
+
+  FlatHashMap(
+    std::initializer_list<ValueType> ilist,  //
+    SizeType n = 0,
+    const Hash& hash = Hash{},
+    const KeyEqual& key_equal = KeyEqual{},
+    const AllocatorType& allocator = AllocatorType{}
+  )
+    : FlatHashMap{n, hash, key_equal, allocator} {
+    InsertRange(ilist);
+  }
+
+  /**
+   * @brief Copies the table slot by slot, without rehashing.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  FlatHashMap(const FlatHashMap& other)
+    : FlatHashMap{
+        other,
+        std::allocator_traits<AllocatorType>::select_on_container_copy_construction(other.GetAllocator())
+      } { }
+
+  FlatHashMap(
+    const FlatHashMap& other,  //
+    const AllocatorType& allocator
+  )
+    : control_{other.control_, typename ControlVector::AllocatorType{allocator}}
+    , slots_{other.Capacity(), default_init, typename SlotVector::AllocatorType{allocator}}
+    , size_{other.size_}
+    , growth_left_{other.growth_left_}
+    , hash_{other.hash_}
+    , key_equal_{other.key_equal_} {
+    CopySlotsFrom(other);
+  }
+
+  FlatHashMap(FlatHashMap&& other) noexcept
+    : control_{std::move(other.control_)}
+    , slots_{std::move(other.slots_)}
+    , size_{std::exchange(other.size_, 0)}
+    , growth_left_{std::exchange(other.growth_left_, 0)}
+    , hash_{other.hash_}
+    , key_equal_{other.key_equal_} { }
+
+  /**
+   * @brief Copy assignment operator.
+   * @public
+   *
+   * @details The copy is built first with the allocator this map ends up with, so a failed copy leaves the map
+   * unchanged. An allocator that propagates on copy but not on move is adopted through empty vectors before the
+   * copy's buffers are stolen, otherwise the move would keep the own allocator.
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  auto operator=(const FlatHashMap& other) -> FlatHashMap& {
+    if (this == &other) {
+      return *this;
+    }
+    FlatHashMap temp{other, kPropagatesOnCopyAssignment ? other.GetAllocator() : GetAllocator()};
+    if constexpr (kPropagatesOnCopyAssignment && !kPropagatesOnMoveAssignment && !kIsAllocatorAlwaysEqual) {
+      if (GetAllocator() != other.GetAllocator()) {
+        const FlatHashMap empty{other.GetAllocator()};
+        DestroySlots();
+        size_ = 0;
+        growth_left_ = 0;
+        control_ = empty.control_;
+        slots_ = empty.slots_;
+      }
+    }
+    *this = std::move(temp);
+    return *this;
+  }
+
+  /**
+   * @brief Move assignment operator.
+   * @public
+   *
+   * @details Steals the buffers unless the allocators differ and do not propagate, then the elements are moved one by
+   * one into a table owned by this allocator.
+   *
+   * @throws None (no-throw guarantee) if the buffers can be stolen, otherwise propagates user defined exception.
+   */
+  auto operator=(FlatHashMap&& other) noexcept(kPropagatesOnMoveAssignment || kIsAllocatorAlwaysEqual)
+    -> FlatHashMap& {
+    if (this == &other) {
+      return *this;
+    }
+    if constexpr (!kPropagatesOnMoveAssignment && !kIsAllocatorAlwaysEqual) {
+      if (GetAllocator() != other.GetAllocator()) {
+        Clear();
+        Reserve(other.size_);
+        for (auto& value : other) {
+          auto& slot{*SlotPointer(other.ValueSlot(value))};
+          TryEmplaceImpl(std::move(slot.first), std::move(slot.second));
+        }
+        other.Clear();
+        return *this;
+      }
+    }
+    DestroySlots();
+    control_ = std::move(other.control_);
+    slots_ = std::move(other.slots_);
+    size_ = std::exchange(other.size_, 0);
+    growth_left_ = std::exchange(other.growth_left_, 0);
+    hash_ = other.hash_;
+    key_equal_ = other.key_equal_;
+    return *this;
+  }
+
+  ~FlatHashMap() { DestroySlots(); }
+
+  [[nodiscard]] auto begin() noexcept -> Iterator { return MakeIterator<Iterator>(0); }
+
+  [[nodiscard]] auto end() noexcept -> Iterator { return {control_.Data() + Capacity(), slots_.Data() + Capacity()}; }
+
+  [[nodiscard]] auto begin() const noexcept -> ConstIterator { return MakeIterator<ConstIterator>(0); }
+
+  [[nodiscard]] auto end() const noexcept -> ConstIterator {
+    return {control_.Data() + Capacity(), slots_.Data() + Capacity()};
+  }
+
+  [[nodiscard]] auto cbegin() const noexcept -> ConstIterator { return begin(); }
+
+  [[nodiscard]] auto cend() const noexcept -> ConstIterator { return end(); }
+
+  [[nodiscard]] auto Size() const noexcept -> SizeType { return size_; }
+
+  [[nodiscard]] auto Empty() const noexcept -> bool { return !size_; }
+
+  /**
+   * @brief Number of slots, a power of two multiple of `kGroupWidth` (or zero).
+   * @public
+   */
+  [[nodiscard]] auto Capacity() const noexcept -> SizeType { return slots_.Size(); }
+
+  [[nodiscard]] auto LoadFactor() const noexcept -> float {
+    return Capacity() ? static_cast<float>(size_) / static_cast<float>(Capacity()) : 0.0F;
+  }
+
+  [[nodiscard]] static constexpr auto MaxLoadFactor() noexcept -> float { return 0.875F; }
+
+  [[nodiscard]] auto GetAllocator() const noexcept -> AllocatorType { return AllocatorType{slots_.GetAllocator()}; }
+
+  [[nodiscard]] auto HashFunction() const -> Hasher { return hash_; }
+
+  [[nodiscard]] auto KeyEq() const -> KeyEqualType { return key_equal_; }
+
+  [[nodiscard]] auto Find(const KeyType& key) -> Iterator { return MakeIterator<Iterator>(FindIndex(key)); }
+
+  [[nodiscard]] auto Find(const KeyType& key) const -> ConstIterator {
+    return MakeIterator<ConstIterator>(FindIndex(key));
+  }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto Find(const K& key) -> Iterator {
+    return MakeIterator<Iterator>(FindIndex(key));
+  }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto Find(const K& key) const -> ConstIterator {
+    return MakeIterator<ConstIterator>(FindIndex(key));
+  }
+
+  [[nodiscard]] auto Contains(const KeyType& key) const -> bool { return FindIndex(key) != Capacity(); }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto Contains(const K& key) const -> bool {
+    return FindIndex(key) != Capacity();
+  }
+
+  [[nodiscard]] auto Count(const KeyType& key) const -> SizeType { return Contains(key) ? 1 : 0; }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto Count(const K& key) const -> SizeType {
+    return Contains(key) ? 1 : 0;
+  }
+
+  /**
+   * @brief Returns the value mapped to `key`.
+   * @public
+   *
+   * @throws `std::out_of_range` if there is no such key.
+   */
+  [[nodiscard]] auto At(const KeyType& key) -> MappedType& { return AtImpl(*this, key); }
+
+  [[nodiscard]] auto At(const KeyType& key) const -> const MappedType& { return AtImpl(*this, key); }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto At(const K& key) -> MappedType& {
+    return AtImpl(*this, key);
+  }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto At(const K& key) const -> const MappedType& {
+    return AtImpl(*this, key);
+  }
+
+  auto operator[](const KeyType& key) -> MappedType& { return TryEmplaceImpl(key).first->second; }
+
+  auto operator[](KeyType&& key) -> MappedType& { return TryEmplaceImpl(std::move(key)).first->second; }
+
+  /**
+   * @brief Inserts `value` unless its key is present.
+   * @public
+   *
+   * @return Iterator to the element with the key and whether the insertion took place.
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   * Strong exception guarantee.
+   */
+  auto Insert(const ValueType& value) -> std::pair<Iterator, bool> { return TryEmplaceImpl(value.first, value.second); }
+
+  auto Insert(ValueType&& value) -> std::pair<Iterator, bool> {
+    return TryEmplaceImpl(value.first, std::move(value.second));
+  }
+
+  template<typename P>
+    requires std::constructible_from<SlotType, P&&>
+  auto Insert(P&& value) -> std::pair<Iterator, bool> {
+    return Emplace(std::forward<P>(value));
+  }
+
+  /**
+   * @brief Inserts every element of `range`, growing the table at most once when its size is known upfront.
+   * @public
+   *
+   * @details Sized and forward ranges reserve room for all elements first, so duplicates never force a second
+   * rehash; plain input ranges grow as they go.
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   * Basic exception guarantee: the elements inserted before the exception stay in the map.
+   */
+  template<std::ranges::input_range R>
+    requires std::constructible_from<SlotType, std::ranges::range_reference_t<R>>
+  auto InsertRange(R&& range) -> void {
+    if constexpr (std::ranges::sized_range<R> || std::ranges::forward_range<R>) {
+      Reserve(size_ + static_cast<SizeType>(std::ranges::distance(range)));
+    }
+    for (auto&& value : range) {
+      Insert(std::forward<decltype(value)>(value));
+    }
+  }
+
+  auto Insert(std::initializer_list<ValueType> ilist) -> void { InsertRange(ilist); }
+
+  /**
+   * @brief Constructs an element from `args` and inserts it unless its key is present.
+   * @public
+   *
+   * @details The element is built before the lookup, prefer `TryEmplace` when the key is at hand.
+   */
+  template<typename... Args>
+    requires std::constructible_from<SlotType, Args&&...>
+  auto Emplace(Args&&... args) -> std::pair<Iterator, bool> {
+    SlotType slot(std::forward<Args>(args)...);
+    return TryEmplaceImpl(std::move(slot.first), std::move(slot.second));
+  }
+
+  /**
+   * @brief Constructs the mapped value from `args` only if `key` is absent, otherwise leaves `args` untouched.
+   * @public
+   */
+  template<typename... Args>
+  auto TryEmplace(
+    const KeyType& key,  //
+    Args&&... args
+  ) -> std::pair<Iterator, bool> {
+    return TryEmplaceImpl(key, std::forward<Args>(args)...);
+  }
+
+  template<typename... Args>
+  auto TryEmplace(
+    KeyType&& key,  //
+    Args&&... args
+  ) -> std::pair<Iterator, bool> {
+    return TryEmplaceImpl(std::move(key), std::forward<Args>(args)...);
+  }
+
+  template<typename K, typename... Args>
+    requires kIsTransparent && std::constructible_from<KeyType, K&&>
+  auto TryEmplace(
+    K&& key,  //
+    Args&&... args
+  ) -> std::pair<Iterator, bool> {
+    return TryEmplaceImpl(std::forward<K>(key), std::forward<Args>(args)...);
+  }
+
+  template<typename M>
+    requires std::assignable_from<MappedType&, M&&>
+  auto InsertOrAssign(
+    const KeyType& key,  //
+    M&& mapped
+  ) -> std::pair<Iterator, bool> {
+    auto result{TryEmplaceImpl(key, std::forward<M>(mapped))};
+    if (!result.second) {
+      result.first->second = std::forward<M>(mapped);
+    }
+    return result;
+  }
+
+  template<typename M>
+    requires std::assignable_from<MappedType&, M&&>
+  auto InsertOrAssign(
+    KeyType&& key,  //
+    M&& mapped
+  ) -> std::pair<Iterator, bool> {
+    auto result{TryEmplaceImpl(std::move(key), std::forward<M>(mapped))};
+    if (!result.second) {
+      result.first->second = std::forward<M>(mapped);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Erases the element at `position`.
+   * @public
+   *
+   * @return Iterator following the erased element.
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `position` is not a dereferenceable iterator of this map
+   */
+  auto Erase(ConstIterator position) noexcept -> Iterator {
+    const auto index{static_cast<SizeType>(position.slot_ - slots_.Data())};
+    EraseAt(index);
+    return MakeIterator<Iterator>(index + 1);
+  }
+
+  auto Erase(Iterator position) noexcept -> Iterator { return Erase(ConstIterator{position}); }
+
+  auto Erase(const KeyType& key) -> SizeType { return EraseKey(key); }
+
+  template<typename K>
+    requires kIsTransparent && (!std::convertible_to<K, ConstIterator>)
+  auto Erase(const K& key) -> SizeType {
+    return EraseKey(key);
+  }
+
+  /**
+   * @brief Destroys every element and keeps the slots for reuse.
+   * @public
+   */
+  auto Clear() noexcept -> void {
+    DestroySlots();
+    ResetControl(control_.Data(), Capacity());
+    size_ = 0;
+    growth_left_ = GrowthLimit(Capacity());
+  }
+
+  /**
+   * @brief Makes room for `n` elements in total, so that inserting them does not rehash.
+   * @public
+   *
+   * @details Also rehashes when enough slots exist but tombstones of erased elements use them up.
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   * Strong exception guarantee.
+   */
+  auto Reserve(SizeType n) -> void {
+    if (n > size_ && n - size_ > growth_left_) {
+      Rehash(std::max(CapacityFor(n), Capacity()));
+    }
+  }
+
+  /**
+   * @brief Rebuilds the table with at least `capacity` slots and room for the current elements.
+   * @public
+   *
+   * @details Drops every tombstone; `Rehash(0)` shrinks the table to the smallest fitting capacity and releases it
+   * when the map is empty.
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   * Strong exception guarantee.
+   */
+  auto Rehash(SizeType capacity) -> void {
+    if (!capacity && !size_) {
+      DestroySlots();
+      control_ = ControlVector{control_.GetAllocator()};
+      slots_ = SlotVector{slots_.GetAllocator()};
+      growth_left_ = 0;
+      return;
+    }
+    Resize(std::max(std::bit_ceil(std::max(capacity, kGroupWidth)), CapacityFor(size_)));
+  }
+
+  auto Swap(FlatHashMap& other) noexcept -> void {
+    control_.Swap(other.control_);
+    slots_.Swap(other.slots_);
+    std::swap(size_, other.size_);
+    std::swap(growth_left_, other.growth_left_);
+    std::swap(hash_, other.hash_);
+    std::swap(key_equal_, other.key_equal_);
+  }
+
+  [[nodiscard]] friend auto operator==(
+    const FlatHashMap& lhs,  //
+    const FlatHashMap& rhs
+  ) -> bool
+    requires std::equality_comparable<MappedType>
+  {
+    if (lhs.size_ != rhs.size_) {
+      return false;
+    }
+    return std::ranges::all_of(lhs, [&rhs](const ValueType& value) {
+      const auto it{rhs.Find(value.first)};
+      return it != rhs.end() && it->second == value.second;
+    });
+  }
+
+ private:
+  [[nodiscard]] static auto ValuePointer(SlotStorageType* slot) noexcept -> ValueType* {
+    return std::launder(reinterpret_cast<ValueType*>(slot));
+  }
+
+  [[nodiscard]] static auto ValuePointer(const SlotStorageType* slot) noexcept -> const ValueType* {
+    return std::launder(reinterpret_cast<const ValueType*>(slot));
+  }
+
+  [[nodiscard]] static auto SlotPointer(SlotStorageType* slot) noexcept -> SlotType* {
+    return std::launder(reinterpret_cast<SlotType*>(slot));
+  }
+
+  [[nodiscard]] static auto SlotPointer(const SlotStorageType* slot) noexcept -> const SlotType* {
+    return std::launder(reinterpret_cast<const SlotType*>(slot));
+  }
+
+  [[nodiscard]] static auto ValueSlot(ValueType& value) noexcept -> SlotStorageType* {
+    return reinterpret_cast<SlotStorageType*>(std::addressof(value));
+  }
+
+  [[nodiscard]] static constexpr auto GrowthLimit(SizeType capacity) noexcept -> SizeType {
+    return capacity - capacity / 8;
+  }
+
+  /**
+   * @brief Smallest capacity whose growth limit admits `n` elements.
+   */
+  [[nodiscard]] static constexpr auto CapacityFor(SizeType n) noexcept -> SizeType {
+    return n ? std::max(std::bit_ceil((n * 8 + 6) / 7), kGroupWidth) : 0;
+  }
+
+  [[nodiscard]] static auto IsFull(std::int8_t control) noexcept -> bool { return control >= 0; }
+
+  template<typename K>
+  [[nodiscard]] auto HashOf(const K& key) const -> std::size_t {
+    return FlatHashMapMix(static_cast<std::size_t>(hash_(key)));
+  }
+
+  template<typename It>
+  [[nodiscard]] auto MakeIterator(SizeType index) const noexcept -> It {
+    if (index >= Capacity()) {
+      return {control_.Data() + Capacity(), const_cast<SlotStorageType*>(slots_.Data()) + Capacity()};
+    }
+    It it{control_.Data() + index, const_cast<SlotStorageType*>(slots_.Data()) + index};
+    it.SkipFree();
+    return it;
+  }
+
+  /**
+   * @brief Returns the slot index of `key` or `Capacity()` when it is absent.
+   */
+  template<typename K>
+  [[nodiscard]] auto FindIndex(const K& key) const -> SizeType {
+    return size_ ? FindIndex(key, HashOf(key)) : Capacity();
+  }
+
+  template<typename K>
+  [[nodiscard]] auto FindIndex(
+    const K& key,  //
+    std::size_t hash
+  ) const -> SizeType {
+    if (!size_) {
+      return Capacity();
+    }
+    const std::int8_t h2{FlatHashMapH2(hash)};
+    const std::int8_t* const control{control_.Data()};
+    for (FlatHashMapProbe probe{hash, Capacity()};; probe.Next()) {
+      const FlatHashMapGroup group{control + probe.Offset()};
+      for (auto mask{group.Match(h2)}; mask; mask &= mask - 1) {
+        const SizeType index{probe.Offset() + static_cast<SizeType>(std::countr_zero(mask))};
+        if (key_equal_(SlotPointer(slots_.Data() + index)->first, key)) {
+          return index;
+        }
+      }
+      if (group.MatchEmpty()) {
+        return Capacity();
+      }
+    }
+  }
+
+  /**
+   * @brief First empty or deleted slot on the probe sequence of `hash`.
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - the table has no empty slot
+   */
+  [[nodiscard]] static auto FindFirstFree(
+    const std::int8_t* control,  //
+    SizeType capacity,
+    std::size_t hash
+  ) noexcept -> SizeType {
+    for (FlatHashMapProbe probe{hash, capacity};; probe.Next()) {
+      if (const auto mask{FlatHashMapGroup{control + probe.Offset()}.MatchEmptyOrDeleted()}) {
+        return probe.Offset() + static_cast<SizeType>(std::countr_zero(mask));
+      }
+    }
+  }
+
+  template<typename Self, typename K>
+  [[nodiscard]] static auto AtImpl(
+    Self& self,  //
+    const K& key
+  ) -> decltype(auto) {
+    const SizeType index{self.FindIndex(key)};
+    if (index == self.Capacity()) {
+      throw std::out_of_range{"FlatHashMap::At: key not found"};
+    }
+    return (SlotPointer(self.slots_.Data() + index)->second);
+  }
+
+  /**
+   * @brief Looks `key` up and, when absent, constructs the slot from `key` and `args` in a free slot.
+   *
+   * @details The control byte is published only after the construction succeeded, so a throwing constructor leaves
+   * the map unchanged (apart from a possible rehash).
+   */
+  template<typename K, typename... Args>
+  auto TryEmplaceImpl(
+    K&& key,  //
+    Args&&... args
+  ) -> std::pair<Iterator, bool> {
+    const std::size_t hash{HashOf(key)};
+    if (const SizeType index{FindIndex(key, hash)}; index != Capacity()) {
+      return {Iterator{control_.Data() + index, slots_.Data() + index}, false};
+    }
+    const SizeType index{PrepareInsert(hash)};
+    SlotAllocatorType allocator{slots_.GetAllocator()};
+    SlotAllocatorTraits::construct(
+      allocator,
+      SlotPointer(slots_.Data() + index),
+      std::piecewise_construct,
+      std::forward_as_tuple(std::forward<K>(key)),
+      std::forward_as_tuple(std::forward<Args>(args)...)
+    );
+    if (control_.Data()[index] == kFlatHashMapEmpty) {
+      --growth_left_;
+    }
+    control_.Data()[index] = FlatHashMapH2(hash);
+    ++size_;
+    return {Iterator{control_.Data() + index, slots_.Data() + index}, true};
+  }
+
+  /**
+   * @brief Returns a free slot for `hash`, growing the table when taking an empty slot would exceed the load factor.
+   */
+  auto PrepareInsert(std::size_t hash) -> SizeType {
+    if (Capacity()) {
+      const SizeType index{FindFirstFree(control_.Data(), Capacity(), hash)};
+      if (growth_left_ || control_.Data()[index] == kFlatHashMapDeleted) {
+        return index;
+      }
+    }
+    // Mostly tombstones: rebuilding at the same capacity reclaims them without growing.
+    Resize(Capacity() && size_ <= GrowthLimit(Capacity()) / 2 ? Capacity() : std::max(2 * Capacity(), kGroupWidth));
+    return FindFirstFree(control_.Data(), Capacity(), hash);
+  }
+
+  /**
+   * @brief Moves every element into a fresh table of `capacity` slots.
+   *
+   * @details Trivially relocatable slots are copied with `std::memcpy`, nothrow movable ones are moved. Otherwise the
+   * elements are copied first and the old table is destroyed only once all copies succeeded (strong guarantee).
+   * Relocating cannot be undone halfway, so a hasher that may throw is run over every key before the first element
+   * moves and the relocation reads the cached hashes.
+   */
+  auto Resize(SizeType capacity) -> void {
+    assert(std::has_single_bit(capacity) && capacity >= kGroupWidth && GrowthLimit(capacity) >= size_);
+    ControlVector control(capacity + 1, default_init, control_.GetAllocator());
+    ResetControl(control.Data(), capacity);
+    SlotVector slots(capacity, default_init, slots_.GetAllocator());
+    SlotAllocatorType allocator{slots_.GetAllocator()};
+
+    const std::int8_t* const old_control{control_.Data()};
+    if constexpr (kIsNothrowRelocatable) {
+      HashVector hashes{typename HashVector::AllocatorType{slots_.GetAllocator()}};
+      if constexpr (!kIsNothrowHashable) {
+        hashes.Reserve(size_);
+        for (SizeType i{}; i < Capacity(); ++i) {
+          if (IsFull(old_control[i])) {
+            hashes.PushBack(HashOf(SlotPointer(slots_.Data() + i)->first));
+          }
+        }
+      }
+      SizeType relocated{};
+      for (SizeType i{}; i < Capacity(); ++i) {
+        if (IsFull(old_control[i])) {
+          SlotType* const source{SlotPointer(slots_.Data() + i)};
+          const std::size_t hash{kIsNothrowHashable ? HashOf(source->first) : hashes[relocated++]};
+          const SizeType target{FindFirstFree(control.Data(), capacity, hash)};
+          SlotOps::UninitializedRelocateUsingAllocator(source, source + 1, SlotPointer(slots.Data() + target), allocator);
+          control.Data()[target] = FlatHashMapH2(hash);
+        }
+      }
+    } else {
+      LAB_TRY {
+        for (SizeType i{}; i < Capacity(); ++i) {
+          if (IsFull(old_control[i])) {
+            const SlotType* const source{SlotPointer(slots_.Data() + i)};
+            const std::size_t hash{HashOf(source->first)};
+            const SizeType target{FindFirstFree(control.Data(), capacity, hash)};
+            SlotOps::UninitializedCopyUsingAllocator(source, source + 1, SlotPointer(slots.Data() + target), allocator);
+            control.Data()[target] = FlatHashMapH2(hash);
+          }
+        }
+      }
+      LAB_CATCH(...) {
+        DestroySlots(control.Data(), slots.Data(), capacity, allocator);
+        LAB_PROPAGATE_EXCEPTION;
+      }
+      DestroySlots();
+    }
+
+    control_ = std::move(control);
+    slots_ = std::move(slots);
+    growth_left_ = GrowthLimit(capacity) - size_;
+  }
+
+  /**
+   * @brief Copies the full slots of `other` to the same indices, the control bytes are already copied.
+   */
+  auto CopySlotsFrom(const FlatHashMap& other) -> void {
+    if constexpr (std::is_trivially_copyable_v<SlotType>) {
+      if (other.Capacity()) {
+        std::memcpy(
+          static_cast<void*>(slots_.Data()),
+          static_cast<const void*>(other.slots_.Data()),
+          other.Capacity() * sizeof(SlotStorageType)
+        );
+      }
+    } else {
+      SlotAllocatorType allocator{slots_.GetAllocator()};
+      const std::int8_t* const control{control_.Data()};
+      SizeType i{};
+      LAB_TRY {
+        for (; i < Capacity(); ++i) {
+          if (IsFull(control[i])) {
+            const SlotType* const source{SlotPointer(other.slots_.Data() + i)};
+            SlotOps::UninitializedCopyUsingAllocator(source, source + 1, SlotPointer(slots_.Data() + i), allocator);
+          }
+        }
+      }
+      LAB_CATCH(...) {
+        DestroySlots(control, slots_.Data(), i, allocator);
+        LAB_PROPAGATE_EXCEPTION;
+      }
+    }
+  }
+
+  template<typename K>
+  auto EraseKey(const K& key) -> SizeType {
+    const SizeType index{FindIndex(key)};
+    if (index == Capacity()) {
+      return 0;
+    }
+    EraseAt(index);
+    return 1;
+  }
+
+  /**
+   * @brief Destroys the element at `index` and frees its slot.
+   *
+   * @details Groups are probed as aligned blocks, so a lookup never went past a group that still has an empty slot:
+   * such a slot becomes empty again, others become tombstones.
+   */
+  auto EraseAt(SizeType index) noexcept -> void {
+    SlotAllocatorType allocator{slots_.GetAllocator()};
+    SlotAllocatorTraits::destroy(allocator, SlotPointer(slots_.Data() + index));
+    std::int8_t* const control{control_.Data()};
+    if (FlatHashMapGroup{control + (index & ~(kGroupWidth - 1))}.MatchEmpty()) {
+      control[index] = kFlatHashMapEmpty;
+      ++growth_left_;
+    } else {
+      control[index] = kFlatHashMapDeleted;
+    }
+    --size_;
+  }
+
+  static auto ResetControl(
+    std::int8_t* control,  //
+    SizeType capacity
+  ) noexcept -> void {
+    if (control) {
+      std::memset(control, kFlatHashMapEmpty, capacity);
+      control[capacity] = kFlatHashMapSentinel;
+    }
+  }
+
+  static auto DestroySlots(
+    const std::int8_t* control,  //
+    SlotStorageType* slots,
+    SizeType count,
+    SlotAllocatorType& allocator
+  ) noexcept -> void {
+    if constexpr (!std::is_trivially_destructible_v<SlotType>) {
+      for (SizeType i{}; i < count; ++i) {
+        if (IsFull(control[i])) {
+          SlotAllocatorTraits::destroy(allocator, SlotPointer(slots + i));
+        }
+      }
+    }
+  }
+
+  auto DestroySlots() noexcept -> void {
+    if (size_) {
+      SlotAllocatorType allocator{slots_.GetAllocator()};
+      DestroySlots(control_.Data(), slots_.Data(), Capacity(), allocator);
+    }
+  }
+
+  ControlVector control_{};
+  SlotVector slots_{};
+  SizeType size_{0};
+  SizeType growth_left_{0};
+  [[no_unique_address]] Hash hash_{};
+  [[no_unique_address]] KeyEqual key_equal_{};
+};
+
+}  // namespace lab
+
+END_EXPORT_SECTION
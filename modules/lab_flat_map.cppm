@@ -0,0 +1,1007 @@
+module;
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+export module lab_flat_map;
+
+import lab_vector;
+
+/**
+ * @brief Eytzinger lookups prefetch the node this many slots (four levels) below the current one.
+ * @internal
+ */
+inline constexpr std::size_t kFlatEytzingerPrefetchDistance{16};
+
+/**
+ * @brief Index of the first of the `n` elements at `first` that does not compare less than `key`.
+ * @internal
+ *
+ * @details Halves the range without a data dependent branch: the comparison only selects the next base, which
+ * compiles to a conditional move, so lookups do not pay for mispredictions on random keys.
+ */
+template<std::random_access_iterator Iterator, typename K, typename Compare>
+[[nodiscard]] constexpr auto FlatBranchlessLowerBound(
+  Iterator first,  //
+  std::size_t n,
+  const K& key,
+  const Compare& comp
+) -> std::size_t {
+  if (n == 0) {
+    return 0;
+  }
+  Iterator base{first};
+  while (n > 1) {
+    const std::size_t half{n / 2};
+    base = comp(base[static_cast<std::ptrdiff_t>(half - 1)], key) ? base + static_cast<std::ptrdiff_t>(half) : base;
+    n -= half;
+  }
+  return static_cast<std::size_t>(base - first) + static_cast<std::size_t>(comp(*base, key));
+}
+
+/**
+ * @brief Returns `value` as an rvalue when `kMove`, otherwise as a const lvalue to copy from.
+ * @internal
+ */
+template<bool kMove, typename T>
+[[nodiscard]] constexpr auto FlatTake(T& value) noexcept -> decltype(auto) {
+  if constexpr (kMove) {
+    return std::move(value);
+  } else {
+    return std::as_const(value);
+  }
+}
+
+/**
+ * @brief Order in which the elements of `keys` form a sorted, duplicate free sequence.
+ * @internal
+ *
+ * @details `keys[0, old_size)` must already be sorted and unique. The appended tail is stable sorted through an
+ * index permutation and merged with the old elements in a single pass. Old elements win over equivalent new ones,
+ * and the first of several equivalent new elements wins over the later ones.
+ */
+template<typename KeyContainer, typename Compare>
+[[nodiscard]] auto FlatMergeOrder(
+  const KeyContainer& keys,  //
+  std::size_t old_size,
+  const Compare& comp
+) -> lab::Vector<std::size_t> {
+  const auto first{std::ranges::begin(keys)};
+  const auto key{[first](std::size_t index) -> decltype(auto) { return first[static_cast<std::ptrdiff_t>(index)]; }};
+
+  lab::Vector<std::size_t> tail(keys.Size() - old_size, lab::default_init);
+  std::iota(tail.begin(), tail.end(), old_size);
+  std::stable_sort(tail.begin(), tail.end(), [&](std::size_t lhs, std::size_t rhs) {
+    return comp(key(lhs), key(rhs));
+  });
+
+  lab::Vector<std::size_t> order;
+  order.Reserve(keys.Size());
+  std::size_t old_index{};
+  for (const std::size_t candidate : tail) {
+    while (old_index < old_size && !comp(key(candidate), key(old_index))) {
+      order.EmplaceBack(old_index++);
+    }
+    if (order.Empty() || comp(key(order.Back()), key(candidate))) {
+      order.EmplaceBack(candidate);
+    }
+  }
+  while (old_index < old_size) {
+    order.EmplaceBack(old_index++);
+  }
+  return order;
+}
+
+/**
+ * @brief Lookup index of a flat container, `IsEytzinger` selects `FlatEytzingerLayout` over `FlatSortedLayout`.
+ * @internal
+ */
+template<bool IsEytzinger, typename KeyContainer>
+class FlatSearchIndex;
+
+/**
+ * @brief Searches the sorted keys, holds no state.
+ * @internal
+ * @class
+ */
+template<typename KeyContainer>
+class FlatSearchIndex<false, KeyContainer> final {
+ public:
+  FlatSearchIndex() noexcept = default;
+
+  explicit FlatSearchIndex(const KeyContainer& /* keys */) noexcept { }
+
+  auto Rebuild(const KeyContainer& /* keys */) noexcept -> void { }
+
+  auto Clear() noexcept -> void { }
+
+  auto Swap(FlatSearchIndex& /* other */) noexcept -> void { }
+
+  template<typename K, typename Compare>
+  [[nodiscard]] auto LowerBound(
+    const KeyContainer& keys,  //
+    const K& key,
+    const Compare& comp
+  ) const -> std::size_t {
+    return FlatBranchlessLowerBound(std::ranges::begin(keys), keys.Size(), key, comp);
+  }
+};
+
+/**
+ * @brief Eytzinger ordered copy of the keys plus the sorted position of every node.
+ * @internal
+ * @class
+ *
+ * @details Node `k` (1-based) has the children `2k` and `2k + 1`. An index whose size differs from the keys (a
+ * failed rebuild) is ignored and lookups fall back to the sorted search.
+ */
+template<typename KeyContainer>
+class FlatSearchIndex<true, KeyContainer> final {
+ public:
+  FlatSearchIndex() noexcept = default;
+
+  explicit FlatSearchIndex(const KeyContainer& keys)
+    : keys_{keys.GetAllocator()} { }
+
+  /**
+   * @brief Lays the sorted `keys` out in breadth-first order.
+   *
+   * @details Drops the index instead of throwing when it cannot be allocated, the keys themselves are consistent.
+   */
+  auto Rebuild(const KeyContainer& keys) noexcept -> void {
+    Clear();
+    LAB_TRY {
+      const std::size_t n{keys.Size()};
+      ranks_.ResizeForOverwrite(n);
+      std::size_t rank{};
+      AssignRanks(1, n, rank);
+
+      keys_.Reserve(n);
+      const auto first{std::ranges::begin(keys)};
+      for (const std::size_t node_rank : ranks_) {
+        keys_.EmplaceBack(first[static_cast<std::ptrdiff_t>(node_rank)]);
+      }
+    }
+    LAB_CATCH(...) {
+      Clear();
+    }
+  }
+
+  auto Clear() noexcept -> void {
+    keys_.Clear();
+    ranks_.Clear();
+  }
+
+  auto Swap(FlatSearchIndex& other) noexcept -> void {
+    keys_.Swap(other.keys_);
+    ranks_.Swap(other.ranks_);
+  }
+
+  template<typename K, typename Compare>
+  [[nodiscard]] auto LowerBound(
+    const KeyContainer& keys,  //
+    const K& key,
+    const Compare& comp
+  ) const -> std::size_t {
+    const std::size_t n{keys.Size()};
+    if (ranks_.Size() != n) {
+      return FlatBranchlessLowerBound(std::ranges::begin(keys), n, key, comp);
+    }
+
+    const auto nodes{std::ranges::begin(keys_)};
+    std::size_t k{1};
+    while (k <= n) {
+#if defined(__GNUC__)
+      if (const std::size_t ahead{kFlatEytzingerPrefetchDistance * k}; ahead <= n) {
+        __builtin_prefetch(std::addressof(nodes[static_cast<std::ptrdiff_t>(ahead - 1)]));
+      }
+#endif
+      k = 2 * k + static_cast<std::size_t>(comp(nodes[static_cast<std::ptrdiff_t>(k - 1)], key));
+    }
+    // The path turned left at the answer and right ever since: drop those right turns and the left turn.
+    k >>= std::countr_one(k) + 1;
+    return k == 0 ? n : ranks_[k - 1];
+  }
+
+ private:
+  auto AssignRanks(
+    std::size_t k,  //
+    std::size_t n,
+    std::size_t& rank
+  ) noexcept -> void {
+    if (k > n) {
+      return;
+    }
+    AssignRanks(2 * k, n, rank);
+    ranks_[k - 1] = rank++;
+    AssignRanks(2 * k + 1, n, rank);
+  }
+
+  KeyContainer keys_;
+  lab::Vector<std::size_t> ranks_;
+};
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Interface of the containers backing `FlatSet` and `FlatMap`; `lab::Vector` models it.
+ *
+ * @details Random access storage with the positional `Emplace`/`Erase` of `lab::Vector`, `Reserve` ahead of bulk
+ * appends, and construction from the allocator of another instance so merged buffers keep stateful allocators.
+ */
+template<typename Container>
+concept IsFlatContainer = std::ranges::random_access_range<Container> &&
+                          requires(
+                            Container& container,
+                            const Container& const_container,
+                            std::ranges::range_value_t<Container>&& value,
+                            std::size_t n
+                          ) {
+                            { const_container.Size() } -> std::convertible_to<std::size_t>;
+                            container.Reserve(n);
+                            container.Clear();
+                            container.EmplaceBack(std::move(value));
+                            container.Emplace(const_container.begin(), std::move(value));
+                            container.Erase(const_container.begin());
+                            container.Erase(const_container.begin(), const_container.end());
+                            container.Swap(container);
+                            Container{const_container.GetAllocator()};
+                          };
+
+/**
+ * @brief Default layout: lookups binary search the sorted keys directly.
+ */
+struct FlatSortedLayout { };
+
+/**
+ * @brief Lookup-heavy layout: keeps a copy of the keys in Eytzinger (breadth-first) order next to the sorted ones.
+ *
+ * @details The first levels of the implicit tree share a few cache lines, and the children of a node are adjacent,
+ * so a lookup can prefetch several levels ahead. The copy is rebuilt in O(n) by every modification; tables that
+ * change often should prefer `FlatSortedLayout` or batch their updates through `InsertRange`.
+ */
+struct FlatEytzingerLayout { };
+
+/**
+ * @brief Layout tags accepted by `FlatSet` and `FlatMap`.
+ */
+template<typename Layout>
+concept IsFlatLayout = std::same_as<Layout, FlatSortedLayout> || std::same_as<Layout, FlatEytzingerLayout>;
+
+/**
+ * @brief Ordered set of unique keys stored sorted in a contiguous container.
+ * @class
+ *
+ * @tparam Key Key type
+ * @tparam Compare Strict weak ordering of keys, lookups by other key types are enabled when it defines
+ * `is_transparent`
+ * @tparam KeyContainer Sorted key storage, see `IsFlatContainer`
+ * @tparam Layout `FlatSortedLayout` or `FlatEytzingerLayout`
+ *
+ * @details Lookups are branchless binary searches, which beat node based trees by a wide margin up to several
+ * thousand keys. Single insertions and erasures shift the tail (O(n)), `InsertRange` appends, sorts and merges
+ * the whole batch in one pass.
+ *
+ * @note Iterators are invalidated by every modification.
+ */
+template<
+  typename Key,
+  typename Compare = std::less<Key>,
+  IsFlatContainer KeyContainer = Vector<Key>,
+  IsFlatLayout Layout = FlatSortedLayout>
+class [[nodiscard]] FlatSet {
+  using Index = FlatSearchIndex<std::same_as<Layout, FlatEytzingerLayout>, KeyContainer>;
+  static constexpr bool kIsTransparent{requires { typename Compare::is_transparent; }};
+  static constexpr bool kIsNothrowMovable{std::is_nothrow_move_constructible_v<Key>};
+
+ public:
+  using KeyType = Key;
+  using key_type = Key;
+  using ValueType = Key;
+  using value_type = Key;
+  using KeyCompare = Compare;
+  using key_compare = Compare;
+  using ValueCompare = Compare;
+  using value_compare = Compare;
+  using Reference = const Key&;
+  using reference = Reference;
+  using ConstReference = const Key&;
+  using const_reference = ConstReference;
+  using SizeType = std::size_t;
+  using size_type = std::size_t;
+  using DifferenceType = std::ptrdiff_t;
+  using difference_type = std::ptrdiff_t;
+  using ContainerType = KeyContainer;
+  using container_type = KeyContainer;
+  using LayoutType = Layout;
+  using ConstIterator = std::ranges::iterator_t<const KeyContainer>;
+  using const_iterator = ConstIterator;
+  using Iterator = ConstIterator;
+  using iterator = Iterator;
+
+  FlatSet() = default;
+
+  explicit FlatSet(const Compare& comp)
+    : comp_{comp} { }
+
+  /**
+   * @brief Adopts `keys`, sorting them and dropping duplicates (the first of equivalent keys is kept).
+   * @public
+   */
+  explicit FlatSet(
+    KeyContainer keys,  //
+    const Compare& comp = Compare{}
+  )
+    : index_{keys}
+    , comp_{comp} {
+    keys_.Swap(keys);
+    SortAndMerge(0);
+  }
+
+  template<std::input_iterator InputIterator, std::sentinel_for<InputIterator> Sentinel>
+  FlatSet(
+    InputIterator first,  //
+    Sentinel last,
+    const Compare& comp = Compare{}
+  )
+    : comp_{comp} {
+    InsertRange(std::ranges::subrange{std::move(first), std::move(last)});
+  }
+
+  FlatSet(
+    std::initializer_list<ValueType> ilist,  //
+    const Compare& comp = Compare{}
+  )
+    : comp_{comp} {
+    InsertRange(ilist);
+  }
+
+  [[nodiscard]] auto begin() const noexcept -> ConstIterator { return std::ranges::begin(keys_); }
+
+  [[nodiscard]] auto end() const noexcept -> ConstIterator { return std::ranges::end(keys_); }
+
+  [[nodiscard]] auto cbegin() const noexcept -> ConstIterator { return begin(); }
+
+  [[nodiscard]] auto cend() const noexcept -> ConstIterator { return end(); }
+
+  [[nodiscard]] auto Size() const noexcept -> SizeType { return keys_.Size(); }
+
+  [[nodiscard]] auto Empty() const noexcept -> bool { return Size() == 0; }
+
+  [[nodiscard]] auto KeyComp() const -> KeyCompare { return comp_; }
+
+  /**
+   * @brief Sorted keys.
+   */
+  [[nodiscard]] auto Keys() const noexcept -> const KeyContainer& { return keys_; }
+
+  [[nodiscard]] auto LowerBound(const KeyType& key) const -> ConstIterator { return IteratorAt(LowerBoundIndex(key)); }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto LowerBound(const K& key) const -> ConstIterator {
+    return IteratorAt(LowerBoundIndex(key));
+  }
+
+  [[nodiscard]] auto Find(const KeyType& key) const -> ConstIterator { return IteratorAt(FindIndex(key)); }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto Find(const K& key) const -> ConstIterator {
+    return IteratorAt(FindIndex(key));
+  }
+
+  [[nodiscard]] auto Contains(const KeyType& key) const -> bool { return FindIndex(key) != Size(); }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto Contains(const K& key) const -> bool {
+    return FindIndex(key) != Size();
+  }
+
+  [[nodiscard]] auto Count(const KeyType& key) const -> SizeType { return Contains(key) ? 1 : 0; }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto Count(const K& key) const -> SizeType {
+    return Contains(key) ? 1 : 0;
+  }
+
+  /**
+   * @brief Inserts `key` unless an equivalent key is present.
+   * @public
+   *
+   * @return `std::pair` of an `Iterator` to the element with the key and whether `key` was inserted.
+   */
+  auto Insert(const ValueType& key) -> std::pair<Iterator, bool> { return InsertImpl(key); }
+
+  auto Insert(ValueType&& key) -> std::pair<Iterator, bool> { return InsertImpl(std::move(key)); }
+
+  template<typename... Args>
+    requires std::constructible_from<ValueType, Args&&...>
+  auto Emplace(Args&&... args) -> std::pair<Iterator, bool> {
+    return InsertImpl(ValueType(std::forward<Args>(args)...));
+  }
+
+  /**
+   * @brief Inserts the keys of `range` that are not present yet.
+   * @public
+   *
+   * @details Appends the batch, stable sorts it and merges it with the existing keys in a single pass, so inserting
+   * `m` keys costs O(n + m log m) instead of the O(n m) of repeated `Insert` calls. Keys already in the set win
+   * over equivalent new ones, otherwise the first of equivalent new keys is kept. Strong exception guarantee.
+   */
+  template<std::ranges::input_range Range>
+    requires std::constructible_from<ValueType, std::ranges::range_reference_t<Range>>
+  auto InsertRange(Range&& range) -> void {
+    const SizeType old_size{Size()};
+    LAB_TRY {
+      if constexpr (std::ranges::sized_range<Range>) {
+        keys_.Reserve(old_size + static_cast<SizeType>(std::ranges::size(range)));
+      }
+      for (auto&& key : range) {
+        keys_.EmplaceBack(std::forward<decltype(key)>(key));
+      }
+      if (Size() != old_size) {
+        SortAndMerge(old_size);
+      }
+    }
+    LAB_CATCH(...) {
+      keys_.Erase(begin() + static_cast<DifferenceType>(old_size), end());
+      LAB_PROPAGATE_EXCEPTION;
+    }
+  }
+
+  auto InsertRange(std::initializer_list<ValueType> ilist) -> void { InsertRange(std::views::all(ilist)); }
+
+  auto Erase(ConstIterator position) -> Iterator {
+    const auto index{static_cast<SizeType>(position - begin())};
+    keys_.Erase(position);
+    index_.Rebuild(keys_);
+    return IteratorAt(index);
+  }
+
+  auto Erase(const KeyType& key) -> SizeType {
+    const SizeType index{FindIndex(key)};
+    if (index == Size()) {
+      return 0;
+    }
+    Erase(IteratorAt(index));
+    return 1;
+  }
+
+  auto Clear() noexcept -> void {
+    keys_.Clear();
+    index_.Clear();
+  }
+
+  auto Reserve(SizeType n) -> void { keys_.Reserve(n); }
+
+  auto Swap(FlatSet& other) noexcept -> void {
+    keys_.Swap(other.keys_);
+    index_.Swap(other.index_);
+    std::swap(comp_, other.comp_);
+  }
+
+  [[nodiscard]] friend auto operator==(
+    const FlatSet& lhs,  //
+    const FlatSet& rhs
+  ) -> bool
+    requires std::equality_comparable<KeyType>
+  {
+    return std::ranges::equal(lhs.keys_, rhs.keys_);
+  }
+
+ private:
+  [[nodiscard]] auto IteratorAt(SizeType index) const noexcept -> ConstIterator {
+    return begin() + static_cast<DifferenceType>(index);
+  }
+
+  template<typename K>
+  [[nodiscard]] auto LowerBoundIndex(const K& key) const -> SizeType {
+    return index_.LowerBound(keys_, key, comp_);
+  }
+
+  /**
+   * @brief Position of the key equivalent to `key`, or `Size()`.
+   */
+  template<typename K>
+  [[nodiscard]] auto FindIndex(const K& key) const -> SizeType {
+    const SizeType index{LowerBoundIndex(key)};
+    return index != Size() && !comp_(key, *IteratorAt(index)) ? index : Size();
+  }
+
+  auto InsertImpl(ValueType&& key) -> std::pair<Iterator, bool> {
+    const SizeType index{LowerBoundIndex(key)};
+    if (index != Size() && !comp_(key, *IteratorAt(index))) {
+      return {IteratorAt(index), false};
+    }
+    keys_.Emplace(IteratorAt(index), std::move(key));
+    index_.Rebuild(keys_);
+    return {IteratorAt(index), true};
+  }
+
+  auto InsertImpl(const ValueType& key) -> std::pair<Iterator, bool> { return InsertImpl(ValueType(key)); }
+
+  /**
+   * @brief Merges the unsorted tail starting at `old_size` into the sorted, unique prefix.
+   */
+  auto SortAndMerge(SizeType old_size) -> void {
+    const Vector<SizeType> order{FlatMergeOrder(keys_, old_size, comp_)};
+    KeyContainer keys{keys_.GetAllocator()};
+    keys.Reserve(order.Size());
+    const auto first{std::ranges::begin(keys_)};
+    for (const SizeType index : order) {
+      keys.EmplaceBack(FlatTake<kIsNothrowMovable>(first[static_cast<DifferenceType>(index)]));
+    }
+    keys_.Swap(keys);
+    index_.Rebuild(keys_);
+  }
+
+  KeyContainer keys_;
+  Index index_;
+  [[no_unique_address]] Compare comp_;
+};
+
+/**
+ * @brief Ordered map with unique keys, keys and mapped values live sorted in two parallel containers.
+ * @class
+ *
+ * @tparam Key Key type
+ * @tparam T Mapped type
+ * @tparam Compare Strict weak ordering of keys, lookups by other key types are enabled when it defines
+ * `is_transparent`
+ * @tparam KeyContainer Sorted key storage, see `IsFlatContainer`
+ * @tparam MappedContainer Mapped value storage, element `i` belongs to key `i`
+ * @tparam Layout `FlatSortedLayout` or `FlatEytzingerLayout`
+ *
+ * @details Lookups only touch the dense key array; iterators dereference to `std::pair<const Key&, T&>` proxies.
+ * Same complexity as `FlatSet`: O(log n) lookups, O(n) single modifications, one-pass batched `InsertRange`.
+ *
+ * @note Iterators are invalidated by every insertion and erasure.
+ */
+template<
+  typename Key,
+  typename T,
+  typename Compare = std::less<Key>,
+  IsFlatContainer KeyContainer = Vector<Key>,
+  IsFlatContainer MappedContainer = Vector<T>,
+  IsFlatLayout Layout = FlatSortedLayout>
+class [[nodiscard]] FlatMap {
+  friend detail::IndexIterator<false, FlatMap>;
+  friend detail::IndexIterator<true, FlatMap>;
+
+  using Index = FlatSearchIndex<std::same_as<Layout, FlatEytzingerLayout>, KeyContainer>;
+  static constexpr bool kIsTransparent{requires { typename Compare::is_transparent; }};
+  static constexpr bool kIsNothrowMovable{
+    std::is_nothrow_move_constructible_v<Key> && std::is_nothrow_move_constructible_v<T>
+  };
+
+ public:
+  using KeyType = Key;
+  using key_type = Key;
+  using MappedType = T;
+  using mapped_type = T;
+  using ValueType = std::pair<Key, T>;
+  using value_type = ValueType;
+  using KeyCompare = Compare;
+  using key_compare = Compare;
+  using Reference = std::pair<const Key&, T&>;
+  using reference = Reference;
+  using ConstReference = std::pair<const Key&, const T&>;
+  using const_reference = ConstReference;
+  using SizeType = std::size_t;
+  using size_type = std::size_t;
+  using DifferenceType = std::ptrdiff_t;
+  using difference_type = std::ptrdiff_t;
+  using KeyContainerType = KeyContainer;
+  using key_container_type = KeyContainer;
+  using MappedContainerType = MappedContainer;
+  using mapped_container_type = MappedContainer;
+  using LayoutType = Layout;
+  using Iterator = detail::IndexIterator<false, FlatMap>;
+  using iterator = Iterator;
+  using ConstIterator = detail::IndexIterator<true, FlatMap>;
+  using const_iterator = ConstIterator;
+
+  FlatMap() = default;
+
+  explicit FlatMap(const Compare& comp)
+    : comp_{comp} { }
+
+  /**
+   * @brief Adopts the parallel `keys` and `values`, sorting them and dropping duplicate keys (the first one wins).
+   * @public
+   *
+   * @warning **Undefined Behaviour** if:
+   * - `keys.Size() != values.Size()`
+   */
+  FlatMap(
+    KeyContainer keys,  //
+    MappedContainer values,
+    const Compare& comp = Compare{}
+  )
+    : index_{keys}
+    , comp_{comp} {
+    assert(keys.Size() == values.Size());
+    keys_.Swap(keys);
+    values_.Swap(values);
+    SortAndMerge(0);
+  }
+
+  template<std::input_iterator InputIterator, std::sentinel_for<InputIterator> Sentinel>
+  FlatMap(
+    InputIterator first,  //
+    Sentinel last,
+    const Compare& comp = Compare{}
+  )
+    : comp_{comp} {
+    InsertRange(std::ranges::subrange{std::move(first), std::move(last)});
+  }
+
+  FlatMap(
+    std::initializer_list<ValueType> ilist,  //
+    const Compare& comp = Compare{}
+  )
+    : comp_{comp} {
+    InsertRange(ilist);
+  }
+
+  [[nodiscard]] auto begin() noexcept -> Iterator { return Iterator{this, 0}; }
+
+  [[nodiscard]] auto begin() const noexcept -> ConstIterator { return ConstIterator{this, 0}; }
+
+  [[nodiscard]] auto end() noexcept -> Iterator { return Iterator{this, Size()}; }
+
+  [[nodiscard]] auto end() const noexcept -> ConstIterator { return ConstIterator{this, Size()}; }
+
+  [[nodiscard]] auto cbegin() const noexcept -> ConstIterator { return begin(); }
+
+  [[nodiscard]] auto cend() const noexcept -> ConstIterator { return end(); }
+
+  [[nodiscard]] auto Size() const noexcept -> SizeType { return keys_.Size(); }
+
+  [[nodiscard]] auto Empty() const noexcept -> bool { return Size() == 0; }
+
+  [[nodiscard]] auto KeyComp() const -> KeyCompare { return comp_; }
+
+  /**
+   * @brief Sorted keys.
+   */
+  [[nodiscard]] auto Keys() const noexcept -> const KeyContainer& { return keys_; }
+
+  /**
+   * @brief Mapped values in key order.
+   */
+  [[nodiscard]] auto Values() const noexcept -> const MappedContainer& { return values_; }
+
+  [[nodiscard]] auto LowerBound(const KeyType& key) -> Iterator { return Iterator{this, LowerBoundIndex(key)}; }
+
+  [[nodiscard]] auto LowerBound(const KeyType& key) const -> ConstIterator {
+    return ConstIterator{this, LowerBoundIndex(key)};
+  }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto LowerBound(const K& key) -> Iterator {
+    return Iterator{this, LowerBoundIndex(key)};
+  }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto LowerBound(const K& key) const -> ConstIterator {
+    return ConstIterator{this, LowerBoundIndex(key)};
+  }
+
+  [[nodiscard]] auto Find(const KeyType& key) -> Iterator { return Iterator{this, FindIndex(key)}; }
+
+  [[nodiscard]] auto Find(const KeyType& key) const -> ConstIterator { return ConstIterator{this, FindIndex(key)}; }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto Find(const K& key) -> Iterator {
+    return Iterator{this, FindIndex(key)};
+  }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto Find(const K& key) const -> ConstIterator {
+    return ConstIterator{this, FindIndex(key)};
+  }
+
+  [[nodiscard]] auto Contains(const KeyType& key) const -> bool { return FindIndex(key) != Size(); }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto Contains(const K& key) const -> bool {
+    return FindIndex(key) != Size();
+  }
+
+  [[nodiscard]] auto Count(const KeyType& key) const -> SizeType { return Contains(key) ? 1 : 0; }
+
+  template<typename K>
+    requires kIsTransparent
+  [[nodiscard]] auto Count(const K& key) const -> SizeType {
+    return Contains(key) ? 1 : 0;
+  }
+
+  /**
+   * @brief Returns the value mapped to `key`.
+   * @public
+   *
+   * @throws `std::out_of_range` if there is no such key.
+   */
+  [[nodiscard]] auto At(const KeyType& key) -> MappedType& { return MappedAt(AtIndex(key)); }
+
+  [[nodiscard]] auto At(const KeyType& key) const -> const MappedType& { return MappedAt(AtIndex(key)); }
+
+  auto operator[](const KeyType& key) -> MappedType& { return (*TryEmplace(key).first).second; }
+
+  auto operator[](KeyType&& key) -> MappedType& { return (*TryEmplace(std::move(key)).first).second; }
+
+  /**
+   * @brief Inserts `value` unless an equivalent key is present.
+   * @public
+   *
+   * @return `std::pair` of an `Iterator` to the element with the key and whether `value` was inserted.
+   */
+  auto Insert(const ValueType& value) -> std::pair<Iterator, bool> { return TryEmplace(value.first, value.second); }
+
+  auto Insert(ValueType&& value) -> std::pair<Iterator, bool> {
+    return TryEmplace(std::move(value.first), std::move(value.second));
+  }
+
+  template<typename... Args>
+    requires std::constructible_from<ValueType, Args&&...>
+  auto Emplace(Args&&... args) -> std::pair<Iterator, bool> {
+    return Insert(ValueType(std::forward<Args>(args)...));
+  }
+
+  /**
+   * @brief Constructs the mapped value from `args` only if `key` is not present.
+   * @public
+   */
+  template<typename... Args>
+  auto TryEmplace(
+    const KeyType& key,  //
+    Args&&... args
+  ) -> std::pair<Iterator, bool> {
+    return TryEmplaceImpl(key, std::forward<Args>(args)...);
+  }
+
+  template<typename... Args>
+  auto TryEmplace(
+    KeyType&& key,  //
+    Args&&... args
+  ) -> std::pair<Iterator, bool> {
+    return TryEmplaceImpl(std::move(key), std::forward<Args>(args)...);
+  }
+
+  template<typename M>
+    requires std::assignable_from<MappedType&, M&&>
+  auto InsertOrAssign(
+    const KeyType& key,  //
+    M&& mapped
+  ) -> std::pair<Iterator, bool> {
+    auto result{TryEmplace(key, std::forward<M>(mapped))};
+    if (!result.second) {
+      (*result.first).second = std::forward<M>(mapped);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Inserts the elements of `range` whose keys are not present yet.
+   * @public
+   *
+   * @details Appends the batch to both containers, stable sorts it through an index permutation and merges it with
+   * the existing elements in a single pass. Elements already in the map win over new ones with equivalent keys,
+   * otherwise the first of them is kept. Strong exception guarantee.
+   */
+  template<std::ranges::input_range Range>
+    requires requires(std::ranges::range_reference_t<Range> value) {
+      KeyType(std::get<0>(std::forward<decltype(value)>(value)));
+      MappedType(std::get<1>(std::forward<decltype(value)>(value)));
+    }
+  auto InsertRange(Range&& range) -> void {
+    const SizeType old_size{Size()};
+    LAB_TRY {
+      if constexpr (std::ranges::sized_range<Range>) {
+        const SizeType n{old_size + static_cast<SizeType>(std::ranges::size(range))};
+        keys_.Reserve(n);
+        values_.Reserve(n);
+      }
+      for (auto&& value : range) {
+        keys_.EmplaceBack(std::get<0>(std::forward<decltype(value)>(value)));
+        LAB_TRY {
+          values_.EmplaceBack(std::get<1>(std::forward<decltype(value)>(value)));
+        }
+        LAB_CATCH(...) {
+          keys_.Erase(KeyIterator(Size() - 1));
+          LAB_PROPAGATE_EXCEPTION;
+        }
+      }
+      if (Size() != old_size) {
+        SortAndMerge(old_size);
+      }
+    }
+    LAB_CATCH(...) {
+      keys_.Erase(KeyIterator(old_size), std::ranges::end(std::as_const(keys_)));
+      values_.Erase(MappedIterator(old_size), std::ranges::end(std::as_const(values_)));
+      LAB_PROPAGATE_EXCEPTION;
+    }
+  }
+
+  auto InsertRange(std::initializer_list<ValueType> ilist) -> void { InsertRange(std::views::all(ilist)); }
+
+  auto Erase(ConstIterator position) -> Iterator {
+    const SizeType index{position.index_};
+    keys_.Erase(KeyIterator(index));
+    values_.Erase(MappedIterator(index));
+    index_.Rebuild(keys_);
+    return Iterator{this, index};
+  }
+
+  auto Erase(Iterator position) -> Iterator { return Erase(ConstIterator{position}); }
+
+  auto Erase(const KeyType& key) -> SizeType {
+    const SizeType index{FindIndex(key)};
+    if (index == Size()) {
+      return 0;
+    }
+    Erase(ConstIterator{this, index});
+    return 1;
+  }
+
+  auto Clear() noexcept -> void {
+    keys_.Clear();
+    values_.Clear();
+    index_.Clear();
+  }
+
+  auto Reserve(SizeType n) -> void {
+    keys_.Reserve(n);
+    values_.Reserve(n);
+  }
+
+  auto Swap(FlatMap& other) noexcept -> void {
+    keys_.Swap(other.keys_);
+    values_.Swap(other.values_);
+    index_.Swap(other.index_);
+    std::swap(comp_, other.comp_);
+  }
+
+  [[nodiscard]] friend auto operator==(
+    const FlatMap& lhs,  //
+    const FlatMap& rhs
+  ) -> bool
+    requires std::equality_comparable<KeyType> && std::equality_comparable<MappedType>
+  {
+    return std::ranges::equal(lhs.keys_, rhs.keys_) && std::ranges::equal(lhs.values_, rhs.values_);
+  }
+
+ private:
+  [[nodiscard]] auto ReferenceAt(SizeType index) noexcept -> Reference {
+    return Reference{KeyAt(index), MappedAt(index)};
+  }
+
+  [[nodiscard]] auto ReferenceAt(SizeType index) const noexcept -> ConstReference {
+    return ConstReference{KeyAt(index), MappedAt(index)};
+  }
+
+  [[nodiscard]] auto KeyIterator(SizeType index) const noexcept {
+    return std::ranges::begin(keys_) + static_cast<DifferenceType>(index);
+  }
+
+  [[nodiscard]] auto MappedIterator(SizeType index) const noexcept {
+    return std::ranges::begin(values_) + static_cast<DifferenceType>(index);
+  }
+
+  [[nodiscard]] auto KeyAt(SizeType index) const noexcept -> const KeyType& { return *KeyIterator(index); }
+
+  [[nodiscard]] auto MappedAt(SizeType index) noexcept -> MappedType& {
+    return std::ranges::begin(values_)[static_cast<DifferenceType>(index)];
+  }
+
+  [[nodiscard]] auto MappedAt(SizeType index) const noexcept -> const MappedType& {
+    return std::ranges::begin(values_)[static_cast<DifferenceType>(index)];
+  }
+
+  template<typename K>
+  [[nodiscard]] auto LowerBoundIndex(const K& key) const -> SizeType {
+    return index_.LowerBound(keys_, key, comp_);
+  }
+
+  /**
+   * @brief Position of the key equivalent to `key`, or `Size()`.
+   */
+  template<typename K>
+  [[nodiscard]] auto FindIndex(const K& key) const -> SizeType {
+    const SizeType index{LowerBoundIndex(key)};
+    return index != Size() && !comp_(key, KeyAt(index)) ? index : Size();
+  }
+
+  [[nodiscard]] auto AtIndex(const KeyType& key) const -> SizeType {
+    const SizeType index{FindIndex(key)};
+    if (index == Size()) {
+      throw std::out_of_range{"FlatMap::At: key not found"};
+    }
+    return index;
+  }
+
+  template<typename K, typename... Args>
+  auto TryEmplaceImpl(
+    K&& key,  //
+    Args&&... args
+  ) -> std::pair<Iterator, bool> {
+    const SizeType index{LowerBoundIndex(key)};
+    if (index != Size() && !comp_(key, KeyAt(index))) {
+      return {Iterator{this, index}, false};
+    }
+    keys_.Emplace(KeyIterator(index), std::forward<K>(key));
+    LAB_TRY {
+      values_.Emplace(MappedIterator(index), std::forward<Args>(args)...);
+    }
+    LAB_CATCH(...) {
+      keys_.Erase(KeyIterator(index));
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    index_.Rebuild(keys_);
+    return {Iterator{this, index}, true};
+  }
+
+  /**
+   * @brief Merges the unsorted tail starting at `old_size` into the sorted, unique prefix of both containers.
+   *
+   * @details Elements are moved into the merged containers only if neither move can throw, otherwise copied, so the
+   * old containers are intact until the final swap.
+   */
+  auto SortAndMerge(SizeType old_size) -> void {
+    const Vector<SizeType> order{FlatMergeOrder(keys_, old_size, comp_)};
+    KeyContainer keys{keys_.GetAllocator()};
+    MappedContainer values{values_.GetAllocator()};
+    keys.Reserve(order.Size());
+    values.Reserve(order.Size());
+    const auto first_key{std::ranges::begin(keys_)};
+    const auto first_value{std::ranges::begin(values_)};
+    for (const SizeType index : order) {
+      keys.EmplaceBack(FlatTake<kIsNothrowMovable>(first_key[static_cast<DifferenceType>(index)]));
+      values.EmplaceBack(FlatTake<kIsNothrowMovable>(first_value[static_cast<DifferenceType>(index)]));
+    }
+    keys_.Swap(keys);
+    values_.Swap(values);
+    index_.Rebuild(keys_);
+  }
+
+  KeyContainer keys_;
+  MappedContainer values_;
+  Index index_;
+  [[no_unique_address]] Compare comp_;
+};
+
+}  // namespace lab
+
+END_EXPORT_SECTION
@@ -2,11 +2,14 @@ module;
 
 #include <cassert>
 #include <concepts>
+#include <cstddef>
 #include <exception>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <iterator>
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <tpu/helper_macros.hpp>
 #include <tpu/modules/module_helper_macros.hpp>
@@ -15,6 +18,8 @@ module;
 
 export module lab_forward_list;
 
+export import lab_instrumentation;
+
 /**
  * @brief Concept for type validation
  * @internal
@@ -33,6 +38,15 @@ concept IsValidForwardListAllocatorType =
   IsValidForwardListType<typename std::allocator_traits<Allocator>::value_type> &&
   std::same_as<typename std::allocator_traits<Allocator>::value_type, T>;
 
+/**
+ * @brief Internal link type for single-linked list (before-begin sentinel and base of every node)
+ * @internal
+ * @struct
+ */
+struct ForwardListNodeBase {
+  ForwardListNodeBase* next_{nullptr};
+};
+
 /**
  * @brief Internal node type for single-linked list
  * @internal
@@ -41,14 +55,41 @@ concept IsValidForwardListAllocatorType =
  * @tparam T Value type to store in node
  */
 template<typename T>
-struct [[nodiscard]] ForwardListNode final {
+struct [[nodiscard]] ForwardListNode final : ForwardListNodeBase {
   constexpr explicit ForwardListNode(auto&&... args) noexcept(std::is_nothrow_constructible_v<T, decltype(args)...>)
     : value_(std::forward<decltype(args)>(args)...) { }
 
-  ForwardListNode* next_{nullptr};
   T value_{};
 };
 
+/**
+ * @brief Nodes `ForEachBatched` runs ahead of the visited one by default.
+ * @internal
+ */
+inline constexpr std::size_t kForwardListPrefetchDistance{8};
+
+/**
+ * @brief Cache line size assumed when prefetching whole nodes.
+ * @internal
+ */
+inline constexpr std::size_t kForwardListCacheLineSize{64};
+
+/**
+ * @brief Prefetches every cache line of the `bytes` long object at `address`.
+ * @internal
+ */
+constexpr auto ForwardListPrefetch(
+  const void* address,  //
+  std::size_t bytes
+) noexcept -> void {
+  if !consteval {
+    const auto* first{static_cast<const std::byte*>(address)};
+    for (std::size_t offset{}; offset < bytes; offset += kForwardListCacheLineSize) {
+      __builtin_prefetch(first + offset);
+    }
+  }
+}
+
 /**
  * @brief Iterator base for ForwardList (for const and non-const)
  * @internal
@@ -61,7 +102,7 @@ template<bool IsConst, typename ForwardList>
 class ForwardListIteratorBase final {
   friend ForwardList;
   friend ForwardListIteratorBase<!IsConst, ForwardList>;
-  using NodePointer = ForwardList::NodePointer;
+  using LinkPointer = ForwardList::LinkPointer;
 
  public:
   using ValueType = ForwardList::ValueType;
@@ -78,20 +119,7 @@ class ForwardListIteratorBase final {
   constexpr ForwardListIteratorBase() noexcept = default;
 
  private:
-  constexpr ForwardListIteratorBase(NodePointer node) noexcept : current_{node} { }
-
-  template<bool IsConstLhs, bool IsConstRhs>
-  static constexpr auto Bind(
-    ForwardListIteratorBase<IsConstLhs, ForwardList> a,  //
-    ForwardListIteratorBase<IsConstRhs, ForwardList>& b
-  ) noexcept -> void {
-    if (a.current_ != nullptr) {
-      b.current_->next_ = a.current_->next_;
-      a.current_->next_ = b.current_;
-      return;
-    }
-    a.current_->next_ = b.current_;
-  }
+  constexpr ForwardListIteratorBase(LinkPointer node) noexcept : current_{node} { }
 
  public:
   constexpr ForwardListIteratorBase(const ForwardListIteratorBase<!IsConst, ForwardList> other) noexcept
@@ -99,12 +127,12 @@ class ForwardListIteratorBase final {
 
   constexpr auto operator*() const noexcept -> Reference {
     assert(current_);
-    return current_->value_;
+    return ForwardList::ValueOf(current_);
   }
 
   constexpr auto operator->() const noexcept -> Pointer {
     assert(current_);
-    return &current_->value_;
+    return &ForwardList::ValueOf(current_);
   }
 
   constexpr auto operator++() noexcept -> ForwardListIteratorBase& {
@@ -135,7 +163,7 @@ class ForwardListIteratorBase final {
   }
 
  private:
-  NodePointer current_{nullptr};
+  LinkPointer current_{nullptr};
 };
 
 START_EXPORT_SECTION
@@ -146,22 +174,104 @@ START_EXPORT_SECTION
  */
 namespace lab::containers {
 
+/**
+ * @brief Concept for allocators that can drop every node they handed out at once
+ * @concept CanReleaseAllNodes
+ *
+ * @details `allocator.IsUnique()` reports that no other allocator shares the storage and `allocator.Release()`
+ * returns all of it (e.g. `lab::NodePool` or arena allocators) without per-node deallocation.
+ */
+template<typename Allocator>
+concept CanReleaseAllNodes = requires(Allocator& allocator, const Allocator& const_allocator) {
+  allocator.Release();
+  { const_allocator.IsUnique() } -> std::convertible_to<bool>;
+};
+
+/**
+ * @brief Concept for size tracking policies of node based containers
+ * @concept IsSizePolicy
+ *
+ * @details `kIsTracked` enables O(1) `Size()` of the container, `Add`/`Subtract` are called on every
+ * insertion/erasure.
+ */
+template<typename Policy>
+concept IsSizePolicy = std::semiregular<Policy> && requires(Policy& policy, const Policy& const_policy, std::size_t n) {
+  { Policy::kIsTracked } -> std::convertible_to<bool>;
+  policy.Add(n);
+  policy.Subtract(n);
+  { const_policy.Get() } -> std::same_as<std::size_t>;
+};
+
+/**
+ * @brief Size policy without any bookkeeping (default), containers do not provide `Size()`.
+ * @struct
+ */
+struct UntrackedSize final {
+  static constexpr bool kIsTracked{false};
+
+  constexpr auto Add(std::size_t /* n */) noexcept -> void { }
+
+  constexpr auto Subtract(std::size_t /* n */) noexcept -> void { }
+
+  [[nodiscard]] constexpr auto Get() const noexcept -> std::size_t { return 0; }
+};
+
+/**
+ * @brief Size policy storing element count next to the head pointer, containers provide O(1) `Size()`.
+ * @struct
+ */
+struct TrackedSize final {
+  static constexpr bool kIsTracked{true};
+
+  constexpr auto Add(std::size_t n) noexcept -> void { size_ += n; }
+
+  constexpr auto Subtract(std::size_t n) noexcept -> void {
+    assert(size_ >= n);
+    size_ -= n;
+  }
+
+  [[nodiscard]] constexpr auto Get() const noexcept -> std::size_t { return size_; }
+
+  std::size_t size_{};
+};
+
 /**
  * @brief Class that represents singly-linked list
  * @class
  *
  * @tparam T Value type to store in container
  * @tparam Allocator Allocator type to use in container
+ * @tparam SizePolicy Size tracking policy (`UntrackedSize` or `TrackedSize`)
+ * @tparam Observer Node event observer, see `IsContainerObserver`; the default `NullObserver` costs nothing
  *
- * @note `ForwardList` accepts stateless allocator types.
+ * @details Stateful allocators are stored and honour `propagate_on_container_copy_assignment`,
+ * `propagate_on_container_move_assignment` and `propagate_on_container_swap`.
  */
-template<IsValidForwardListType T, IsValidForwardListAllocatorType<T> Allocator = std::allocator<T>>
+template<
+  IsValidForwardListType T,
+  IsValidForwardListAllocatorType<T> Allocator = std::allocator<T>,
+  IsSizePolicy SizePolicy = UntrackedSize,
+  IsContainerObserver Observer = NullObserver>
 class [[nodiscard]] ForwardList {
-  friend ForwardListIteratorBase<true, ForwardList<T, Allocator>>;
-  friend ForwardListIteratorBase<false, ForwardList<T, Allocator>>;
+  friend ForwardListIteratorBase<true, ForwardList<T, Allocator, SizePolicy, Observer>>;
+  friend ForwardListIteratorBase<false, ForwardList<T, Allocator, SizePolicy, Observer>>;
   using InternalAllocatorType = std::allocator_traits<Allocator>::template rebind_alloc<ForwardListNode<T>>;
   using AllocatorTraits = std::allocator_traits<InternalAllocatorType>;
   using NodePointer = ForwardListNode<T>*;
+  static constexpr bool kPropagatesOnCopyAssignment{AllocatorTraits::propagate_on_container_copy_assignment::value};
+  static constexpr bool kPropagatesOnMoveAssignment{AllocatorTraits::propagate_on_container_move_assignment::value};
+  static constexpr bool kIsAllocatorAlwaysEqual{AllocatorTraits::is_always_equal::value};
+  using LinkPointer = ForwardListNodeBase*;
+
+  /**
+   * @brief Provides access to the value of the node behind `link`.
+   * @private
+   * @internal
+   */
+  [[nodiscard]] static constexpr auto ValueOf(LinkPointer link) noexcept -> T& {
+    assert(link);
+    return static_cast<NodePointer>(link)->value_;
+  }
 
  public:
   using ValueType = T;
@@ -180,10 +290,12 @@ class [[nodiscard]] ForwardList {
   using size_type = AllocatorTraits::size_type;
   using DifferenceType = AllocatorTraits::difference_type;
   using difference_type = AllocatorTraits::difference_type;
-  using Iterator = ForwardListIteratorBase<false, ForwardList<T, Allocator>>;
+  using Iterator = ForwardListIteratorBase<false, ForwardList<T, Allocator, SizePolicy, Observer>>;
   using iterator = Iterator;
-  using ConstIterator = ForwardListIteratorBase<true, ForwardList<T, Allocator>>;
+  using ConstIterator = ForwardListIteratorBase<true, ForwardList<T, Allocator, SizePolicy, Observer>>;
   using const_iterator = ConstIterator;
+  using SizePolicyType = SizePolicy;
+  using ObserverType = Observer;
 
   /**
    * @brief Default constructor for `ForwardList`.
@@ -193,17 +305,15 @@ class [[nodiscard]] ForwardList {
    *
    * @details This constructor is defaulted.
    */
-  constexpr ForwardList() noexcept = default;
+  constexpr ForwardList() noexcept(std::is_nothrow_default_constructible_v<AllocatorType>) = default;
 
   /**
-   * @brief Constructs `ForwardList` with allocator by deducing it's type.
+   * @brief Constructs empty `ForwardList` that allocates its nodes with `allocator`.
    * @public
    *
    * @throws None (no-throw guarantee).
-   *
-   * @details This constructor ignores `allocator` and only deduces it's type.
    */
-  constexpr explicit ForwardList([[maybe_unused]] const Allocator& allocator) noexcept { }
+  constexpr explicit ForwardList(const Allocator& allocator) noexcept : allocator_{allocator} { }
 
   /**
    * @brief Copy constructor for `ForwardList`.
@@ -225,8 +335,10 @@ class [[nodiscard]] ForwardList {
    * @throws None (no-throw guarantee).
    */
   constexpr ForwardList(ForwardList&& other) noexcept
-    : head_{std::exchange(other.head_, nullptr)}  //
-    , allocator_{std::move(other.allocator_)} { }
+    : before_head_{std::exchange(other.before_head_.next_, nullptr)}  //
+    , allocator_{std::move(other.allocator_)}
+    , size_{std::exchange(other.size_, SizePolicy{})}
+    , observer_{std::exchange(other.observer_, Observer{})} { }
 
   /**
    * @brief Parametrisized constructor for `count` default constructed elements for `ForwardList`.
@@ -234,12 +346,45 @@ class [[nodiscard]] ForwardList {
    *
    * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
    *
-   * @details This constructor ignores `allocator` and only deduces it's type.
    */
   constexpr explicit ForwardList(
     SizeType count,  //
-    [[maybe_unused]] const Allocator& allocator = Allocator{}
-  ) { }
+    const Allocator& allocator = Allocator{}
+  )
+    : allocator_{allocator} {
+    LinkPointer traverser{&before_head_};
+    LAB_TRY {
+      for (; count; --count) {
+        traverser->next_ = ConstructNode();
+        traverser = traverser->next_;
+      }
+    }
+    LAB_CATCH(...) {
+      Clear();
+      LAB_PROPAGATE_EXCEPTION;
+    }
+  }
+
+  /**
+   * @brief Move constructor for `ForwardList` with explicit allocator.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @details Steals the nodes of `other` when the allocators compare equal, otherwise moves its elements one by one.
+   */
+  constexpr ForwardList(
+    ForwardList&& other,  //
+    const Allocator& allocator
+  )
+    : allocator_{allocator} {
+    if (kIsAllocatorAlwaysEqual || allocator_ == other.allocator_) {
+      StealNodes(other);
+      return;
+    }
+    observer_ = other.observer_;
+    AssignToEmpty(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+  }
 
   /**
    * @brief Parametrisized constructor `Range` like types for `ForwardList`.
@@ -251,26 +396,10 @@ class [[nodiscard]] ForwardList {
   constexpr ForwardList(
     InputIterator first,  //
     InputIterator last,
-    [[maybe_unused]] const Allocator& allocator = Allocator{}
-  ) {
-    if (first == last) {
-      return;
-    }
-
-    head_ = ConstructNode(*first++);
-    NodePointer traverser{head_};
-
-    while (first != last) {
-      LAB_TRY {
-        NodePointer temp{ConstructNode(*first++)};
-        traverser->next_ = temp;
-        traverser = temp;
-      }
-      LAB_CATCH(...) {
-        Clear();
-        LAB_PROPAGATE_EXCEPTION;
-      }
-    }
+    const Allocator& allocator = Allocator{}
+  )
+    : allocator_{allocator} {
+    AssignToEmpty(std::move(first), std::move(last));
   }
 
   /**
@@ -278,12 +407,10 @@ class [[nodiscard]] ForwardList {
    * @public
    *
    * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
-   *
-   * @details This constructor ignores `allocator` and only deduces it's type.
    */
   constexpr explicit ForwardList(
     std::initializer_list<ValueType> ilist,  //
-    [[maybe_unused]] const Allocator& allocator = Allocator{}
+    const Allocator& allocator = Allocator{}
   )
     : ForwardList{ilist.begin(), ilist.end(), allocator} { }
 
@@ -297,13 +424,41 @@ class [[nodiscard]] ForwardList {
    */
   constexpr ~ForwardList() { DeleteRange(); }
 
+  /**
+   * @brief Returns `Iterator` to the position before the first element.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @details The iterator is only valid as `position` argument of `*After` methods and for incrementing.
+   */
+  [[nodiscard]] constexpr auto BeforeBegin() noexcept -> Iterator { return {&before_head_}; }
+
+  /**
+   * @brief Returns `ConstIterator` to the position before the first element.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto BeforeBegin() const noexcept -> ConstIterator {
+    return {const_cast<LinkPointer>(&before_head_)};
+  }
+
+  /**
+   * @brief Returns `ConstIterator` to the position before the first element.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto CBeforeBegin() const noexcept -> ConstIterator { return BeforeBegin(); }
+
   /**
    * @brief Returns `Iterator` to the beginning of the sequence.
    * @public
    *
    * @throws None (no-throw guarantee).
    */
-  [[nodiscard]] constexpr auto begin() noexcept -> Iterator { return {head_}; }
+  [[nodiscard]] constexpr auto begin() noexcept -> Iterator { return {before_head_.next_}; }
 
   /**
    * @brief Returns `Iterator` to the end of the sequence.
@@ -319,7 +474,23 @@ class [[nodiscard]] ForwardList {
    *
    * @throws None (no-throw guarantee).
    */
-  [[nodiscard]] constexpr auto cbegin() const noexcept -> ConstIterator { return {head_}; }
+  [[nodiscard]] constexpr auto begin() const noexcept -> ConstIterator { return {before_head_.next_}; }
+
+  /**
+   * @brief Returns `ConstIterator` to the end of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto end() const noexcept -> ConstIterator { return {}; }
+
+  /**
+   * @brief Returns `ConstIterator` to the beginning of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> ConstIterator { return {before_head_.next_}; }
 
   /**
    * @brief Returns `ConstIterator` to the end of the sequence.
@@ -337,10 +508,7 @@ class [[nodiscard]] ForwardList {
    *
    * @return `Reference` to the first element.
    */
-  [[nodiscard]] constexpr auto Front() noexcept -> Reference {
-    assert(head_);
-    return head_->value_;
-  }
+  [[nodiscard]] constexpr auto Front() noexcept -> Reference { return ValueOf(before_head_.next_); }
 
   /**
    * @brief Provides access to the first element of the sequence (const overload).
@@ -354,10 +522,7 @@ class [[nodiscard]] ForwardList {
    *   - `Empty() == true`
    * @see Empty
    */
-  [[nodiscard]] constexpr auto Front() const noexcept -> ConstReference {
-    assert(head_);
-    return head_->value_;
-  }
+  [[nodiscard]] constexpr auto Front() const noexcept -> ConstReference { return ValueOf(before_head_.next_); }
 
   /**
    * @brief Provides the ability to check underlying container state.
@@ -367,7 +532,21 @@ class [[nodiscard]] ForwardList {
    *
    * @return `true` if container is empty, `false` otherwise.
    */
-  [[nodiscard]] constexpr auto Empty() const noexcept -> bool { return !head_; }
+  [[nodiscard]] constexpr auto Empty() const noexcept -> bool { return !before_head_.next_; }
+
+  /**
+   * @brief Returns amount of elements in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @details Only available with `TrackedSize` (or another tracking) size policy.
+   */
+  [[nodiscard]] constexpr auto Size() const noexcept -> SizeType
+    requires(SizePolicy::kIsTracked)
+  {
+    return size_.Get();
+  }
 
   /**
    * @brief Provides the access of allocator type used by the contianer.
@@ -379,6 +558,16 @@ class [[nodiscard]] ForwardList {
    */
   [[nodiscard]] constexpr auto GetAllocator() const noexcept -> AllocatorType { return allocator_; }
 
+  /**
+   * @brief Provides access to the node event observer.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto GetObserver() noexcept -> ObserverType& { return observer_; }
+
+  [[nodiscard]] constexpr auto GetObserver() const noexcept -> const ObserverType& { return observer_; }
+
   /**
    * @brief Returns theoretical maximum size of the container.
    * @public
@@ -408,18 +597,24 @@ class [[nodiscard]] ForwardList {
    * @return `NodePointer` Pointer to the new constructed node.
    *
    * @details Delegates allocation/construct and deallocation/destroy operations to `std::allocator_traits`.
+   * The constructed node is accounted by the size policy, the caller links it right away.
    */
   constexpr auto ConstructNode(auto&&... args) -> NodePointer {
     NodePointer temp{AllocatorTraits::allocate(allocator_, 1)};
     LAB_TRY { AllocatorTraits::construct(allocator_, temp, std::forward<decltype(args)>(args)...); }
-    LAB_CATCH(...) { AllocatorTraits::deallocate(allocator_, temp, 1); }
+    LAB_CATCH(...) {
+      AllocatorTraits::deallocate(allocator_, temp, 1);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    size_.Add(1);
+    observer_.OnNodeAllocate(sizeof(ForwardListNode<T>));
     return temp;
   }
 
   constexpr auto SetHead(NodePointer node) noexcept -> void {
     assert(node);
-    node->next_ = head_;
-    head_ = node;
+    node->next_ = before_head_.next_;
+    before_head_.next_ = node;
   }
 
  public:
@@ -458,38 +653,62 @@ class [[nodiscard]] ForwardList {
 
  private:
   /**
-   * @brief Inserts the element at the beginning of the sequence.
+   * @brief Returns the link following `position`.
    * @private
    * @internal
    *
-   * @details Delegates pointer binding to the `ConstIterator::Bind`
+   * @details `cend()` is accepted as an alias of `BeforeBegin()`.
    */
-  constexpr auto InsertAfterImpl(ConstIterator position, auto&& value) -> Iterator {
-    Iterator temp{ConstructNode(std::forward<decltype(value)>(value))};
-    if (position != cend()) {
-      ConstIterator::Bind(position, temp);
-      return temp;
+  [[nodiscard]] constexpr auto NextLink(ConstIterator position) noexcept -> LinkPointer& {
+    return position == cend() ? before_head_.next_ : position.current_->next_;
+  }
+
+  /**
+   * @brief Returns the last node of the sequence starting at `node` in O(n).
+   * @private
+   * @internal
+   */
+  [[nodiscard]] static constexpr auto FindTail(LinkPointer node) noexcept -> LinkPointer {
+    assert(node);
+    while (node->next_) {
+      node = node->next_;
     }
-    head_ = temp.current_;
-    return temp;
+    return node;
+  }
+
+  /**
+   * @brief Inserts the element after `position`.
+   * @private
+   * @internal
+   */
+  constexpr auto InsertAfterImpl(ConstIterator position, auto&& value) -> Iterator {
+    LinkPointer& link{NextLink(position)};
+    NodePointer temp{ConstructNode(std::forward<decltype(value)>(value))};
+    temp->next_ = link;
+    link = temp;
+    return {temp};
   }
 
  public:
   /**
-   * @brief Inserts the element at the beginning of the sequence by copy constructing.
+   * @brief Inserts the element after `position` by copy constructing.
    * @public
    *
    * @throws `std::bad_alloc` if memory allocation fails or propagates user defined exception.
+   *
+   * @details `BeforeBegin()` (or `cend()`) as `position` inserts at the beginning of the sequence.
    */
   constexpr auto InsertAfter(ConstIterator position, const ValueType& value) -> Iterator {
     return InsertAfterImpl(position, value);
   }
 
   /**
-   * @brief Inserts the element at the beginning of the sequence by move constructing.
+   * @brief Inserts the element after `position` by move constructing.
    * @public
    *
    * @throws `std::bad_alloc` if memory allocation fails or propagates user defined exception.
+   *
+   * @details `BeforeBegin()` (or `cend()`) as `position` inserts at the beginning of the sequence.
    */
   constexpr auto InsertAfter(ConstIterator position, ValueType&& value) -> Iterator {
     return InsertAfterImpl(position, std::move(value));
@@ -503,12 +722,15 @@ class [[nodiscard]] ForwardList {
    *
    * @details Delegates deallocate/destroy to `std::allocator_traits`.
    */
-  constexpr auto DestroyNode(NodePointer node) -> void {
-    assert(node);
+  constexpr auto DestroyNode(LinkPointer link) -> void {
+    assert(link);
+    NodePointer node{static_cast<NodePointer>(link)};
     if constexpr (!std::is_fundamental_v<ValueType>) {
       AllocatorTraits::destroy(allocator_, node);
     }
     AllocatorTraits::deallocate(allocator_, node, 1);
+    size_.Subtract(1);
+    observer_.OnNodeDeallocate(sizeof(ForwardListNode<T>));
   }
 
  public:
@@ -518,22 +740,57 @@ class [[nodiscard]] ForwardList {
    *
    * @throws None (no-throw guarantee).
    *
+   * @details Looks up the predecessor from the beginning in O(n), prefer `EraseAfter` in erase loops.
+   *
    * @warning **Undefined Behaviour** if:
    *   - `position` argument is not in range [`cbegin()`, `cend()`)
-   * @see cbegin, cend
+   * @see cbegin, cend, EraseAfter
    */
   constexpr auto Erase(ConstIterator position) noexcept -> void {
-    assert(head_);
-    if (position == cbegin()) {
-      DestroyNodeFront();
-      return;
-    }
-    NodePointer traverser{head_};
+    assert(before_head_.next_);
+    LinkPointer traverser{&before_head_};
     while (traverser->next_ != position.current_) {
       traverser = traverser->next_;
     }
-    traverser->next_ = position.current_->next_;
-    DestroyNode(position.current_);
+    EraseAfter(ConstIterator{traverser});
+  }
+
+  /**
+   * @brief Erases the element following `position` in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Iterator` to the element following the erased one.
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `position` is not dereferenceable (or `BeforeBegin()`) or has no successor
+   */
+  constexpr auto EraseAfter(ConstIterator position) noexcept -> Iterator {
+    LinkPointer& link{NextLink(position)};
+    LinkPointer erased{link};
+    assert(erased);
+    link = erased->next_;
+    DestroyNode(erased);
+    return {link};
+  }
+
+  /**
+   * @brief Erases elements (`position`, `last`) in O(1) per erased element.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Iterator` to `last`.
+   */
+  constexpr auto EraseAfter(ConstIterator position, ConstIterator last) noexcept -> Iterator {
+    LinkPointer& link{NextLink(position)};
+    while (link != last.current_) {
+      LinkPointer erased{link};
+      link = erased->next_;
+      DestroyNode(erased);
+    }
+    return {last.current_};
   }
 
   /**
@@ -541,13 +798,20 @@ class [[nodiscard]] ForwardList {
    * @public
    *
    * @throws May throw exception if user defined allocator throws when swapping.
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - allocators do not propagate on swap and `GetAllocator() != other.GetAllocator()`
    */
   constexpr auto Swap(ForwardList& other) noexcept(AllocatorTraits::is_always_equal::value) -> void {
     assert(this != &other);
     if constexpr (AllocatorTraits::propagate_on_container_swap::value) {
       std::swap(allocator_, other.allocator_);
+    } else {
+      assert(kIsAllocatorAlwaysEqual || allocator_ == other.allocator_);
     }
-    std::swap(head_, other.head_);
+    std::swap(before_head_.next_, other.before_head_.next_);
+    std::swap(size_, other.size_);
+    std::swap(observer_, other.observer_);
   }
 
  private:
@@ -560,9 +824,9 @@ class [[nodiscard]] ForwardList {
    * @see DestroyNode
    */
   constexpr auto DestroyNodeFront() -> void {
-    assert(head_);
-    NodePointer temp{head_};
-    head_ = head_->next_;
+    assert(before_head_.next_);
+    LinkPointer temp{before_head_.next_};
+    before_head_.next_ = temp->next_;
     DestroyNode(temp);
   }
 
@@ -575,35 +839,493 @@ class [[nodiscard]] ForwardList {
    */
   constexpr auto PopFront() noexcept -> void { DestroyNodeFront(); }
 
+  /**
+   * @brief Sorts the sequence in ascending order (stable) with `compare`.
+   * @public
+   *
+   * @throws Propagates exception thrown by `compare`, the order of elements is unspecified in that case.
+   *
+   * @details Bottom-up merge sort: runs of width 1, 2, 4, ... are merged in place by relinking nodes, so the sort
+   * takes O(n log n) comparisons, O(1) extra space and performs no allocations.
+   */
+  template<typename Compare>
+  constexpr auto Sort(Compare compare) -> void {
+    for (SizeType width{1};; width *= 2) {
+      LinkPointer rest{before_head_.next_};
+      LinkPointer tail{&before_head_};
+      SizeType merges{};
+      while (rest) {
+        ++merges;
+        LinkPointer left{rest};
+        LinkPointer right{rest};
+        SizeType left_size{};
+        while (left_size < width && right) {
+          right = right->next_;
+          ++left_size;
+        }
+        SizeType right_size{width};
+        LAB_TRY {
+          while (left_size > 0 || (right_size > 0 && right)) {
+            if (left_size == 0 || (right_size > 0 && right && compare(ValueOf(right), ValueOf(left)))) {
+              tail->next_ = std::exchange(right, right->next_);
+              --right_size;
+            } else {
+              tail->next_ = std::exchange(left, left->next_);
+              --left_size;
+            }
+            tail = tail->next_;
+          }
+        }
+        LAB_CATCH(...) {
+          // Untaken left run nodes are still chained, relink them in front of the unprocessed rest.
+          tail->next_ = left;
+          while (--left_size > 0) {
+            left = left->next_;
+          }
+          left->next_ = right;
+          LAB_PROPAGATE_EXCEPTION;
+        }
+        rest = right;
+      }
+      tail->next_ = nullptr;
+      if (merges <= 1) {
+        return;
+      }
+    }
+  }
+
+  /**
+   * @brief Sorts the sequence in ascending order (stable) with `operator<`.
+   * @public
+   *
+   * @throws Propagates exception thrown by comparison, the order of elements is unspecified in that case.
+   */
+  constexpr auto Sort() -> void { Sort(std::less<>{}); }
+
+  /**
+   * @brief Merges sorted `other` into the sorted sequence with `compare` by relinking nodes.
+   * @public
+   *
+   * @throws Propagates exception thrown by `compare`, both lists stay valid but partially merged in that case.
+   *
+   * @details Stable, equivalent elements of `*this` precede elements of `other`. `other` becomes empty.
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `GetAllocator() != other.GetAllocator()`
+   */
+  template<typename Compare>
+  constexpr auto Merge(ForwardList& other, Compare compare) -> void {
+    if (this == &other) {
+      return;
+    }
+    assert(allocator_ == other.allocator_);
+    LinkPointer lhs{before_head_.next_};
+    LinkPointer rhs{other.before_head_.next_};
+    LinkPointer tail{&before_head_};
+    SizeType taken_from_other{};
+    LAB_TRY {
+      while (lhs && rhs) {
+        if (compare(ValueOf(rhs), ValueOf(lhs))) {
+          tail->next_ = std::exchange(rhs, rhs->next_);
+          ++taken_from_other;
+        } else {
+          tail->next_ = std::exchange(lhs, lhs->next_);
+        }
+        tail = tail->next_;
+      }
+    }
+    LAB_CATCH(...) {
+      tail->next_ = lhs;
+      other.before_head_.next_ = rhs;
+      size_.Add(taken_from_other);
+      other.size_.Subtract(taken_from_other);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    tail->next_ = lhs ? lhs : rhs;
+    other.before_head_.next_ = nullptr;
+    size_.Add(std::exchange(other.size_, SizePolicy{}).Get());
+  }
+
+  /**
+   * @brief Merges sorted `other` into the sorted sequence with `operator<` by relinking nodes.
+   * @public
+   *
+   * @throws Propagates exception thrown by comparison.
+   */
+  constexpr auto Merge(ForwardList& other) -> void { Merge(other, std::less<>{}); }
+
+  /**
+   * @brief Merges sorted `other` into the sorted sequence with `operator<` by relinking nodes.
+   * @public
+   *
+   * @throws Propagates exception thrown by comparison.
+   */
+  constexpr auto Merge(ForwardList&& other) -> void { Merge(other, std::less<>{}); }
+
+  /**
+   * @brief Moves elements (`before_first`, `tail`] of `other` after `position`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @details O(1) with `UntrackedSize`, the moved range is counted in O(range) with a tracking size policy.
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `tail` is not dereferenceable or does not follow `before_first` in `other`
+   *   - `position` is in the moved range
+   *   - `GetAllocator() != other.GetAllocator()`
+   */
+  constexpr auto SpliceAfter(
+    ConstIterator position,  //
+    ForwardList& other,
+    ConstIterator before_first,
+    ConstIterator tail
+  ) noexcept -> void {
+    assert(tail != other.cend());
+    assert(allocator_ == other.allocator_);
+    LinkPointer& source_link{other.NextLink(before_first)};
+    LinkPointer& destination_link{NextLink(position)};
+    if constexpr (SizePolicy::kIsTracked) {
+      if (this != &other) {
+        SizeType count{1};
+        for (LinkPointer node{source_link}; node != tail.current_; node = node->next_) {
+          ++count;
+        }
+        size_.Add(count);
+        other.size_.Subtract(count);
+      }
+    }
+    LinkPointer first{source_link};
+    source_link = tail.current_->next_;
+    tail.current_->next_ = destination_link;
+    destination_link = first;
+  }
+
+  /**
+   * @brief Moves the element following `before_first` of `other` after `position` in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto SpliceAfter(ConstIterator position, ForwardList& other, ConstIterator before_first) noexcept -> void {
+    SpliceAfter(position, other, before_first, ConstIterator{other.NextLink(before_first)});
+  }
+
+  /**
+   * @brief Moves every element of `other` after `position` in O(`other` size).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto SpliceAfter(ConstIterator position, ForwardList& other) noexcept -> void {
+    if (other.Empty()) {
+      return;
+    }
+    SpliceAfter(position, other, other.BeforeBegin(), ConstIterator{FindTail(other.before_head_.next_)});
+  }
+
+  /**
+   * @brief Moves every element of `other` after `position` in O(`other` size).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto SpliceAfter(ConstIterator position, ForwardList&& other) noexcept -> void {
+    SpliceAfter(position, other);
+  }
+
+  /**
+   * @brief Reverses the order of elements by relinking nodes.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto Reverse() noexcept -> void {
+    LinkPointer reversed{nullptr};
+    while (before_head_.next_) {
+      reversed = std::exchange(before_head_.next_, std::exchange(before_head_.next_->next_, reversed));
+    }
+    before_head_.next_ = reversed;
+  }
+
+  /**
+   * @brief Removes consecutive elements equivalent by `predicate`, keeping the first of each group.
+   * @public
+   *
+   * @throws Propagates exception thrown by `predicate`.
+   *
+   * @return `SizeType` Amount of removed elements.
+   */
+  template<typename BinaryPredicate>
+  constexpr auto Unique(BinaryPredicate predicate) -> SizeType {
+    SizeType removed{};
+    for (LinkPointer node{before_head_.next_}; node && node->next_;) {
+      if (LinkPointer next{node->next_}; predicate(ValueOf(node), ValueOf(next))) {
+        node->next_ = next->next_;
+        DestroyNode(next);
+        ++removed;
+      } else {
+        node = next;
+      }
+    }
+    return removed;
+  }
+
+  /**
+   * @brief Removes consecutive equal elements, keeping the first of each group.
+   * @public
+   *
+   * @throws Propagates exception thrown by `operator==`.
+   *
+   * @return `SizeType` Amount of removed elements.
+   */
+  constexpr auto Unique() -> SizeType { return Unique(std::equal_to<>{}); }
+
+  /**
+   * @brief Calls `function` with every element in order while prefetching `prefetch_distance` nodes ahead.
+   * @public
+   *
+   * @throws Propagates exception thrown by `function`.
+   *
+   * @details A second cursor runs `prefetch_distance` nodes ahead and prefetches every cache line of the nodes it
+   * reaches. The pointer chase itself stays serial, but the misses of the look-ahead overlap with the work done
+   * by `function` and nodes larger than a cache line arrive whole. Prefer plain iteration for trivial bodies over
+   * compact lists, see `Compact`.
+   *
+   * @warning **Undefined Behaviour** if:
+   * - `function` inserts or erases elements of the list
+   */
+  template<typename Function>
+    requires std::invocable<Function&, Reference>
+  constexpr auto ForEachBatched(
+    Function function,  //
+    std::size_t prefetch_distance = kForwardListPrefetchDistance
+  ) -> void {
+    ForEachBatchedImpl(*this, function, prefetch_distance);
+  }
+
+  /**
+   * @brief Calls `function` with every element in order while prefetching `prefetch_distance` nodes ahead.
+   * @public
+   *
+   * @throws Propagates exception thrown by `function`.
+   */
+  template<typename Function>
+    requires std::invocable<Function&, ConstReference>
+  constexpr auto ForEachBatched(
+    Function function,  //
+    std::size_t prefetch_distance = kForwardListPrefetchDistance
+  ) const -> void {
+    ForEachBatchedImpl(*this, function, prefetch_distance);
+  }
+
+  /**
+   * @brief Moves the elements into freshly allocated nodes laid out in traversal order.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @details After many insertions, erasures, splices or a `Sort` the nodes are scattered and every step of a
+   * traversal is a cache miss. The replacement nodes are all allocated before the old ones are released, so they
+   * come out of fresh memory one after another and later scans read sequential memory. Allocators that own their
+   * nodes exclusively (`CanReleaseAllNodes`, e.g. `lab::NodePool`) and propagate on move assignment are replaced
+   * by a fresh copy, whose first chunks hold the whole list contiguously; the old pool is released at once.
+   *
+   * Iterators, pointers and references are invalidated. Strong guarantee when `T` is nothrow move constructible
+   * or copyable, otherwise a throwing move leaves moved-from elements behind.
+   */
+  constexpr auto Compact() -> void {
+    AllocatorType allocator{allocator_};
+    if constexpr (CanReleaseAllNodes<AllocatorType> && kPropagatesOnMoveAssignment) {
+      allocator = AllocatorTraits::select_on_container_copy_construction(allocator_);
+    }
+    ForwardList temp{MakeReplacement(allocator)};
+    if constexpr (std::is_nothrow_move_constructible_v<ValueType> || !std::copy_constructible<ValueType>) {
+      temp.AssignToEmpty(std::make_move_iterator(begin()), std::make_move_iterator(end()));
+    } else {
+      temp.AssignToEmpty(cbegin(), cend());
+    }
+    DeleteRange();
+    if constexpr (kPropagatesOnMoveAssignment) {
+      allocator_ = std::move(temp.allocator_);
+    }
+    StealNodes(temp);
+  }
+
  private:
+  /**
+   * @brief Shared traversal of both `ForEachBatched` overloads.
+   * @private
+   * @internal
+   */
+  template<typename Self, typename Function>
+  static constexpr auto ForEachBatchedImpl(
+    Self& self,  //
+    Function& function,
+    std::size_t prefetch_distance
+  ) -> void {
+    using ElementReference = std::conditional_t<std::is_const_v<Self>, ConstReference, Reference>;
+    LinkPointer ahead{self.before_head_.next_};
+    for (std::size_t i{}; ahead && i < prefetch_distance; ++i) {
+      ForwardListPrefetch(ahead, sizeof(ForwardListNode<T>));
+      ahead = ahead->next_;
+    }
+    for (LinkPointer node{self.before_head_.next_}; node; node = node->next_) {
+      if (ahead) {
+        ForwardListPrefetch(ahead, sizeof(ForwardListNode<T>));
+        ahead = ahead->next_;
+      }
+      std::invoke(function, static_cast<ElementReference>(ValueOf(node)));
+    }
+  }
+
+  /**
+   * @brief Helper function for destructing the whole sequence.
+   * @private
+   * @internal
+   *
+   * @details For trivially destructible `T` and an allocator exclusively owning its nodes (see
+   * `CanReleaseAllNodes`) the destruction is skipped and the allocator drops its chunks at once. The observer is told
+   * how many nodes went away; without a tracked size they are counted by walking the links, unless it is the
+   * `NullObserver`.
+   */
   constexpr auto DeleteRange() -> void {
-    while (head_) {
+    if constexpr (std::is_trivially_destructible_v<ValueType> && CanReleaseAllNodes<AllocatorType>) {
+      if !consteval {
+        if (allocator_.IsUnique()) {
+          std::size_t released{size_.Get()};
+          if constexpr (!SizePolicy::kIsTracked && !std::same_as<Observer, NullObserver>) {
+            released = static_cast<std::size_t>(std::ranges::distance(cbegin(), cend()));
+          }
+          allocator_.Release();
+          before_head_.next_ = nullptr;
+          size_ = SizePolicy{};
+          observer_.OnNodesReleased(released);
+          return;
+        }
+      }
+    }
+    while (before_head_.next_) {
       DestroyNodeFront();
     }
   }
 
  public:
+  /**
+   * @brief Copy assignment operator for `ForwardList`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @details Strong guarantee: the copy is built first, with `other`'s allocator when it propagates on copy
+   * assignment and with the own allocator otherwise.
+   */
   auto operator=(const ForwardList& other) -> ForwardList& {
     assert(this != &other);
-    auto temp{other};
-    return *this = std::move(temp);
+    ForwardList temp{MakeReplacement(kPropagatesOnCopyAssignment ? other.allocator_ : allocator_)};
+    temp.AssignToEmpty(other.cbegin(), other.cend());
+    DeleteRange();
+    if constexpr (kPropagatesOnCopyAssignment) {
+      allocator_ = other.allocator_;
+    }
+    StealNodes(temp);
+    return *this;
   }
 
-  constexpr auto operator=(ForwardList&& other) noexcept -> ForwardList& {
+  /**
+   * @brief Move assignment operator for `ForwardList`.
+   * @public
+   *
+   * @throws `std::bad_alloc` only if the allocator does not propagate and `GetAllocator() != other.GetAllocator()`,
+   * the elements are moved one by one into own nodes then.
+   */
+  constexpr auto operator=(ForwardList&& other) noexcept(kPropagatesOnMoveAssignment || kIsAllocatorAlwaysEqual)
+    -> ForwardList& {
     assert(this != &other);
+    if constexpr (!kPropagatesOnMoveAssignment && !kIsAllocatorAlwaysEqual) {
+      if (allocator_ != other.allocator_) {
+        ForwardList temp{MakeReplacement(allocator_)};
+        temp.AssignToEmpty(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        DeleteRange();
+        StealNodes(temp);
+        return *this;
+      }
+    }
     DeleteRange();
-    std::swap(head_, other.head_);
-    if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+    if constexpr (kPropagatesOnMoveAssignment) {
       allocator_ = std::move(other.allocator_);
     }
+    StealNodes(other);
     return *this;
   }
 
  private:
-  NodePointer head_{nullptr};
+  /**
+   * @brief Takes over the node sequence of `other` together with its observer, the own sequence must be empty.
+   * @private
+   * @internal
+   */
+  constexpr auto StealNodes(ForwardList& other) noexcept -> void {
+    assert(!before_head_.next_);
+    before_head_.next_ = std::exchange(other.before_head_.next_, nullptr);
+    size_ = std::exchange(other.size_, SizePolicy{});
+    observer_ = std::exchange(other.observer_, Observer{});
+  }
+
+  /**
+   * @brief Creates an empty list with `allocator` reporting to the own observer, used to build replacements
+   * before the own nodes are destroyed.
+   * @private
+   * @internal
+   */
+  [[nodiscard]] constexpr auto MakeReplacement(const AllocatorType& allocator) const -> ForwardList {
+    ForwardList replacement{allocator};
+    replacement.observer_ = observer_;
+    return replacement;
+  }
+
+  /**
+   * @brief Links copies of [`first`, `last`) into the empty list, destroying them again if one throws.
+   * @private
+   * @internal
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  template<std::input_iterator InputIterator>
+  constexpr auto AssignToEmpty(
+    InputIterator first,  //
+    InputIterator last
+  ) -> void {
+    assert(!before_head_.next_);
+    LinkPointer traverser{&before_head_};
+    while (first != last) {
+      LAB_TRY {
+        traverser->next_ = ConstructNode(*first++);
+        traverser = traverser->next_;
+      }
+      LAB_CATCH(...) {
+        Clear();
+        LAB_PROPAGATE_EXCEPTION;
+      }
+    }
+  }
+
+  ForwardListNodeBase before_head_;
   [[no_unique_address]] AllocatorType allocator_;
+  [[no_unique_address]] SizePolicy size_;
+  [[no_unique_address]] Observer observer_;
 };
 
 }  // namespace lab::containers
 
+namespace lab::pmr {
+
+/**
+ * @brief `ForwardList` allocating its nodes from a `std::pmr::memory_resource`.
+ */
+template<typename T, typename SizePolicy = containers::UntrackedSize, typename Observer = NullObserver>
+using ForwardList = containers::ForwardList<T, std::pmr::polymorphic_allocator<T>, SizePolicy, Observer>;
+
+}  // namespace lab::pmr
+
 END_EXPORT_SECTION
@@ -0,0 +1,262 @@
+module;
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+
+export module lab_instrumentation;
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Counters collected by `InstrumentedAllocator` and `StatsObserver`.
+ * @struct
+ *
+ * @details The allocator fills the allocation counters, the observer the container events: `capacity` is the
+ * current capacity of a contiguous container or the number of live nodes of a node based one, summed over all
+ * containers sharing the counters.
+ */
+struct ContainerStats {
+  std::size_t allocations{};
+  std::size_t deallocations{};
+  std::size_t bytes_allocated{};
+  std::size_t bytes_deallocated{};
+  std::size_t peak_bytes{};
+  std::size_t reallocations{};
+  std::size_t relocated_elements{};
+  std::size_t relocated_bytes{};
+  std::size_t capacity{};
+  std::size_t peak_capacity{};
+
+  [[nodiscard]] constexpr auto LiveBytes() const noexcept -> std::size_t { return bytes_allocated - bytes_deallocated; }
+
+  [[nodiscard]] friend constexpr auto operator==(const ContainerStats&, const ContainerStats&) noexcept -> bool = default;
+};
+
+/**
+ * @brief Interface of container observers, notified about storage events.
+ *
+ * @details `OnReallocate(old_capacity, new_capacity, relocated_elements, element_size)` follows every change of a
+ * contiguous buffer (`old_capacity == 0` for a fresh allocation, `new_capacity == 0` for a release),
+ * `OnNodeAllocate(node_size)` and `OnNodeDeallocate(node_size)` follow every node of a node based container and
+ * `OnNodesReleased(node_count)` follows a bulk release of the `node_count` nodes of one container.
+ */
+template<typename Observer>
+concept IsContainerObserver = std::semiregular<Observer> && requires(Observer& observer, std::size_t n) {
+  observer.OnReallocate(n, n, n, n);
+  observer.OnNodeAllocate(n);
+  observer.OnNodeDeallocate(n);
+  observer.OnNodesReleased(n);
+};
+
+/**
+ * @brief Default observer: every hook is an empty `constexpr` function and the object is empty, so containers
+ * store it with `[[no_unique_address]]` at zero cost.
+ */
+struct NullObserver {
+  constexpr auto OnReallocate(
+    [[maybe_unused]] std::size_t old_capacity,  //
+    [[maybe_unused]] std::size_t new_capacity,
+    [[maybe_unused]] std::size_t relocated_elements,
+    [[maybe_unused]] std::size_t element_size
+  ) noexcept -> void { }
+
+  constexpr auto OnNodeAllocate([[maybe_unused]] std::size_t node_size) noexcept -> void { }
+
+  constexpr auto OnNodeDeallocate([[maybe_unused]] std::size_t node_size) noexcept -> void { }
+
+  constexpr auto OnNodesReleased([[maybe_unused]] std::size_t node_count) noexcept -> void { }
+};
+
+/**
+ * @brief Observer that accumulates container events into an external `ContainerStats`.
+ *
+ * @details Copies share the same counters and observers follow the storage on move and swap, so the counters stay
+ * consistent when containers build replacements or exchange buffers. Attach it with
+ * `container.GetObserver() = lab::StatsObserver{&stats}`; a default constructed observer counts nothing.
+ */
+class StatsObserver {
+ public:
+  constexpr StatsObserver() noexcept = default;
+
+  explicit constexpr StatsObserver(ContainerStats* stats) noexcept : stats_{stats} { }
+
+  constexpr auto OnReallocate(
+    std::size_t old_capacity,  //
+    std::size_t new_capacity,
+    std::size_t relocated_elements,
+    std::size_t element_size
+  ) noexcept -> void {
+    if (!stats_) {
+      return;
+    }
+    if (old_capacity && new_capacity) {
+      ++stats_->reallocations;
+    }
+    stats_->relocated_elements += relocated_elements;
+    stats_->relocated_bytes += relocated_elements * element_size;
+    stats_->capacity = stats_->capacity - old_capacity + new_capacity;
+    stats_->peak_capacity = std::max(stats_->peak_capacity, stats_->capacity);
+  }
+
+  constexpr auto OnNodeAllocate([[maybe_unused]] std::size_t node_size) noexcept -> void {
+    if (stats_) {
+      ++stats_->capacity;
+      stats_->peak_capacity = std::max(stats_->peak_capacity, stats_->capacity);
+    }
+  }
+
+  constexpr auto OnNodeDeallocate([[maybe_unused]] std::size_t node_size) noexcept -> void {
+    if (stats_) {
+      --stats_->capacity;
+    }
+  }
+
+  constexpr auto OnNodesReleased(std::size_t node_count) noexcept -> void {
+    if (stats_) {
+      stats_->capacity -= node_count;
+    }
+  }
+
+  [[nodiscard]] constexpr auto Stats() const noexcept -> ContainerStats* { return stats_; }
+
+  [[nodiscard]] friend constexpr auto operator==(StatsObserver, StatsObserver) noexcept -> bool = default;
+
+ private:
+  ContainerStats* stats_{nullptr};
+};
+
+/**
+ * @brief Allocator adapter that counts allocations, deallocations and bytes of `Allocator` into `ContainerStats`.
+ * @class
+ *
+ * @tparam Allocator Underlying allocator, propagation traits are forwarded
+ *
+ * @details Rebound copies share the same counters, so node containers report their node allocations. The adapter
+ * does not define `construct`, so the containers keep their `std::memcpy` fast paths, and forwards
+ * `allocate_at_least` and `TryExpandInPlace` when `Allocator` provides them, so wrapping an allocator does not change
+ * how containers grow. A default constructed adapter counts nothing.
+ */
+template<typename Allocator>
+class InstrumentedAllocator {
+  using Traits = std::allocator_traits<Allocator>;
+
+  template<typename Other>
+  friend class InstrumentedAllocator;
+
+ public:
+  using value_type = Traits::value_type;
+  using size_type = Traits::size_type;
+  using difference_type = Traits::difference_type;
+  using propagate_on_container_copy_assignment = Traits::propagate_on_container_copy_assignment;
+  using propagate_on_container_move_assignment = Traits::propagate_on_container_move_assignment;
+  using propagate_on_container_swap = Traits::propagate_on_container_swap;
+  using is_always_equal = std::false_type;
+
+  template<typename U>
+  struct rebind {
+    using other = InstrumentedAllocator<typename Traits::template rebind_alloc<U>>;
+  };
+
+  constexpr InstrumentedAllocator() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+  explicit constexpr InstrumentedAllocator(
+    ContainerStats* stats,  //
+    const Allocator& allocator = Allocator{}
+  ) noexcept
+    : allocator_{allocator}
+    , stats_{stats} { }
+
+  template<typename Other>
+  constexpr InstrumentedAllocator(const InstrumentedAllocator<Other>& other) noexcept
+    : allocator_{other.allocator_}
+    , stats_{other.stats_} { }
+
+  [[nodiscard]] constexpr auto allocate(size_type n) -> value_type* {
+    value_type* const pointer{std::to_address(Traits::allocate(allocator_, n))};
+    if (stats_) {
+      ++stats_->allocations;
+      stats_->bytes_allocated += n * sizeof(value_type);
+      stats_->peak_bytes = std::max(stats_->peak_bytes, stats_->LiveBytes());
+    }
+    return pointer;
+  }
+
+#ifdef __cpp_lib_allocate_at_least
+  [[nodiscard]] constexpr auto allocate_at_least(size_type n) -> std::allocation_result<value_type*, size_type>
+    requires requires(Allocator& allocator, size_type count) { allocator.allocate_at_least(count); }
+  {
+    const auto [pointer, count]{Traits::allocate_at_least(allocator_, n)};
+    if (stats_) {
+      ++stats_->allocations;
+      stats_->bytes_allocated += count * sizeof(value_type);
+      stats_->peak_bytes = std::max(stats_->peak_bytes, stats_->LiveBytes());
+    }
+    return {std::to_address(pointer), count};
+  }
+#endif
+
+  constexpr auto deallocate(
+    value_type* pointer,  //
+    size_type n
+  ) noexcept -> void {
+    if (stats_) {
+      ++stats_->deallocations;
+      stats_->bytes_deallocated += n * sizeof(value_type);
+    }
+    Traits::deallocate(allocator_, pointer, n);
+  }
+
+  [[nodiscard]] constexpr auto max_size() const noexcept -> size_type { return Traits::max_size(allocator_); }
+
+  [[nodiscard]] constexpr auto select_on_container_copy_construction() const -> InstrumentedAllocator {
+    return InstrumentedAllocator{stats_, Traits::select_on_container_copy_construction(allocator_)};
+  }
+
+  auto TryExpandInPlace(
+    value_type* pointer,  //
+    size_type count,
+    size_type new_count
+  ) noexcept -> bool
+    requires requires(Allocator& allocator, value_type* block, size_type n) { allocator.TryExpandInPlace(block, n, n); }
+  {
+    if (!allocator_.TryExpandInPlace(pointer, count, new_count)) {
+      return false;
+    }
+    if (stats_) {
+      stats_->bytes_allocated += (new_count - count) * sizeof(value_type);
+      stats_->peak_bytes = std::max(stats_->peak_bytes, stats_->LiveBytes());
+    }
+    return true;
+  }
+
+  [[nodiscard]] constexpr auto Inner() const noexcept -> const Allocator& { return allocator_; }
+
+  [[nodiscard]] constexpr auto Stats() const noexcept -> ContainerStats* { return stats_; }
+
+  template<typename Other>
+  [[nodiscard]] friend constexpr auto operator==(
+    const InstrumentedAllocator& lhs,  //
+    const InstrumentedAllocator<Other>& rhs
+  ) noexcept -> bool {
+    return lhs.stats_ == rhs.stats_ && lhs.allocator_ == rhs.allocator_;
+  }
+
+ private:
+  [[no_unique_address]] Allocator allocator_{};
+  ContainerStats* stats_{nullptr};
+};
+
+}  // namespace lab
+
+END_EXPORT_SECTION
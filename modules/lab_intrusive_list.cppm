@@ -0,0 +1,739 @@
+module;
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+#include <utility>
+
+export module lab_intrusive_list;
+
+/**
+ * @brief Iterator base for IntrusiveForwardList (for const and non-const)
+ * @internal
+ * @class
+ *
+ * @tparam IsConst Boolean value for const iterator check
+ * @tparam IntrusiveForwardList IntrusiveForwardList class type for traversing
+ */
+template<bool IsConst, typename IntrusiveForwardList>
+class IntrusiveForwardListIteratorBase final {
+  friend IntrusiveForwardList;
+  friend IntrusiveForwardListIteratorBase<!IsConst, IntrusiveForwardList>;
+  using NodePointer = IntrusiveForwardList::Pointer;
+
+ public:
+  using ValueType = IntrusiveForwardList::ValueType;
+  using value_type = IntrusiveForwardList::ValueType;
+  using Reference = std::
+    conditional_t<IsConst, typename IntrusiveForwardList::ConstReference, typename IntrusiveForwardList::Reference>;
+  using reference = Reference;
+  using Pointer =
+    std::conditional_t<IsConst, typename IntrusiveForwardList::ConstPointer, typename IntrusiveForwardList::Pointer>;
+  using pointer = Pointer;
+  using DifferenceType = IntrusiveForwardList::DifferenceType;
+  using difference_type = IntrusiveForwardList::DifferenceType;
+  using IteratorCategory = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+
+  constexpr IntrusiveForwardListIteratorBase() noexcept = default;
+
+ private:
+  constexpr IntrusiveForwardListIteratorBase(NodePointer node) noexcept : current_{node} { }
+
+ public:
+  constexpr IntrusiveForwardListIteratorBase(const IntrusiveForwardListIteratorBase<!IsConst, IntrusiveForwardList> other
+  ) noexcept
+    : current_{other.current_} { }
+
+  constexpr auto operator*() const noexcept -> Reference {
+    assert(current_);
+    return *current_;
+  }
+
+  constexpr auto operator->() const noexcept -> Pointer {
+    assert(current_);
+    return current_;
+  }
+
+  constexpr auto operator++() noexcept -> IntrusiveForwardListIteratorBase& {
+    assert(current_);
+    current_ = IntrusiveForwardList::NextOf(current_);
+    return *this;
+  }
+
+  constexpr auto operator++(int) noexcept -> IntrusiveForwardListIteratorBase {
+    auto temp{*this};
+    ++*this;
+    return temp;
+  }
+
+  [[nodiscard]] friend constexpr auto operator==(
+    const IntrusiveForwardListIteratorBase lhs,  //
+    const IntrusiveForwardListIteratorBase rhs
+  ) noexcept -> bool {
+    return lhs.current_ == rhs.current_;
+  }
+
+  [[nodiscard]] friend constexpr auto operator!=(
+    const IntrusiveForwardListIteratorBase lhs,  //
+    const IntrusiveForwardListIteratorBase rhs
+  ) noexcept -> bool {
+    return lhs.current_ != rhs.current_;
+  }
+
+ private:
+  NodePointer current_{nullptr};
+};
+
+/**
+ * @brief Iterator base for IntrusiveList (for const and non-const)
+ * @internal
+ * @class
+ *
+ * @tparam IsConst Boolean value for const iterator check
+ * @tparam IntrusiveList IntrusiveList class type for traversing
+ *
+ * @details Keeps pointer to the list, so `end()` can be decremented.
+ */
+template<bool IsConst, typename IntrusiveList>
+class IntrusiveListIteratorBase final {
+  friend IntrusiveList;
+  friend IntrusiveListIteratorBase<!IsConst, IntrusiveList>;
+  using NodePointer = IntrusiveList::Pointer;
+
+ public:
+  using ValueType = IntrusiveList::ValueType;
+  using value_type = IntrusiveList::ValueType;
+  using Reference =
+    std::conditional_t<IsConst, typename IntrusiveList::ConstReference, typename IntrusiveList::Reference>;
+  using reference = Reference;
+  using Pointer = std::conditional_t<IsConst, typename IntrusiveList::ConstPointer, typename IntrusiveList::Pointer>;
+  using pointer = Pointer;
+  using DifferenceType = IntrusiveList::DifferenceType;
+  using difference_type = IntrusiveList::DifferenceType;
+  using IteratorCategory = std::bidirectional_iterator_tag;
+  using iterator_category = std::bidirectional_iterator_tag;
+
+  constexpr IntrusiveListIteratorBase() noexcept = default;
+
+ private:
+  constexpr IntrusiveListIteratorBase(NodePointer node, const IntrusiveList* list) noexcept
+    : current_{node}  //
+    , list_{list} { }
+
+ public:
+  constexpr IntrusiveListIteratorBase(const IntrusiveListIteratorBase<!IsConst, IntrusiveList> other) noexcept
+    : current_{other.current_}  //
+    , list_{other.list_} { }
+
+  constexpr auto operator*() const noexcept -> Reference {
+    assert(current_);
+    return *current_;
+  }
+
+  constexpr auto operator->() const noexcept -> Pointer {
+    assert(current_);
+    return current_;
+  }
+
+  constexpr auto operator++() noexcept -> IntrusiveListIteratorBase& {
+    assert(current_);
+    current_ = IntrusiveList::HookOf(current_).next_;
+    return *this;
+  }
+
+  constexpr auto operator++(int) noexcept -> IntrusiveListIteratorBase {
+    auto temp{*this};
+    ++*this;
+    return temp;
+  }
+
+  constexpr auto operator--() noexcept -> IntrusiveListIteratorBase& {
+    assert(list_);
+    current_ = current_ ? IntrusiveList::HookOf(current_).prev_ : list_->tail_;
+    return *this;
+  }
+
+  constexpr auto operator--(int) noexcept -> IntrusiveListIteratorBase {
+    auto temp{*this};
+    --*this;
+    return temp;
+  }
+
+  [[nodiscard]] friend constexpr auto operator==(
+    const IntrusiveListIteratorBase lhs,  //
+    const IntrusiveListIteratorBase rhs
+  ) noexcept -> bool {
+    return lhs.current_ == rhs.current_;
+  }
+
+  [[nodiscard]] friend constexpr auto operator!=(
+    const IntrusiveListIteratorBase lhs,  //
+    const IntrusiveListIteratorBase rhs
+  ) noexcept -> bool {
+    return lhs.current_ != rhs.current_;
+  }
+
+ private:
+  NodePointer current_{nullptr};
+  const IntrusiveList* list_{nullptr};
+};
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab::containers
+ */
+namespace lab::containers {
+
+/**
+ * @brief Member hook linking `T` into `IntrusiveForwardList`.
+ * @struct
+ *
+ * @tparam T Type of the object owning the hook
+ */
+template<typename T>
+struct IntrusiveForwardListHook {
+  T* next_{nullptr};
+};
+
+/**
+ * @brief Member hook linking `T` into `IntrusiveList`.
+ * @struct
+ *
+ * @tparam T Type of the object owning the hook
+ */
+template<typename T>
+struct IntrusiveListHook {
+  T* prev_{nullptr};
+  T* next_{nullptr};
+};
+
+/**
+ * @brief Singly-linked list of existing objects linked through `T::*Hook`.
+ * @class
+ *
+ * @tparam T Type of linked objects
+ * @tparam Hook Pointer to the `IntrusiveForwardListHook<T>` member of `T`
+ *
+ * @details The list never allocates and does not own linked objects, they must outlive their membership.
+ * An object can be linked into several lists through different hooks. `cend()` as `position` of `*After` methods
+ * denotes the position before the first element.
+ */
+template<typename T, IntrusiveForwardListHook<T> T::*Hook>
+class [[nodiscard]] IntrusiveForwardList {
+  friend IntrusiveForwardListIteratorBase<true, IntrusiveForwardList<T, Hook>>;
+  friend IntrusiveForwardListIteratorBase<false, IntrusiveForwardList<T, Hook>>;
+
+ public:
+  using ValueType = T;
+  using value_type = T;
+  using Reference = ValueType&;
+  using reference = value_type&;
+  using ConstReference = const ValueType&;
+  using const_reference = const value_type&;
+  using Pointer = ValueType*;
+  using pointer = value_type*;
+  using ConstPointer = const ValueType*;
+  using const_pointer = const value_type*;
+  using SizeType = std::size_t;
+  using size_type = std::size_t;
+  using DifferenceType = std::ptrdiff_t;
+  using difference_type = std::ptrdiff_t;
+  using Iterator = IntrusiveForwardListIteratorBase<false, IntrusiveForwardList<T, Hook>>;
+  using iterator = Iterator;
+  using ConstIterator = IntrusiveForwardListIteratorBase<true, IntrusiveForwardList<T, Hook>>;
+  using const_iterator = ConstIterator;
+
+ private:
+  [[nodiscard]] static constexpr auto NextOf(Pointer node) noexcept -> Pointer { return (node->*Hook).next_; }
+
+ public:
+  constexpr IntrusiveForwardList() noexcept = default;
+
+  IntrusiveForwardList(const IntrusiveForwardList&) = delete;
+
+  auto operator=(const IntrusiveForwardList&) -> IntrusiveForwardList& = delete;
+
+  /**
+   * @brief Move constructor for `IntrusiveForwardList`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr IntrusiveForwardList(IntrusiveForwardList&& other) noexcept : head_{std::exchange(other.head_, nullptr)} { }
+
+  /**
+   * @brief Move assignment operator for `IntrusiveForwardList`, unlinks current elements.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto operator=(IntrusiveForwardList&& other) noexcept -> IntrusiveForwardList& {
+    assert(this != &other);
+    Clear();
+    head_ = std::exchange(other.head_, nullptr);
+    return *this;
+  }
+
+  /**
+   * @brief Destructor for `IntrusiveForwardList`, unlinks every element.
+   * @public
+   */
+  constexpr ~IntrusiveForwardList() { Clear(); }
+
+  [[nodiscard]] constexpr auto begin() noexcept -> Iterator { return {head_}; }
+
+  [[nodiscard]] constexpr auto end() noexcept -> Iterator { return {}; }
+
+  [[nodiscard]] constexpr auto begin() const noexcept -> ConstIterator { return {head_}; }
+
+  [[nodiscard]] constexpr auto end() const noexcept -> ConstIterator { return {}; }
+
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> ConstIterator { return {head_}; }
+
+  [[nodiscard]] constexpr auto cend() const noexcept -> ConstIterator { return {}; }
+
+  /**
+   * @brief Provides access to the first element of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `Empty() == true`
+   * @see Empty
+   */
+  [[nodiscard]] constexpr auto Front() const noexcept -> Reference {
+    assert(head_);
+    return *head_;
+  }
+
+  /**
+   * @brief Provides the ability to check underlying container state.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto Empty() const noexcept -> bool { return !head_; }
+
+  /**
+   * @brief Returns `Iterator` to `value` in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if `value` is not linked into this list.
+   */
+  [[nodiscard]] constexpr auto IteratorTo(Reference value) const noexcept -> Iterator { return {&value}; }
+
+  /**
+   * @brief Links `value` at the beginning of the sequence in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto PushFront(Reference value) noexcept -> void {
+    (value.*Hook).next_ = head_;
+    head_ = &value;
+  }
+
+  /**
+   * @brief Unlinks the first element in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Reference` to the unlinked element.
+   */
+  constexpr auto PopFront() noexcept -> Reference {
+    assert(head_);
+    Pointer node{std::exchange(head_, NextOf(head_))};
+    (node->*Hook).next_ = nullptr;
+    return *node;
+  }
+
+ private:
+  [[nodiscard]] constexpr auto NextLink(ConstIterator position) noexcept -> Pointer& {
+    return position == cend() ? head_ : (position.current_->*Hook).next_;
+  }
+
+ public:
+  /**
+   * @brief Links `value` after `position` in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Iterator` to the linked element.
+   */
+  constexpr auto InsertAfter(ConstIterator position, Reference value) noexcept -> Iterator {
+    Pointer& link{NextLink(position)};
+    (value.*Hook).next_ = link;
+    link = &value;
+    return {&value};
+  }
+
+  /**
+   * @brief Unlinks the element following `position` in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Iterator` to the element following the unlinked one.
+   */
+  constexpr auto EraseAfter(ConstIterator position) noexcept -> Iterator {
+    Pointer& link{NextLink(position)};
+    Pointer node{link};
+    assert(node);
+    link = NextOf(node);
+    (node->*Hook).next_ = nullptr;
+    return {link};
+  }
+
+  /**
+   * @brief Unlinks `value`, looking up its predecessor in O(n).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @details Prefer `EraseAfter` or `IntrusiveList::Erase` (O(1)) on hot paths.
+   */
+  constexpr auto Erase(Reference value) noexcept -> Iterator {
+    ConstIterator previous{cend()};
+    while (NextLink(previous) != &value) {
+      previous = ConstIterator{NextLink(previous)};
+    }
+    return EraseAfter(previous);
+  }
+
+  /**
+   * @brief Unlinks every element in O(n), elements are not destroyed.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto Clear() noexcept -> void {
+    while (head_) {
+      PopFront();
+    }
+  }
+
+  /**
+   * @brief Provides the ability to swap `IntrusiveForwardList` instances.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto Swap(IntrusiveForwardList& other) noexcept -> void { std::swap(head_, other.head_); }
+
+ private:
+  Pointer head_{nullptr};
+};
+
+/**
+ * @brief Doubly-linked list of existing objects linked through `T::*Hook`.
+ * @class
+ *
+ * @tparam T Type of linked objects
+ * @tparam Hook Pointer to the `IntrusiveListHook<T>` member of `T`
+ *
+ * @details The list never allocates and does not own linked objects, they must outlive their membership.
+ * Every element can be unlinked in O(1) by reference, `Size()` is O(1).
+ */
+template<typename T, IntrusiveListHook<T> T::*Hook>
+class [[nodiscard]] IntrusiveList {
+  friend IntrusiveListIteratorBase<true, IntrusiveList<T, Hook>>;
+  friend IntrusiveListIteratorBase<false, IntrusiveList<T, Hook>>;
+
+ public:
+  using ValueType = T;
+  using value_type = T;
+  using Reference = ValueType&;
+  using reference = value_type&;
+  using ConstReference = const ValueType&;
+  using const_reference = const value_type&;
+  using Pointer = ValueType*;
+  using pointer = value_type*;
+  using ConstPointer = const ValueType*;
+  using const_pointer = const value_type*;
+  using SizeType = std::size_t;
+  using size_type = std::size_t;
+  using DifferenceType = std::ptrdiff_t;
+  using difference_type = std::ptrdiff_t;
+  using Iterator = IntrusiveListIteratorBase<false, IntrusiveList<T, Hook>>;
+  using iterator = Iterator;
+  using ConstIterator = IntrusiveListIteratorBase<true, IntrusiveList<T, Hook>>;
+  using const_iterator = ConstIterator;
+  using ReverseIterator = std::reverse_iterator<Iterator>;
+  using reverse_iterator = ReverseIterator;
+  using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+  using const_reverse_iterator = ConstReverseIterator;
+
+ private:
+  [[nodiscard]] static constexpr auto HookOf(Pointer node) noexcept -> IntrusiveListHook<T>& { return node->*Hook; }
+
+ public:
+  constexpr IntrusiveList() noexcept = default;
+
+  IntrusiveList(const IntrusiveList&) = delete;
+
+  auto operator=(const IntrusiveList&) -> IntrusiveList& = delete;
+
+  /**
+   * @brief Move constructor for `IntrusiveList`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr IntrusiveList(IntrusiveList&& other) noexcept
+    : head_{std::exchange(other.head_, nullptr)}  //
+    , tail_{std::exchange(other.tail_, nullptr)}
+    , size_{std::exchange(other.size_, 0)} { }
+
+  /**
+   * @brief Move assignment operator for `IntrusiveList`, unlinks current elements.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto operator=(IntrusiveList&& other) noexcept -> IntrusiveList& {
+    assert(this != &other);
+    Clear();
+    head_ = std::exchange(other.head_, nullptr);
+    tail_ = std::exchange(other.tail_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    return *this;
+  }
+
+  /**
+   * @brief Destructor for `IntrusiveList`, unlinks every element.
+   * @public
+   */
+  constexpr ~IntrusiveList() { Clear(); }
+
+  [[nodiscard]] constexpr auto begin() noexcept -> Iterator { return {head_, this}; }
+
+  [[nodiscard]] constexpr auto end() noexcept -> Iterator { return {nullptr, this}; }
+
+  [[nodiscard]] constexpr auto begin() const noexcept -> ConstIterator { return {head_, this}; }
+
+  [[nodiscard]] constexpr auto end() const noexcept -> ConstIterator { return {nullptr, this}; }
+
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> ConstIterator { return {head_, this}; }
+
+  [[nodiscard]] constexpr auto cend() const noexcept -> ConstIterator { return {nullptr, this}; }
+
+  [[nodiscard]] constexpr auto rbegin() noexcept -> ReverseIterator { return ReverseIterator{end()}; }
+
+  [[nodiscard]] constexpr auto rend() noexcept -> ReverseIterator { return ReverseIterator{begin()}; }
+
+  [[nodiscard]] constexpr auto crbegin() const noexcept -> ConstReverseIterator {
+    return ConstReverseIterator{cend()};
+  }
+
+  [[nodiscard]] constexpr auto crend() const noexcept -> ConstReverseIterator {
+    return ConstReverseIterator{cbegin()};
+  }
+
+  /**
+   * @brief Provides access to the first element of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `Empty() == true`
+   * @see Empty
+   */
+  [[nodiscard]] constexpr auto Front() const noexcept -> Reference {
+    assert(head_);
+    return *head_;
+  }
+
+  /**
+   * @brief Provides access to the last element of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `Empty() == true`
+   * @see Empty
+   */
+  [[nodiscard]] constexpr auto Back() const noexcept -> Reference {
+    assert(tail_);
+    return *tail_;
+  }
+
+  /**
+   * @brief Provides the ability to check underlying container state.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto Empty() const noexcept -> bool { return !head_; }
+
+  /**
+   * @brief Returns amount of linked elements in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto Size() const noexcept -> SizeType { return size_; }
+
+  /**
+   * @brief Returns `Iterator` to `value` in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if `value` is not linked into this list.
+   */
+  [[nodiscard]] constexpr auto IteratorTo(Reference value) noexcept -> Iterator { return {&value, this}; }
+
+  /**
+   * @brief Links `value` before `position` in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Iterator` to the linked element.
+   */
+  constexpr auto Insert(ConstIterator position, Reference value) noexcept -> Iterator {
+    Pointer next{position.current_};
+    Pointer previous{next ? HookOf(next).prev_ : tail_};
+    HookOf(&value) = {previous, next};
+    (previous ? HookOf(previous).next_ : head_) = &value;
+    (next ? HookOf(next).prev_ : tail_) = &value;
+    ++size_;
+    return {&value, this};
+  }
+
+  constexpr auto PushFront(Reference value) noexcept -> void { Insert(cbegin(), value); }
+
+  constexpr auto PushBack(Reference value) noexcept -> void { Insert(cend(), value); }
+
+  /**
+   * @brief Unlinks `value` in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Iterator` to the element following the unlinked one.
+   *
+   * @warning **Undefined Behaviour** if `value` is not linked into this list.
+   */
+  constexpr auto Erase(Reference value) noexcept -> Iterator {
+    assert(size_ > 0);
+    auto& hook{HookOf(&value)};
+    Pointer next{hook.next_};
+    (hook.prev_ ? HookOf(hook.prev_).next_ : head_) = next;
+    (next ? HookOf(next).prev_ : tail_) = hook.prev_;
+    hook = {};
+    --size_;
+    return {next, this};
+  }
+
+  /**
+   * @brief Unlinks the element at `position` in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Iterator` to the element following the unlinked one.
+   */
+  constexpr auto Erase(ConstIterator position) noexcept -> Iterator {
+    assert(position != cend());
+    return Erase(*position.current_);
+  }
+
+  /**
+   * @brief Unlinks the first element in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Reference` to the unlinked element.
+   */
+  constexpr auto PopFront() noexcept -> Reference {
+    assert(head_);
+    Reference value{*head_};
+    Erase(value);
+    return value;
+  }
+
+  /**
+   * @brief Unlinks the last element in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Reference` to the unlinked element.
+   */
+  constexpr auto PopBack() noexcept -> Reference {
+    assert(tail_);
+    Reference value{*tail_};
+    Erase(value);
+    return value;
+  }
+
+  /**
+   * @brief Moves every element of `other` before `position` in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto Splice(ConstIterator position, IntrusiveList& other) noexcept -> void {
+    assert(this != &other);
+    if (other.Empty()) {
+      return;
+    }
+    Pointer next{position.current_};
+    Pointer previous{next ? HookOf(next).prev_ : tail_};
+    HookOf(other.head_).prev_ = previous;
+    HookOf(other.tail_).next_ = next;
+    (previous ? HookOf(previous).next_ : head_) = other.head_;
+    (next ? HookOf(next).prev_ : tail_) = other.tail_;
+    size_ += std::exchange(other.size_, 0);
+    other.head_ = other.tail_ = nullptr;
+  }
+
+  /**
+   * @brief Unlinks every element in O(n), elements are not destroyed.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto Clear() noexcept -> void {
+    while (head_) {
+      HookOf(std::exchange(head_, HookOf(head_).next_)) = {};
+    }
+    tail_ = nullptr;
+    size_ = 0;
+  }
+
+  /**
+   * @brief Provides the ability to swap `IntrusiveList` instances.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto Swap(IntrusiveList& other) noexcept -> void {
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(size_, other.size_);
+  }
+
+ private:
+  Pointer head_{nullptr};
+  Pointer tail_{nullptr};
+  SizeType size_{};
+};
+
+}  // namespace lab::containers
+
+END_EXPORT_SECTION
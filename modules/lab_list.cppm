@@ -1,12 +1,1223 @@
 module;
 
+#include <cassert>
 #include <concepts>
-#include <iostream>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
 #include <type_traits>
+#include <utility>
 
 export module lab_list;
 
-export {
-  auto Hello() -> void { std::cout << "Hello, world!" << std::endl; }
-}
+export import lab_instrumentation;
+
+/**
+ * @brief Concept for type validation
+ * @internal
+ * @concept IsValidListType
+ */
+template<typename T>
+concept IsValidListType = (std::copyable<T> || std::movable<T>) && std::destructible<T>;
+
+/**
+ * @brief Concept for allocator validation
+ * @internal
+ * @concept IsValidListAllocatorType
+ */
+template<typename Allocator, typename T>
+concept IsValidListAllocatorType = IsValidListType<typename std::allocator_traits<Allocator>::value_type> &&
+                                   std::same_as<typename std::allocator_traits<Allocator>::value_type, T>;
+
+/**
+ * @brief Internal link type for doubly-linked list (header sentinel and base of every node)
+ * @internal
+ * @struct
+ */
+struct ListNodeBase {
+  ListNodeBase* prev_{nullptr};
+  ListNodeBase* next_{nullptr};
+};
+
+/**
+ * @brief Internal node type for doubly-linked list
+ * @internal
+ * @struct
+ *
+ * @tparam T Value type to store in node
+ */
+template<typename T>
+struct [[nodiscard]] ListNode final : ListNodeBase {
+  constexpr explicit ListNode(auto&&... args) noexcept(std::is_nothrow_constructible_v<T, decltype(args)...>)
+    : value_(std::forward<decltype(args)>(args)...) { }
+
+  T value_{};
+};
+
+/**
+ * @brief Iterator base for List (for const and non-const)
+ * @internal
+ * @class
+ *
+ * @tparam IsConst Boolean value for const iterator check
+ * @tparam List List class type for traversing
+ */
+template<bool IsConst, typename List>
+class ListIteratorBase final {
+  friend List;
+  friend ListIteratorBase<!IsConst, List>;
+  using LinkPointer = List::LinkPointer;
+
+ public:
+  using ValueType = List::ValueType;
+  using value_type = List::ValueType;
+  using Reference = std::conditional_t<IsConst, typename List::ConstReference, typename List::Reference>;
+  using reference = Reference;
+  using Pointer = std::conditional_t<IsConst, typename List::ConstPointer, typename List::Pointer>;
+  using pointer = Pointer;
+  using DifferenceType = List::DifferenceType;
+  using difference_type = List::DifferenceType;
+  using IteratorCategory = std::bidirectional_iterator_tag;
+  using iterator_category = std::bidirectional_iterator_tag;
+
+  constexpr ListIteratorBase() noexcept = default;
+
+ private:
+  constexpr ListIteratorBase(LinkPointer node) noexcept : current_{node} { }
+
+ public:
+  constexpr ListIteratorBase(const ListIteratorBase<!IsConst, List> other) noexcept : current_{other.current_} { }
+
+  constexpr auto operator*() const noexcept -> Reference {
+    assert(current_);
+    return List::ValueOf(current_);
+  }
+
+  constexpr auto operator->() const noexcept -> Pointer {
+    assert(current_);
+    return &List::ValueOf(current_);
+  }
+
+  constexpr auto operator++() noexcept -> ListIteratorBase& {
+    assert(current_);
+    current_ = current_->next_;
+    return *this;
+  }
+
+  constexpr auto operator++(int) noexcept -> ListIteratorBase {
+    assert(current_);
+    auto temp{*this};
+    current_ = current_->next_;
+    return temp;
+  }
+
+  constexpr auto operator--() noexcept -> ListIteratorBase& {
+    assert(current_);
+    current_ = current_->prev_;
+    return *this;
+  }
+
+  constexpr auto operator--(int) noexcept -> ListIteratorBase {
+    assert(current_);
+    auto temp{*this};
+    current_ = current_->prev_;
+    return temp;
+  }
+
+  [[nodiscard]] friend constexpr auto operator==(
+    const ListIteratorBase lhs,  //
+    const ListIteratorBase rhs
+  ) noexcept -> bool {
+    return lhs.current_ == rhs.current_;
+  }
+
+  [[nodiscard]] friend constexpr auto operator!=(
+    const ListIteratorBase lhs,  //
+    const ListIteratorBase rhs
+  ) noexcept -> bool {
+    return lhs.current_ != rhs.current_;
+  }
+
+ private:
+  LinkPointer current_{nullptr};
+};
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab::containers
+ */
+namespace lab::containers {
+
+/**
+ * @brief Class that represents doubly-linked list
+ * @class
+ *
+ * @tparam T Value type to store in container
+ * @tparam Allocator Allocator type to use in container
+ * @tparam Observer Node event observer, see `IsContainerObserver`; the default `NullObserver` costs nothing
+ *
+ * @details Nodes form a ring closed by the header sentinel (`end()`), so insertion and erasure never branch on
+ * the list boundaries. `BeforeBegin()` is the header as well, which gives `List` the `*After` interface of
+ * `ForwardList`.
+ *
+ * Stateful allocators are stored and honour `propagate_on_container_copy_assignment`,
+ * `propagate_on_container_move_assignment` and `propagate_on_container_swap`.
+ */
+template<
+  IsValidListType T,
+  IsValidListAllocatorType<T> Allocator = std::allocator<T>,
+  IsContainerObserver Observer = NullObserver>
+class [[nodiscard]] List {
+  friend ListIteratorBase<true, List<T, Allocator, Observer>>;
+  friend ListIteratorBase<false, List<T, Allocator, Observer>>;
+  using InternalAllocatorType = std::allocator_traits<Allocator>::template rebind_alloc<ListNode<T>>;
+  using AllocatorTraits = std::allocator_traits<InternalAllocatorType>;
+  using NodePointer = ListNode<T>*;
+  static constexpr bool kPropagatesOnCopyAssignment{AllocatorTraits::propagate_on_container_copy_assignment::value};
+  static constexpr bool kPropagatesOnMoveAssignment{AllocatorTraits::propagate_on_container_move_assignment::value};
+  static constexpr bool kIsAllocatorAlwaysEqual{AllocatorTraits::is_always_equal::value};
+  using LinkPointer = ListNodeBase*;
+
+  /**
+   * @brief Provides access to the value of the node behind `link`.
+   * @private
+   * @internal
+   */
+  [[nodiscard]] static constexpr auto ValueOf(LinkPointer link) noexcept -> T& {
+    assert(link);
+    return static_cast<NodePointer>(link)->value_;
+  }
+
+ public:
+  using ValueType = T;
+  using value_type = T;
+  using Reference = ValueType&;
+  using reference = value_type&;
+  using ConstReference = const ValueType&;
+  using const_reference = const value_type&;
+  using Pointer = ValueType*;
+  using pointer = value_type*;
+  using ConstPointer = const ValueType*;
+  using const_pointer = const value_type*;
+  using AllocatorType = InternalAllocatorType;
+  using allocator_type = InternalAllocatorType;
+  using SizeType = AllocatorTraits::size_type;
+  using size_type = AllocatorTraits::size_type;
+  using DifferenceType = AllocatorTraits::difference_type;
+  using difference_type = AllocatorTraits::difference_type;
+  using Iterator = ListIteratorBase<false, List<T, Allocator, Observer>>;
+  using iterator = Iterator;
+  using ConstIterator = ListIteratorBase<true, List<T, Allocator, Observer>>;
+  using const_iterator = ConstIterator;
+  using ObserverType = Observer;
+  using ReverseIterator = std::reverse_iterator<Iterator>;
+  using reverse_iterator = ReverseIterator;
+  using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+  using const_reverse_iterator = ConstReverseIterator;
+
+  /**
+   * @brief Default constructor for `List`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr List() noexcept(std::is_nothrow_default_constructible_v<AllocatorType>) : header_{&header_, &header_} { }
+
+  /**
+   * @brief Constructs empty `List` that allocates its nodes with `allocator`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr explicit List(const Allocator& allocator) noexcept
+    : header_{&header_, &header_}
+    , allocator_{allocator} { }
+
+  /**
+   * @brief Copy constructor for `List`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  List(const List& other) : List{AllocatorTraits::select_on_container_copy_construction(other.allocator_)} {
+    AppendRange(other.cbegin(), other.cend());
+  }
+
+  /**
+   * @brief Move constructor for `List`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr List(List&& other) noexcept
+    : allocator_{std::move(other.allocator_)}  //
+    , size_{std::exchange(other.size_, 0)}
+    , observer_{std::exchange(other.observer_, Observer{})} {
+    MoveHeader(header_, other.header_);
+  }
+
+  /**
+   * @brief Move constructor for `List` with explicit allocator.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @details Steals the nodes of `other` when the allocators compare equal, otherwise moves its elements one by one.
+   */
+  constexpr List(
+    List&& other,  //
+    const Allocator& allocator
+  )
+    : List{allocator} {
+    if (kIsAllocatorAlwaysEqual || allocator_ == other.allocator_) {
+      StealNodes(other);
+      return;
+    }
+    observer_ = other.observer_;
+    AppendRange(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+  }
+
+  /**
+   * @brief Parametrisized constructor for `count` default constructed elements for `List`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  constexpr explicit List(
+    SizeType count,  //
+    const Allocator& allocator = Allocator{}
+  )
+    : List{allocator} {
+    LAB_TRY {
+      for (SizeType i{}; i < count; ++i) {
+        EmplaceBack();
+      }
+    }
+    LAB_CATCH(...) {
+      Clear();
+      LAB_PROPAGATE_EXCEPTION;
+    }
+  }
+
+  /**
+   * @brief Parametrisized constructor `Range` like types for `List`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   */
+  template<std::input_iterator InputIterator>
+  constexpr List(
+    InputIterator first,  //
+    InputIterator last,
+    const Allocator& allocator = Allocator{}
+  )
+    : List{allocator} {
+    AppendRange(std::move(first), std::move(last));
+  }
+
+  /**
+   * @brief Parametrisized constructor with `std::initializer_list` for `List`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  constexpr explicit List(
+    std::initializer_list<ValueType> ilist,  //
+    const Allocator& allocator = Allocator{}
+  )
+    : List{ilist.begin(), ilist.end(), allocator} { }
+
+  /**
+   * @brief Destructor for `List`.
+   * @public
+   * @internal
+   *
+   * @details Delegates node sequence destruction to `DeleteRange`.
+   * @see DeleteRange
+   */
+  constexpr ~List() { DeleteRange(); }
+
+  /**
+   * @brief Returns `Iterator` to the position before the first element (the header, same as `end()`).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto BeforeBegin() noexcept -> Iterator { return end(); }
+
+  /**
+   * @brief Returns `ConstIterator` to the position before the first element (the header, same as `cend()`).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto BeforeBegin() const noexcept -> ConstIterator { return cend(); }
+
+  /**
+   * @brief Returns `ConstIterator` to the position before the first element (the header, same as `cend()`).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto CBeforeBegin() const noexcept -> ConstIterator { return cend(); }
+
+  /**
+   * @brief Returns `Iterator` to the beginning of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto begin() noexcept -> Iterator { return {header_.next_}; }
+
+  /**
+   * @brief Returns `Iterator` to the end of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto end() noexcept -> Iterator { return {&header_}; }
+
+  /**
+   * @brief Returns `ConstIterator` to the beginning of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto begin() const noexcept -> ConstIterator { return cbegin(); }
+
+  /**
+   * @brief Returns `ConstIterator` to the end of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto end() const noexcept -> ConstIterator { return cend(); }
+
+  /**
+   * @brief Returns `ConstIterator` to the beginning of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> ConstIterator { return {header_.next_}; }
+
+  /**
+   * @brief Returns `ConstIterator` to the end of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto cend() const noexcept -> ConstIterator { return {const_cast<LinkPointer>(&header_)}; }
+
+  /**
+   * @brief Returns `ReverseIterator` to the last element of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto rbegin() noexcept -> ReverseIterator { return ReverseIterator{end()}; }
+
+  /**
+   * @brief Returns `ReverseIterator` to the position before the first element of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto rend() noexcept -> ReverseIterator { return ReverseIterator{begin()}; }
+
+  /**
+   * @brief Returns `ConstReverseIterator` to the last element of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto crbegin() const noexcept -> ConstReverseIterator {
+    return ConstReverseIterator{cend()};
+  }
+
+  /**
+   * @brief Returns `ConstReverseIterator` to the position before the first element of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto crend() const noexcept -> ConstReverseIterator {
+    return ConstReverseIterator{cbegin()};
+  }
+
+  /**
+   * @brief Provides access to the first element of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `Empty() == true`
+   * @see Empty
+   */
+  [[nodiscard]] constexpr auto Front() noexcept -> Reference {
+    assert(!Empty());
+    return ValueOf(header_.next_);
+  }
+
+  /**
+   * @brief Provides access to the first element of the sequence (const overload).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `Empty() == true`
+   * @see Empty
+   */
+  [[nodiscard]] constexpr auto Front() const noexcept -> ConstReference {
+    assert(!Empty());
+    return ValueOf(header_.next_);
+  }
+
+  /**
+   * @brief Provides access to the last element of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `Empty() == true`
+   * @see Empty
+   */
+  [[nodiscard]] constexpr auto Back() noexcept -> Reference {
+    assert(!Empty());
+    return ValueOf(header_.prev_);
+  }
+
+  /**
+   * @brief Provides access to the last element of the sequence (const overload).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `Empty() == true`
+   * @see Empty
+   */
+  [[nodiscard]] constexpr auto Back() const noexcept -> ConstReference {
+    assert(!Empty());
+    return ValueOf(header_.prev_);
+  }
+
+  /**
+   * @brief Provides the ability to check underlying container state.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto Empty() const noexcept -> bool { return size_ == 0; }
+
+  /**
+   * @brief Returns amount of elements in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto Size() const noexcept -> SizeType { return size_; }
+
+  /**
+   * @brief Provides the access of allocator type used by the contianer.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto GetAllocator() const noexcept -> AllocatorType { return allocator_; }
+
+  /**
+   * @brief Provides access to the node event observer.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto GetObserver() noexcept -> ObserverType& { return observer_; }
+
+  [[nodiscard]] constexpr auto GetObserver() const noexcept -> const ObserverType& { return observer_; }
+
+  /**
+   * @brief Returns theoretical maximum size of the container.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto MaxSize() const noexcept -> SizeType { return AllocatorTraits::max_size(allocator_); }
+
+  /**
+   * @brief Destroys the sequence obtained by the container.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto Clear() noexcept -> void { DeleteRange(); }
+
+ private:
+  /**
+   * @brief Helper method for Node construction.
+   * @private
+   * @internal
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @details Delegates allocation/construct and deallocation/destroy operations to `std::allocator_traits`.
+   */
+  constexpr auto ConstructNode(auto&&... args) -> NodePointer {
+    NodePointer temp{AllocatorTraits::allocate(allocator_, 1)};
+    LAB_TRY { AllocatorTraits::construct(allocator_, temp, std::forward<decltype(args)>(args)...); }
+    LAB_CATCH(...) {
+      AllocatorTraits::deallocate(allocator_, temp, 1);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    observer_.OnNodeAllocate(sizeof(ListNode<T>));
+    return temp;
+  }
+
+  /**
+   * @brief Helper function for node destruction.
+   * @private
+   * @internal
+   *
+   * @details Delegates deallocate/destroy to `std::allocator_traits`.
+   */
+  constexpr auto DestroyNode(LinkPointer link) noexcept -> void {
+    assert(link && link != &header_);
+    NodePointer node{static_cast<NodePointer>(link)};
+    if constexpr (!std::is_trivially_destructible_v<ValueType>) {
+      AllocatorTraits::destroy(allocator_, node);
+    }
+    AllocatorTraits::deallocate(allocator_, node, 1);
+    observer_.OnNodeDeallocate(sizeof(ListNode<T>));
+  }
+
+  /**
+   * @brief Links `node` before `position`.
+   * @private
+   * @internal
+   */
+  static constexpr auto LinkBefore(LinkPointer position, LinkPointer node) noexcept -> void {
+    node->prev_ = position->prev_;
+    node->next_ = position;
+    position->prev_->next_ = node;
+    position->prev_ = node;
+  }
+
+  /**
+   * @brief Unlinks `node` from its neighbours.
+   * @private
+   * @internal
+   */
+  static constexpr auto Unlink(LinkPointer node) noexcept -> void {
+    node->prev_->next_ = node->next_;
+    node->next_->prev_ = node->prev_;
+  }
+
+  /**
+   * @brief Moves nodes [`first`, `last`) before `position` in O(1).
+   * @private
+   * @internal
+   */
+  static constexpr auto Transfer(LinkPointer position, LinkPointer first, LinkPointer last) noexcept -> void {
+    if (first == last) {
+      return;
+    }
+    LinkPointer tail{last->prev_};
+    first->prev_->next_ = last;
+    last->prev_ = first->prev_;
+    LinkPointer before{position->prev_};
+    before->next_ = first;
+    first->prev_ = before;
+    tail->next_ = position;
+    position->prev_ = tail;
+  }
+
+  /**
+   * @brief Moves the ring of `source` header to `destination` header, `source` becomes empty.
+   * @private
+   * @internal
+   */
+  static constexpr auto MoveHeader(ListNodeBase& destination, ListNodeBase& source) noexcept -> void {
+    if (source.next_ == &source) {
+      destination.prev_ = destination.next_ = &destination;
+      return;
+    }
+    destination = source;
+    destination.next_->prev_ = destination.prev_->next_ = &destination;
+    source.prev_ = source.next_ = &source;
+  }
+
+  template<typename InputIterator, typename Sentinel>
+  constexpr auto AppendRange(InputIterator first, Sentinel last) -> void {
+    LAB_TRY {
+      for (; first != last; ++first) {
+        EmplaceBack(*first);
+      }
+    }
+    LAB_CATCH(...) {
+      Clear();
+      LAB_PROPAGATE_EXCEPTION;
+    }
+  }
+
+ public:
+  /**
+   * @brief Constructs the object before `position` with `args` in O(1).
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @return `Iterator` to the constructed element.
+   */
+  constexpr auto Emplace(ConstIterator position, auto&&... args) -> Iterator {
+    NodePointer node{ConstructNode(std::forward<decltype(args)>(args)...)};
+    LinkBefore(position.current_, node);
+    ++size_;
+    return {node};
+  }
+
+  /**
+   * @brief Inserts the element before `position` by copy constructing.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  constexpr auto Insert(ConstIterator position, const ValueType& value) -> Iterator { return Emplace(position, value); }
+
+  /**
+   * @brief Inserts the element before `position` by move constructing.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  constexpr auto Insert(ConstIterator position, ValueType&& value) -> Iterator {
+    return Emplace(position, std::move(value));
+  }
+
+  /**
+   * @brief Inserts the element after `position` by copy constructing.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @details `BeforeBegin()` as `position` inserts at the beginning of the sequence.
+   */
+  constexpr auto InsertAfter(ConstIterator position, const ValueType& value) -> Iterator {
+    return Emplace(std::next(position), value);
+  }
+
+  /**
+   * @brief Inserts the element after `position` by move constructing.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @details `BeforeBegin()` as `position` inserts at the beginning of the sequence.
+   */
+  constexpr auto InsertAfter(ConstIterator position, ValueType&& value) -> Iterator {
+    return Emplace(std::next(position), std::move(value));
+  }
+
+  /**
+   * @brief Copy constructs the element at the beginning of the sequence.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  constexpr auto PushFront(const ValueType& value) -> void { Emplace(cbegin(), value); }
+
+  /**
+   * @brief Move constructs the element at the beginning of the sequence.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  constexpr auto PushFront(ValueType&& value) -> void { Emplace(cbegin(), std::move(value)); }
+
+  /**
+   * @brief Constructs the object at the beginning of the sequence with `args`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  constexpr auto EmplaceFront(auto&&... args) -> Reference {
+    return *Emplace(cbegin(), std::forward<decltype(args)>(args)...);
+  }
+
+  /**
+   * @brief Copy constructs the element at the end of the sequence.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  constexpr auto PushBack(const ValueType& value) -> void { Emplace(cend(), value); }
+
+  /**
+   * @brief Move constructs the element at the end of the sequence.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  constexpr auto PushBack(ValueType&& value) -> void { Emplace(cend(), std::move(value)); }
+
+  /**
+   * @brief Constructs the object at the end of the sequence with `args`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  constexpr auto EmplaceBack(auto&&... args) -> Reference {
+    return *Emplace(cend(), std::forward<decltype(args)>(args)...);
+  }
+
+  /**
+   * @brief Erases element at the specified position in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Iterator` to the element following the erased one.
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `position` argument is not in range [`cbegin()`, `cend()`)
+   * @see cbegin, cend
+   */
+  constexpr auto Erase(ConstIterator position) noexcept -> Iterator {
+    assert(position != cend());
+    LinkPointer next{position.current_->next_};
+    Unlink(position.current_);
+    DestroyNode(position.current_);
+    --size_;
+    return {next};
+  }
+
+  /**
+   * @brief Erases elements [`first`, `last`).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Iterator` to `last`.
+   */
+  constexpr auto Erase(ConstIterator first, ConstIterator last) noexcept -> Iterator {
+    while (first != last) {
+      first = Erase(first);
+    }
+    return {last.current_};
+  }
+
+  /**
+   * @brief Erases the element following `position` in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Iterator` to the element following the erased one.
+   */
+  constexpr auto EraseAfter(ConstIterator position) noexcept -> Iterator { return Erase(std::next(position)); }
+
+  /**
+   * @brief Erases elements (`position`, `last`).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Iterator` to `last`.
+   */
+  constexpr auto EraseAfter(ConstIterator position, ConstIterator last) noexcept -> Iterator {
+    return Erase(std::next(position), last);
+  }
+
+  /**
+   * @brief Destroys element from the beginning of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto PopFront() noexcept -> void { Erase(cbegin()); }
+
+  /**
+   * @brief Destroys element from the end of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto PopBack() noexcept -> void { Erase(std::prev(cend())); }
+
+  /**
+   * @brief Moves every element of `other` before `position` in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `GetAllocator() != other.GetAllocator()`
+   */
+  constexpr auto Splice(ConstIterator position, List& other) noexcept -> void {
+    assert(this != &other);
+    assert(allocator_ == other.allocator_);
+    Transfer(position.current_, other.header_.next_, &other.header_);
+    size_ += std::exchange(other.size_, 0);
+  }
+
+  /**
+   * @brief Moves every element of `other` before `position` in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto Splice(ConstIterator position, List&& other) noexcept -> void { Splice(position, other); }
+
+  /**
+   * @brief Moves element at `it` of `other` before `position` in O(1).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto Splice(ConstIterator position, List& other, ConstIterator it) noexcept -> void {
+    assert(allocator_ == other.allocator_);
+    assert(it != other.cend());
+    Transfer(position.current_, it.current_, it.current_->next_);
+    --other.size_;
+    ++size_;
+  }
+
+  /**
+   * @brief Moves elements [`first`, `last`) of `other` before `position`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @details O(1) within one list, moved elements are counted in O(range) when `other` is another list.
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `position` is in range [`first`, `last`)
+   */
+  constexpr auto Splice(ConstIterator position, List& other, ConstIterator first, ConstIterator last) noexcept
+    -> void {
+    assert(allocator_ == other.allocator_);
+    if (this != &other) {
+      const auto count{static_cast<SizeType>(std::distance(first, last))};
+      other.size_ -= count;
+      size_ += count;
+    }
+    Transfer(position.current_, first.current_, last.current_);
+  }
+
+ private:
+  /**
+   * @brief Restores `prev_` links and the ring from `next_` chain terminated by `nullptr`.
+   * @private
+   * @internal
+   */
+  constexpr auto RelinkPrevious() noexcept -> void {
+    LinkPointer previous{&header_};
+    for (LinkPointer node{header_.next_}; node; node = node->next_) {
+      node->prev_ = previous;
+      previous = node;
+    }
+    previous->next_ = &header_;
+    header_.prev_ = previous;
+  }
+
+ public:
+  /**
+   * @brief Sorts the sequence in ascending order (stable) with `compare`.
+   * @public
+   *
+   * @throws Propagates exception thrown by `compare`, the order of elements is unspecified in that case.
+   *
+   * @details Bottom-up merge sort over `next_` links with O(1) extra space and no allocations, `prev_` links are
+   * restored in one pass afterwards.
+   */
+  template<typename Compare>
+  constexpr auto Sort(Compare compare) -> void {
+    if (size_ < 2) {
+      return;
+    }
+    header_.prev_->next_ = nullptr;
+    for (SizeType width{1}; width < size_; width *= 2) {
+      LinkPointer rest{header_.next_};
+      LinkPointer tail{&header_};
+      while (rest) {
+        LinkPointer left{rest};
+        LinkPointer right{rest};
+        SizeType left_size{};
+        while (left_size < width && right) {
+          right = right->next_;
+          ++left_size;
+        }
+        SizeType right_size{width};
+        LAB_TRY {
+          while (left_size > 0 || (right_size > 0 && right)) {
+            if (left_size == 0 || (right_size > 0 && right && compare(ValueOf(right), ValueOf(left)))) {
+              tail->next_ = std::exchange(right, right->next_);
+              --right_size;
+            } else {
+              tail->next_ = std::exchange(left, left->next_);
+              --left_size;
+            }
+            tail = tail->next_;
+          }
+        }
+        LAB_CATCH(...) {
+          // Untaken left run nodes are still chained, relink them in front of the unprocessed rest.
+          tail->next_ = left;
+          while (--left_size > 0) {
+            left = left->next_;
+          }
+          left->next_ = right;
+          RelinkPrevious();
+          LAB_PROPAGATE_EXCEPTION;
+        }
+        rest = right;
+      }
+      tail->next_ = nullptr;
+    }
+    RelinkPrevious();
+  }
+
+  /**
+   * @brief Sorts the sequence in ascending order (stable) with `operator<`.
+   * @public
+   *
+   * @throws Propagates exception thrown by comparison, the order of elements is unspecified in that case.
+   */
+  constexpr auto Sort() -> void { Sort(std::less<>{}); }
+
+  /**
+   * @brief Merges sorted `other` into the sorted sequence with `compare` by relinking nodes.
+   * @public
+   *
+   * @throws Propagates exception thrown by `compare`, both lists stay valid but partially merged in that case.
+   *
+   * @details Stable, equivalent elements of `*this` precede elements of `other`. `other` becomes empty.
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `GetAllocator() != other.GetAllocator()`
+   */
+  template<typename Compare>
+  constexpr auto Merge(List& other, Compare compare) -> void {
+    if (this == &other) {
+      return;
+    }
+    assert(allocator_ == other.allocator_);
+    LinkPointer lhs{header_.next_};
+    LinkPointer rhs{other.header_.next_};
+    while (lhs != &header_ && rhs != &other.header_) {
+      if (compare(ValueOf(rhs), ValueOf(lhs))) {
+        LinkPointer next{rhs->next_};
+        Transfer(lhs, rhs, next);
+        --other.size_;
+        ++size_;
+        rhs = next;
+      } else {
+        lhs = lhs->next_;
+      }
+    }
+    Splice(cend(), other);
+  }
+
+  /**
+   * @brief Merges sorted `other` into the sorted sequence with `operator<` by relinking nodes.
+   * @public
+   *
+   * @throws Propagates exception thrown by comparison.
+   */
+  constexpr auto Merge(List& other) -> void { Merge(other, std::less<>{}); }
+
+  /**
+   * @brief Merges sorted `other` into the sorted sequence with `operator<` by relinking nodes.
+   * @public
+   *
+   * @throws Propagates exception thrown by comparison.
+   */
+  constexpr auto Merge(List&& other) -> void { Merge(other, std::less<>{}); }
+
+  /**
+   * @brief Reverses the order of elements by swapping links of every node.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto Reverse() noexcept -> void {
+    LinkPointer node{&header_};
+    do {
+      std::swap(node->prev_, node->next_);
+      node = node->prev_;
+    } while (node != &header_);
+  }
+
+  /**
+   * @brief Removes consecutive elements equivalent by `predicate`, keeping the first of each group.
+   * @public
+   *
+   * @throws Propagates exception thrown by `predicate`.
+   *
+   * @return `SizeType` Amount of removed elements.
+   */
+  template<typename BinaryPredicate>
+  constexpr auto Unique(BinaryPredicate predicate) -> SizeType {
+    const SizeType old_size{size_};
+    for (LinkPointer node{header_.next_}; node != &header_ && node->next_ != &header_;) {
+      if (LinkPointer next{node->next_}; predicate(ValueOf(node), ValueOf(next))) {
+        Erase(ConstIterator{next});
+      } else {
+        node = next;
+      }
+    }
+    return old_size - size_;
+  }
+
+  /**
+   * @brief Removes consecutive equal elements, keeping the first of each group.
+   * @public
+   *
+   * @throws Propagates exception thrown by `operator==`.
+   *
+   * @return `SizeType` Amount of removed elements.
+   */
+  constexpr auto Unique() -> SizeType { return Unique(std::equal_to<>{}); }
+
+  /**
+   * @brief Provides the ability to swap `List` instances.
+   * @public
+   *
+   * @throws May throw exception if user defined allocator throws when swapping.
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - allocators do not propagate on swap and `GetAllocator() != other.GetAllocator()`
+   */
+  constexpr auto Swap(List& other) noexcept(AllocatorTraits::is_always_equal::value) -> void {
+    assert(this != &other);
+    if constexpr (AllocatorTraits::propagate_on_container_swap::value) {
+      std::swap(allocator_, other.allocator_);
+    } else {
+      assert(kIsAllocatorAlwaysEqual || allocator_ == other.allocator_);
+    }
+    ListNodeBase temp;
+    MoveHeader(temp, header_);
+    MoveHeader(header_, other.header_);
+    MoveHeader(other.header_, temp);
+    std::swap(size_, other.size_);
+    std::swap(observer_, other.observer_);
+  }
+
+ private:
+  /**
+   * @brief Helper function for destructing the whole sequence.
+   * @private
+   * @internal
+   */
+  constexpr auto DeleteRange() noexcept -> void {
+    LinkPointer node{header_.next_};
+    while (node != &header_) {
+      DestroyNode(std::exchange(node, node->next_));
+    }
+    header_.prev_ = header_.next_ = &header_;
+    size_ = 0;
+  }
+
+ public:
+  /**
+   * @brief Copy assignment operator for `List`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @details Strong guarantee: the copy is built first, with `other`'s allocator when it propagates on copy
+   * assignment and with the own allocator otherwise.
+   */
+  auto operator=(const List& other) -> List& {
+    assert(this != &other);
+    List temp{MakeReplacement(kPropagatesOnCopyAssignment ? other.allocator_ : allocator_)};
+    temp.AppendRange(other.cbegin(), other.cend());
+    DeleteRange();
+    if constexpr (kPropagatesOnCopyAssignment) {
+      allocator_ = other.allocator_;
+    }
+    StealNodes(temp);
+    return *this;
+  }
+
+  /**
+   * @brief Move assignment operator for `List`.
+   * @public
+   *
+   * @throws `std::bad_alloc` only if the allocator does not propagate and `GetAllocator() != other.GetAllocator()`,
+   * the elements are moved one by one into own nodes then.
+   */
+  constexpr auto operator=(List&& other) noexcept(kPropagatesOnMoveAssignment || kIsAllocatorAlwaysEqual) -> List& {
+    assert(this != &other);
+    if constexpr (!kPropagatesOnMoveAssignment && !kIsAllocatorAlwaysEqual) {
+      if (allocator_ != other.allocator_) {
+        List temp{MakeReplacement(allocator_)};
+        temp.AppendRange(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        DeleteRange();
+        StealNodes(temp);
+        return *this;
+      }
+    }
+    DeleteRange();
+    if constexpr (kPropagatesOnMoveAssignment) {
+      allocator_ = std::move(other.allocator_);
+    }
+    StealNodes(other);
+    return *this;
+  }
+
+ private:
+  /**
+   * @brief Takes over the node ring of `other` together with its observer, the own sequence must be empty.
+   * @private
+   * @internal
+   */
+  constexpr auto StealNodes(List& other) noexcept -> void {
+    assert(!size_);
+    MoveHeader(header_, other.header_);
+    size_ = std::exchange(other.size_, 0);
+    observer_ = std::exchange(other.observer_, Observer{});
+  }
+
+  /**
+   * @brief Creates an empty list with `allocator` reporting to the own observer, used to build replacements
+   * before the own nodes are destroyed.
+   * @private
+   * @internal
+   */
+  [[nodiscard]] constexpr auto MakeReplacement(const AllocatorType& allocator) const -> List {
+    List replacement{allocator};
+    replacement.observer_ = observer_;
+    return replacement;
+  }
+
+  ListNodeBase header_;
+  [[no_unique_address]] AllocatorType allocator_;
+  SizeType size_{};
+  [[no_unique_address]] Observer observer_;
+};
+
+}  // namespace lab::containers
+
+namespace lab::pmr {
+
+/**
+ * @brief `List` allocating its nodes from a `std::pmr::memory_resource`.
+ */
+template<typename T, typename Observer = NullObserver>
+using List = containers::List<T, std::pmr::polymorphic_allocator<T>, Observer>;
+
+}  // namespace lab::pmr
+
+END_EXPORT_SECTION
@@ -0,0 +1,549 @@
+module;
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <system_error>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+#include <utility>
+
+export module lab_mapped_vector;
+
+import lab_vector_base;
+
+/**
+ * @brief Throws `std::system_error` for the current `errno`.
+ * @internal
+ */
+[[noreturn]] auto MappedVectorThrowErrno(const char* what) -> void {
+  throw std::system_error{errno, std::generic_category(), what};
+}
+
+/**
+ * @brief Maps `bytes` bytes of `fd` shared, `nullptr` for an empty file.
+ * @internal
+ */
+auto MappedVectorMap(
+  int fd,  //
+  std::size_t bytes,
+  bool writable
+) -> void* {
+  if (bytes == 0) {
+    return nullptr;
+  }
+  void* const address{::mmap(nullptr, bytes, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0)};
+  if (address == MAP_FAILED) {
+    MappedVectorThrowErrno("MappedVector: mmap");
+  }
+  return address;
+}
+
+/**
+ * @brief Changes the length of a writable mapping of `fd`, in place or by moving it where `mremap` exists.
+ * @internal
+ *
+ * @details On failure the old mapping is left untouched.
+ */
+auto MappedVectorRemap(
+  int fd,  //
+  void* address,
+  std::size_t old_bytes,
+  std::size_t new_bytes
+) -> void* {
+  if (address == nullptr) {
+    return MappedVectorMap(fd, new_bytes, true);
+  }
+  if (new_bytes == 0) {
+    ::munmap(address, old_bytes);
+    return nullptr;
+  }
+#ifdef MREMAP_MAYMOVE
+  void* const remapped{::mremap(address, old_bytes, new_bytes, MREMAP_MAYMOVE)};
+  if (remapped == MAP_FAILED) {
+    MappedVectorThrowErrno("MappedVector: mremap");
+  }
+  return remapped;
+#else
+  void* const remapped{MappedVectorMap(fd, new_bytes, true)};
+  ::munmap(address, old_bytes);
+  return remapped;
+#endif
+}
+
+/**
+ * @brief Sets the file length, new bytes read as zero.
+ * @internal
+ */
+auto MappedVectorTruncate(
+  int fd,  //
+  std::size_t bytes
+) -> void {
+  if (::ftruncate(fd, static_cast<::off_t>(bytes)) != 0) {
+    MappedVectorThrowErrno("MappedVector: ftruncate");
+  }
+}
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Expected access pattern of a mapping, forwarded to `madvise`.
+ */
+enum class AccessHint : std::uint8_t {
+  kNormal,
+  kSequential,
+  kRandom,
+  kWillNeed,
+};
+
+/**
+ * @brief Dynamic array of trivially copyable records stored in a memory mapped file (POSIX).
+ * @class
+ *
+ * @tparam T Record type; `const T` opens the file read-only
+ * @tparam GrowthPolicy Capacity growth policy, see `IsGrowthPolicy`
+ *
+ * @details The file is the raw array of records without any header, so files written by dumping a `Vector` open
+ * as is. Opening maps the whole file in O(1) and pages are loaded lazily on first access. Growth extends the file
+ * with `ftruncate` and remaps it (with `mremap` where available, so the kernel moves page tables instead of data);
+ * capacities are rounded to whole pages by the default policy.
+ *
+ * While the container is open the file may be longer than `Size()` records. `ShrinkToFit()`, `Close()` and the
+ * destructor truncate it back, a crash leaves up to `Capacity() - Size()` zero-filled records at its end.
+ *
+ * @note Changes reach the page cache immediately and the disk eventually, `Flush()` makes them durable. Iterators
+ * and references are invalidated by every remap.
+ */
+template<typename T, IsGrowthPolicy GrowthPolicy = PageGrowth>
+  requires std::is_trivially_copyable_v<T> && (alignof(T) <= 4096)
+class [[nodiscard]] MappedVector {
+ public:
+  using ValueType = std::remove_const_t<T>;
+  using value_type = std::remove_const_t<T>;
+  using Reference = T&;
+  using reference = T&;
+  using ConstReference = const T&;
+  using const_reference = const T&;
+  using Pointer = T*;
+  using pointer = T*;
+  using ConstPointer = const T*;
+  using const_pointer = const T*;
+  using DifferenceType = std::ptrdiff_t;
+  using difference_type = std::ptrdiff_t;
+  using SizeType = std::size_t;
+  using size_type = std::size_t;
+  using GrowthPolicyType = GrowthPolicy;
+  using Iterator = Pointer;
+  using iterator = pointer;
+  using ConstIterator = ConstPointer;
+  using const_iterator = const_pointer;
+  using ReverseIterator = std::reverse_iterator<Iterator>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_pointer>;
+
+  static constexpr bool kIsReadOnly{std::is_const_v<T>};
+
+  /**
+   * @brief Constructs a closed container.
+   */
+  MappedVector() noexcept = default;
+
+  /**
+   * @brief Opens `path`, read-only for `const T`, otherwise read-write and creating a missing file.
+   * @public
+   *
+   * @throws `std::system_error` if a system call fails, `std::runtime_error` if the file length is not a multiple
+   * of `sizeof(T)`.
+   */
+  explicit MappedVector(
+    const std::filesystem::path& path,  //
+    AccessHint hint = AccessHint::kNormal
+  )
+    : hint_{hint} {
+    fd_ = kIsReadOnly ? ::open(path.c_str(), O_RDONLY | O_CLOEXEC)
+                      : ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+      MappedVectorThrowErrno("MappedVector: open");
+    }
+    LAB_TRY {
+      struct ::stat status{};
+      if (::fstat(fd_, &status) != 0) {
+        MappedVectorThrowErrno("MappedVector: fstat");
+      }
+      const auto bytes{static_cast<std::size_t>(status.st_size)};
+      if (bytes % sizeof(T) != 0) {
+        throw std::runtime_error{std::format(
+          "MappedVector::MappedVector: file length (which is {}) is not a multiple of the record size (which is {})",
+          bytes,
+          sizeof(T)
+        )};
+      }
+      data_ = static_cast<Pointer>(MappedVectorMap(fd_, bytes, !kIsReadOnly));
+      size_ = capacity_ = bytes / sizeof(T);
+      Advise(hint_);
+    }
+    LAB_CATCH(...) {
+      ::close(fd_);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+  }
+
+  MappedVector(const MappedVector&) = delete;
+  auto operator=(const MappedVector&) -> MappedVector& = delete;
+
+  MappedVector(MappedVector&& other) noexcept
+    : data_{std::exchange(other.data_, nullptr)}
+    , size_{std::exchange(other.size_, 0)}
+    , capacity_{std::exchange(other.capacity_, 0)}
+    , fd_{std::exchange(other.fd_, -1)}
+    , hint_{other.hint_}
+    , growth_policy_{other.growth_policy_} { }
+
+  auto operator=(MappedVector&& other) noexcept -> MappedVector& {
+    if (this != &other) {
+      Release();
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+      capacity_ = std::exchange(other.capacity_, 0);
+      fd_ = std::exchange(other.fd_, -1);
+      hint_ = other.hint_;
+      growth_policy_ = other.growth_policy_;
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Truncates the file to `Size()` records and unmaps it, errors are ignored.
+   */
+  ~MappedVector() { Release(); }
+
+  [[nodiscard]] auto begin() noexcept -> Iterator { return data_; }
+
+  [[nodiscard]] auto end() noexcept -> Iterator { return data_ + size_; }
+
+  [[nodiscard]] auto begin() const noexcept -> ConstIterator { return data_; }
+
+  [[nodiscard]] auto end() const noexcept -> ConstIterator { return data_ + size_; }
+
+  [[nodiscard]] auto cbegin() const noexcept -> ConstIterator { return begin(); }
+
+  [[nodiscard]] auto cend() const noexcept -> ConstIterator { return end(); }
+
+  [[nodiscard]] auto rbegin() noexcept -> ReverseIterator { return ReverseIterator{end()}; }
+
+  [[nodiscard]] auto rend() noexcept -> ReverseIterator { return ReverseIterator{begin()}; }
+
+  [[nodiscard]] auto crbegin() const noexcept -> ConstReverseIterator { return ConstReverseIterator{cend()}; }
+
+  [[nodiscard]] auto crend() const noexcept -> ConstReverseIterator { return ConstReverseIterator{cbegin()}; }
+
+  [[nodiscard]] auto IsOpen() const noexcept -> bool { return fd_ >= 0; }
+
+  [[nodiscard]] auto Size() const noexcept -> SizeType { return size_; }
+
+  [[nodiscard]] auto Capacity() const noexcept -> SizeType { return capacity_; }
+
+  [[nodiscard]] auto Empty() const noexcept -> bool { return size_ == 0; }
+
+  [[nodiscard]] auto Data() noexcept -> Pointer { return data_; }
+
+  [[nodiscard]] auto Data() const noexcept -> ConstPointer { return data_; }
+
+  [[nodiscard]] auto GetGrowthPolicy() noexcept -> GrowthPolicyType& { return growth_policy_; }
+
+  [[nodiscard]] auto GetGrowthPolicy() const noexcept -> const GrowthPolicyType& { return growth_policy_; }
+
+  [[nodiscard]] auto operator[](SizeType index) noexcept -> Reference { return data_[index]; }
+
+  [[nodiscard]] auto operator[](SizeType index) const noexcept -> ConstReference { return data_[index]; }
+
+ private:
+  auto RangeCheck(SizeType index) const -> void {
+    if (index >= Size()) {
+      throw std::out_of_range{
+        std::format("MappedVector::RangeCheck: index (which is {}) >= this->size() (which is {})", index, Size())
+      };
+    }
+  }
+
+ public:
+  [[nodiscard]] auto At(SizeType index) -> Reference {
+    RangeCheck(index);
+    return data_[index];
+  }
+
+  [[nodiscard]] auto At(SizeType index) const -> ConstReference {
+    RangeCheck(index);
+    return data_[index];
+  }
+
+  [[nodiscard]] auto Front() noexcept -> Reference { return data_[0]; }
+
+  [[nodiscard]] auto Front() const noexcept -> ConstReference { return data_[0]; }
+
+  [[nodiscard]] auto Back() noexcept -> Reference { return data_[size_ - 1]; }
+
+  [[nodiscard]] auto Back() const noexcept -> ConstReference { return data_[size_ - 1]; }
+
+  /**
+   * @brief Forwards `hint` for the whole mapping to `madvise`, it is reapplied after every remap.
+   * @public
+   *
+   * @throws None (no-throw guarantee), the hint is advisory and failures are ignored.
+   */
+  auto Advise(AccessHint hint) noexcept -> void {
+    hint_ = hint;
+    if (data_ == nullptr) {
+      return;
+    }
+    int advice{MADV_NORMAL};
+    switch (hint) {
+      case AccessHint::kSequential:
+        advice = MADV_SEQUENTIAL;
+        break;
+      case AccessHint::kRandom:
+        advice = MADV_RANDOM;
+        break;
+      case AccessHint::kWillNeed:
+        advice = MADV_WILLNEED;
+        break;
+      default:
+        break;
+    }
+    ::madvise(const_cast<ValueType*>(data_), capacity_ * sizeof(T), advice);
+  }
+
+  /**
+   * @brief Grows the file and the mapping to hold at least `new_capacity` records.
+   * @public
+   *
+   * @throws `std::system_error` if a system call fails, the container is unchanged then.
+   */
+  auto Reserve(SizeType new_capacity) -> void
+    requires(!kIsReadOnly)
+  {
+    if (new_capacity > capacity_) {
+      Remap(static_cast<SizeType>(growth_policy_.Fit(new_capacity, sizeof(T))));
+    }
+  }
+
+  /**
+   * @brief Appends a record, growing the file by the growth policy when it is full.
+   * @public
+   *
+   * @throws `std::system_error` if a system call fails, the container is unchanged then.
+   *
+   * @details Arguments may refer to records of the container, the new record is built before a remap.
+   */
+  template<typename... Args>
+  auto EmplaceBack(Args&&... args) -> Reference
+    requires(!kIsReadOnly)
+  {
+    if (size_ == capacity_) {
+      const ValueType value(std::forward<Args>(args)...);
+      Grow(size_ + 1);
+      return *std::construct_at(data_ + size_++, value);
+    }
+    return *std::construct_at(data_ + size_++, std::forward<Args>(args)...);
+  }
+
+  auto PushBack(const ValueType& value) -> void
+    requires(!kIsReadOnly)
+  {
+    EmplaceBack(value);
+  }
+
+  /**
+   * @brief Appends copies of the records of `range`, with at most one remap for sized and forward ranges.
+   * @public
+   *
+   * @throws `std::system_error` if a system call fails.
+   */
+  template<std::ranges::input_range Range>
+    requires std::constructible_from<ValueType, std::ranges::range_reference_t<Range>>
+  auto AppendRange(Range&& range) -> void
+    requires(!kIsReadOnly)
+  {
+    if constexpr (std::ranges::forward_range<Range> || std::ranges::sized_range<Range>) {
+      const auto count{static_cast<SizeType>(std::ranges::distance(range))};
+      if (size_ + count > capacity_) {
+        Grow(size_ + count);
+      }
+      std::ranges::copy(range, data_ + size_);
+      size_ += count;
+    } else {
+      for (auto&& value : range) {
+        EmplaceBack(std::forward<decltype(value)>(value));
+      }
+    }
+  }
+
+  /**
+   * @brief Resizes to `new_size` records, new records are value-initialized.
+   * @public
+   *
+   * @throws `std::system_error` if a system call fails.
+   */
+  auto Resize(SizeType new_size) -> void
+    requires(!kIsReadOnly)
+  {
+    if (new_size > capacity_) {
+      Grow(new_size);
+    }
+    for (; size_ < new_size; ++size_) {
+      std::construct_at(data_ + size_);
+    }
+    size_ = new_size;
+  }
+
+  /**
+   * @brief Removes the last record.
+   * @public
+   *
+   * @warning **Undefined Behaviour** if:
+   * - the container is empty
+   */
+  auto PopBack() noexcept -> void
+    requires(!kIsReadOnly)
+  {
+    assert(!Empty());
+    --size_;
+  }
+
+  auto Clear() noexcept -> void
+    requires(!kIsReadOnly)
+  {
+    size_ = 0;
+  }
+
+  /**
+   * @brief Truncates the file and the mapping to `Size()` records.
+   * @public
+   *
+   * @throws `std::system_error` if a system call fails.
+   */
+  auto ShrinkToFit() -> void
+    requires(!kIsReadOnly)
+  {
+    if (size_ != capacity_) {
+      Remap(size_);
+    }
+  }
+
+  /**
+   * @brief Writes the dirty pages of the records back synchronously (`msync`).
+   * @public
+   *
+   * @throws `std::system_error` if a system call fails.
+   *
+   * @details The capacity and the file length are kept, so appending after a flush does not remap; call
+   * `ShrinkToFit()` as well to cut the file to `Size()` records before a crash can leave the spare ones behind.
+   */
+  auto Flush() -> void
+    requires(!kIsReadOnly)
+  {
+    if (data_ != nullptr && ::msync(data_, size_ * sizeof(T), MS_SYNC) != 0) {
+      MappedVectorThrowErrno("MappedVector::Flush: msync");
+    }
+  }
+
+  /**
+   * @brief Truncates the file to `Size()` records, unmaps and closes it.
+   * @public
+   *
+   * @throws None (no-throw guarantee), truncation failures are ignored like in the destructor.
+   */
+  auto Close() noexcept -> void { Release(); }
+
+  auto Swap(MappedVector& other) noexcept -> void {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(fd_, other.fd_);
+    std::swap(hint_, other.hint_);
+    std::swap(growth_policy_, other.growth_policy_);
+  }
+
+ private:
+  auto Grow(SizeType required) -> void {
+    Remap(static_cast<SizeType>(growth_policy_.Grow(capacity_, required, sizeof(T))));
+  }
+
+  /**
+   * @brief Sets the file length and the mapping to `new_capacity` records.
+   *
+   * @details Shrinking unmaps the tail before truncating, growing truncates before mapping, so no mapped page is
+   * ever past the end of the file (which would raise `SIGBUS` on access). A failed growth truncates the file back to
+   * its old length, so the container and the file are unchanged.
+   */
+  auto Remap(SizeType new_capacity) -> void {
+    const SizeType old_bytes{capacity_ * sizeof(T)};
+    const SizeType new_bytes{new_capacity * sizeof(T)};
+    if (new_capacity < capacity_) {
+      data_ = static_cast<Pointer>(MappedVectorRemap(fd_, data_, old_bytes, new_bytes));
+      capacity_ = new_capacity;
+      MappedVectorTruncate(fd_, new_bytes);
+    } else {
+      MappedVectorTruncate(fd_, new_bytes);
+      LAB_TRY {
+        data_ = static_cast<Pointer>(MappedVectorRemap(fd_, data_, old_bytes, new_bytes));
+      }
+      LAB_CATCH(...) {
+        static_cast<void>(::ftruncate(fd_, static_cast<::off_t>(old_bytes)));
+        LAB_PROPAGATE_EXCEPTION;
+      }
+      capacity_ = new_capacity;
+    }
+    Advise(hint_);
+  }
+
+  auto Release() noexcept -> void {
+    if (fd_ < 0) {
+      return;
+    }
+    if (data_ != nullptr) {
+      ::munmap(const_cast<ValueType*>(data_), capacity_ * sizeof(T));
+    }
+    if constexpr (!kIsReadOnly) {
+      if (size_ != capacity_) {
+        static_cast<void>(::ftruncate(fd_, static_cast<::off_t>(size_ * sizeof(T))));
+      }
+    }
+    ::close(fd_);
+    data_ = nullptr;
+    size_ = capacity_ = 0;
+    fd_ = -1;
+  }
+
+  Pointer data_{nullptr};
+  SizeType size_{};
+  SizeType capacity_{};
+  int fd_{-1};
+  AccessHint hint_{AccessHint::kNormal};
+  [[no_unique_address]] GrowthPolicyType growth_policy_{};
+};
+
+}  // namespace lab
+
+END_EXPORT_SECTION
@@ -0,0 +1,194 @@
+module;
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
+
+export module lab_monotonic_arena;
+
+/**
+ * @brief Header placed at the beginning of every upstream chunk, chunks form a stack.
+ * @internal
+ * @struct
+ */
+struct MonotonicArenaChunk final {
+  MonotonicArenaChunk* previous_;
+  std::size_t size_;
+};
+
+/**
+ * @brief Size of the first upstream chunk when none is given.
+ * @internal
+ */
+inline constexpr std::size_t kMonotonicArenaDefaultChunkSize{std::size_t{4} << 10};
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Bump allocating `std::pmr::memory_resource` that frees everything at once.
+ * @class
+ *
+ * @details Allocations are carved by bumping a pointer through an optional caller supplied buffer and then through
+ * geometrically growing chunks obtained from the upstream resource. `deallocate` only rewinds the most recent
+ * allocation, every other block is reclaimed by `Release()` or the destructor. Pair it with the `lab::pmr`
+ * container aliases to allocate per-request state and drop it by destroying the arena.
+ *
+ * @note Not thread-safe, like `std::pmr::monotonic_buffer_resource`.
+ */
+class MonotonicArena final : public std::pmr::memory_resource {
+ public:
+  /**
+   * @brief Constructs an arena whose first upstream chunk holds `initial_chunk_size` bytes.
+   * @public
+   *
+   * @throws None (no-throw guarantee), memory is requested lazily.
+   */
+  explicit MonotonicArena(
+    std::size_t initial_chunk_size = kMonotonicArenaDefaultChunkSize,  //
+    std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+  ) noexcept
+    : upstream_{upstream}
+    , initial_chunk_size_{std::max(initial_chunk_size, sizeof(MonotonicArenaChunk))}
+    , next_chunk_size_{initial_chunk_size_} {
+    assert(upstream_);
+  }
+
+  /**
+   * @brief Constructs an arena that serves allocations from `buffer` before touching `upstream`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `buffer` does not outlive the arena
+   */
+  explicit MonotonicArena(
+    std::span<std::byte> buffer,  //
+    std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+  ) noexcept
+    : MonotonicArena{std::max(buffer.size(), kMonotonicArenaDefaultChunkSize), upstream} {
+    initial_buffer_ = buffer;
+    current_ = buffer.data();
+    end_ = buffer.data() + buffer.size();
+  }
+
+  MonotonicArena(const MonotonicArena&) = delete;
+  auto operator=(const MonotonicArena&) -> MonotonicArena& = delete;
+
+  ~MonotonicArena() override { Release(); }
+
+  /**
+   * @brief Returns every upstream chunk and rewinds to the initial buffer.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - memory handed out before the call is used afterwards
+   */
+  auto Release() noexcept -> void {
+    while (chunks_) {
+      MonotonicArenaChunk* const chunk{chunks_};
+      chunks_ = chunk->previous_;
+      upstream_->deallocate(chunk, chunk->size_, alignof(std::max_align_t));
+    }
+    current_ = initial_buffer_.data();
+    end_ = initial_buffer_.data() + initial_buffer_.size();
+    next_chunk_size_ = initial_chunk_size_;
+    bytes_allocated_ = 0;
+  }
+
+  [[nodiscard]] auto Upstream() const noexcept -> std::pmr::memory_resource* { return upstream_; }
+
+  /**
+   * @brief Bytes handed out (and not rewound) since construction or the last `Release()`.
+   * @public
+   */
+  [[nodiscard]] auto BytesAllocated() const noexcept -> std::size_t { return bytes_allocated_; }
+
+ private:
+  auto do_allocate(
+    std::size_t bytes,  //
+    std::size_t alignment
+  ) -> void* override {
+    void* pointer{TryBump(bytes, alignment)};
+    if (!pointer) {
+      AllocateChunk(bytes, alignment);
+      pointer = TryBump(bytes, alignment);
+      assert(pointer);
+    }
+    bytes_allocated_ += bytes;
+    return pointer;
+  }
+
+  auto do_deallocate(
+    void* pointer,  //
+    std::size_t bytes,
+    [[maybe_unused]] std::size_t alignment
+  ) -> void override {
+    if (static_cast<std::byte*>(pointer) + bytes == current_) {
+      current_ = static_cast<std::byte*>(pointer);
+      bytes_allocated_ -= bytes;
+    }
+  }
+
+  [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override {
+    return this == &other;
+  }
+
+  [[nodiscard]] auto TryBump(
+    std::size_t bytes,  //
+    std::size_t alignment
+  ) noexcept -> void* {
+    void* pointer{current_};
+    auto space{static_cast<std::size_t>(end_ - current_)};
+    if (!current_ || !std::align(alignment, bytes, pointer, space)) {
+      return nullptr;
+    }
+    current_ = static_cast<std::byte*>(pointer) + bytes;
+    return pointer;
+  }
+
+  /**
+   * @brief Pushes an upstream chunk large enough for `bytes` aligned to `alignment`, doubling the chunk size.
+   * @private
+   * @internal
+   */
+  auto AllocateChunk(
+    std::size_t bytes,  //
+    std::size_t alignment
+  ) -> void {
+    const std::size_t size{std::max(next_chunk_size_, sizeof(MonotonicArenaChunk) + bytes + alignment)};
+    auto* const chunk{static_cast<MonotonicArenaChunk*>(upstream_->allocate(size, alignof(std::max_align_t)))};
+    chunk->previous_ = chunks_;
+    chunk->size_ = size;
+    chunks_ = chunk;
+    current_ = reinterpret_cast<std::byte*>(chunk) + sizeof(MonotonicArenaChunk);
+    end_ = reinterpret_cast<std::byte*>(chunk) + size;
+    next_chunk_size_ = size * 2;
+  }
+
+  std::pmr::memory_resource* upstream_;
+  std::span<std::byte> initial_buffer_{};
+  MonotonicArenaChunk* chunks_{nullptr};
+  std::byte* current_{nullptr};
+  std::byte* end_{nullptr};
+  std::size_t initial_chunk_size_;
+  std::size_t next_chunk_size_;
+  std::size_t bytes_allocated_{0};
+};
+
+}  // namespace lab
+
+END_EXPORT_SECTION
@@ -0,0 +1,355 @@
+module;
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+#include <utility>
+
+export module lab_node_pool;
+
+/**
+ * @brief Node slots of one size carved out of large chunks
+ * @internal
+ * @class
+ *
+ * @details Chunks are linked through their first slot, free slots are linked through the storage of dead nodes.
+ */
+class NodePoolSlab final {
+  struct FreeSlot {
+    FreeSlot* next_;
+  };
+
+ public:
+  NodePoolSlab(
+    std::size_t slot_size,  //
+    std::size_t slot_alignment,
+    std::size_t slots_per_chunk,
+    NodePoolSlab* next_slab
+  ) noexcept
+    : slot_alignment_{AlignmentOf(slot_alignment)},
+      slot_size_{SizeOf(slot_size, slot_alignment)},
+      slots_per_chunk_{slots_per_chunk},
+      next_slab_{next_slab} { }
+
+  NodePoolSlab(const NodePoolSlab&) = delete;
+
+  auto operator=(const NodePoolSlab&) -> NodePoolSlab& = delete;
+
+  ~NodePoolSlab() { Release(); }
+
+  [[nodiscard]] auto Allocate() -> void* {
+    if (free_list_) {
+      return std::exchange(free_list_, free_list_->next_);
+    }
+    if (cursor_ == last_) {
+      AllocateChunk();
+    }
+    return std::exchange(cursor_, cursor_ + slot_size_);
+  }
+
+  auto Deallocate(void* pointer) noexcept -> void {
+    assert(pointer);
+    free_list_ = ::new (pointer) FreeSlot{free_list_};
+  }
+
+  /**
+   * @brief Returns every chunk to the global allocator in O(chunks).
+   *
+   * @warning Invalidates every node obtained from the slab.
+   */
+  auto Release() noexcept -> void {
+    while (chunks_) {
+      FreeSlot* next{chunks_->next_};
+      ::operator delete(static_cast<void*>(chunks_), std::align_val_t{slot_alignment_});
+      chunks_ = next;
+    }
+    free_list_ = nullptr;
+    cursor_ = last_ = nullptr;
+    chunk_count_ = 0;
+  }
+
+  [[nodiscard]] auto Holds(
+    std::size_t slot_size,  //
+    std::size_t slot_alignment
+  ) const noexcept -> bool {
+    return slot_size_ == SizeOf(slot_size, slot_alignment) && slot_alignment_ == AlignmentOf(slot_alignment);
+  }
+
+  [[nodiscard]] auto ChunkCount() const noexcept -> std::size_t { return chunk_count_; }
+
+  [[nodiscard]] auto NextSlab() const noexcept -> NodePoolSlab* { return next_slab_; }
+
+ private:
+  [[nodiscard]] static constexpr auto AlignmentOf(std::size_t slot_alignment) noexcept -> std::size_t {
+    return std::max(slot_alignment, alignof(FreeSlot));
+  }
+
+  /**
+   * @brief Slot size rounded up so that consecutive slots stay aligned and can hold a free list link.
+   */
+  [[nodiscard]] static constexpr auto SizeOf(
+    std::size_t slot_size,  //
+    std::size_t slot_alignment
+  ) noexcept -> std::size_t {
+    const std::size_t alignment{AlignmentOf(slot_alignment)};
+    return (std::max(slot_size, sizeof(FreeSlot)) + alignment - 1) / alignment * alignment;
+  }
+
+  auto AllocateChunk() -> void {
+    auto* chunk{static_cast<std::byte*>(
+      ::operator new(slot_size_ * (slots_per_chunk_ + 1), std::align_val_t{slot_alignment_})
+    )};
+    chunks_ = ::new (chunk) FreeSlot{chunks_};
+    cursor_ = chunk + slot_size_;
+    last_ = cursor_ + slot_size_ * slots_per_chunk_;
+    ++chunk_count_;
+  }
+
+  std::size_t slot_alignment_;
+  std::size_t slot_size_;
+  std::size_t slots_per_chunk_;
+  NodePoolSlab* next_slab_;
+  FreeSlot* free_list_{nullptr};
+  FreeSlot* chunks_{nullptr};
+  std::byte* cursor_{nullptr};
+  std::byte* last_{nullptr};
+  std::size_t chunk_count_{};
+};
+
+/**
+ * @brief Shared state of `NodePool` copies and rebinds
+ * @internal
+ * @class
+ *
+ * @tparam SlotsPerChunk Amount of node slots carved out of one chunk
+ *
+ * @details Holds one slab per distinct slot size and alignment, created on the first allocation of that size.
+ */
+template<std::size_t SlotsPerChunk>
+class NodePoolState final {
+ public:
+  NodePoolState() noexcept = default;
+
+  NodePoolState(const NodePoolState&) = delete;
+
+  auto operator=(const NodePoolState&) -> NodePoolState& = delete;
+
+  ~NodePoolState() {
+    while (slabs_) {
+      delete std::exchange(slabs_, slabs_->NextSlab());
+    }
+  }
+
+  [[nodiscard]] auto FindSlab(
+    std::size_t slot_size,  //
+    std::size_t slot_alignment
+  ) const noexcept -> NodePoolSlab* {
+    for (NodePoolSlab* slab{slabs_}; slab; slab = slab->NextSlab()) {
+      if (slab->Holds(slot_size, slot_alignment)) {
+        return slab;
+      }
+    }
+    return nullptr;
+  }
+
+  [[nodiscard]] auto Slab(
+    std::size_t slot_size,  //
+    std::size_t slot_alignment
+  ) -> NodePoolSlab& {
+    if (NodePoolSlab* slab{FindSlab(slot_size, slot_alignment)}) {
+      return *slab;
+    }
+    slabs_ = new NodePoolSlab{slot_size, slot_alignment, SlotsPerChunk, slabs_};
+    return *slabs_;
+  }
+
+  auto Release() noexcept -> void {
+    for (NodePoolSlab* slab{slabs_}; slab; slab = slab->NextSlab()) {
+      slab->Release();
+    }
+  }
+
+  [[nodiscard]] auto ChunkCount() const noexcept -> std::size_t {
+    std::size_t count{};
+    for (const NodePoolSlab* slab{slabs_}; slab; slab = slab->NextSlab()) {
+      count += slab->ChunkCount();
+    }
+    return count;
+  }
+
+ private:
+  NodePoolSlab* slabs_{nullptr};
+};
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Slab allocator for node based containers.
+ * @class
+ *
+ * @tparam T Node type (containers rebind the allocator to their node type)
+ * @tparam SlotsPerChunk Amount of nodes carved out of one chunk
+ *
+ * @details Single node allocations are served from large chunks and recycled through an intrusive free list
+ * threaded through dead nodes. Requests for more than one object are forwarded to `std::allocator`.
+ * The pool is created by the default constructor and shared by every copy and every rebound allocator, each node
+ * size getting its own slab, so copies and rebinding round trips compare equal and can free each other's nodes.
+ * Only `select_on_container_copy_construction` produces a fresh pool, so every copied container owns its nodes.
+ *
+ * @note `NodePool` is not thread-safe.
+ */
+template<typename T, std::size_t SlotsPerChunk = 1024>
+  requires(SlotsPerChunk > 0)
+class NodePool {
+  template<typename U, std::size_t OtherSlotsPerChunk>
+    requires(OtherSlotsPerChunk > 0)
+  friend class NodePool;
+
+  using State = NodePoolState<SlotsPerChunk>;
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  template<typename U>
+  struct rebind {
+    using other = NodePool<U, SlotsPerChunk>;
+  };
+
+  /**
+   * @brief Default constructor for `NodePool`, creates a new empty pool.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails.
+   */
+  NodePool() : state_{std::make_shared<State>()} { }
+
+  /**
+   * @brief Copy constructor for `NodePool`, shares the pool.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @details There is no separate move constructor: a moved-from allocator keeps the pool and stays equal to the
+   * moved-to one, as the allocator requirements demand.
+   */
+  NodePool(const NodePool& other) noexcept = default;
+
+  /**
+   * @brief Rebinding constructor for `NodePool`, shares the pool of `other`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  template<typename U>
+  NodePool(const NodePool<U, SlotsPerChunk>& other) noexcept : state_{other.state_} { }
+
+  auto operator=(const NodePool& other) noexcept -> NodePool& = default;
+
+  ~NodePool() = default;
+
+  /**
+   * @brief Allocates storage for `n` objects.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails.
+   */
+  [[nodiscard]] auto allocate(size_type n) -> T* {
+    if (n != 1) {
+      return std::allocator<T>{}.allocate(n);
+    }
+    if (!slab_) {
+      slab_ = &state_->Slab(sizeof(T), alignof(T));
+    }
+    return static_cast<T*>(slab_->Allocate());
+  }
+
+  /**
+   * @brief Returns storage of `n` objects to the pool.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  auto deallocate(T* pointer, size_type n) noexcept -> void {
+    if (n != 1) {
+      std::allocator<T>{}.deallocate(pointer, n);
+      return;
+    }
+    if (!slab_) {
+      slab_ = state_->FindSlab(sizeof(T), alignof(T));
+    }
+    assert(slab_);
+    slab_->Deallocate(pointer);
+  }
+
+  /**
+   * @brief Returns a fresh pool for the copy of a container.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails.
+   */
+  [[nodiscard]] auto select_on_container_copy_construction() const -> NodePool { return {}; }
+
+  /**
+   * @brief Drops every chunk of the pool in O(chunks) instead of O(nodes).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning Every node obtained from the pool (by any copy or rebound allocator) becomes invalid, destructors are
+   * not run.
+   */
+  auto Release() noexcept -> void { state_->Release(); }
+
+  /**
+   * @brief Provides the ability to check whether no other allocator shares the pool.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] auto IsUnique() const noexcept -> bool { return state_.use_count() == 1; }
+
+  /**
+   * @brief Returns amount of chunks currently owned by the pool, for every node size.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] auto ChunkCount() const noexcept -> std::size_t { return state_->ChunkCount(); }
+
+  /**
+   * @brief Provides the ability to check whether `*this` and `other` can free each other's nodes.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @details True exactly when both share one pool, whatever their value types.
+   */
+  template<typename U>
+  [[nodiscard]] auto operator==(const NodePool<U, SlotsPerChunk>& other) const noexcept -> bool {
+    return state_ == other.state_;
+  }
+
+ private:
+  std::shared_ptr<State> state_;
+  NodePoolSlab* slab_{nullptr};
+};
+
+}  // namespace lab
+
+END_EXPORT_SECTION
@@ -0,0 +1,505 @@
+module;
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__clang__)
+  #define LAB_UNSEQUENCED_LOOP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+  #define LAB_UNSEQUENCED_LOOP _Pragma("GCC ivdep")
+#else
+  #define LAB_UNSEQUENCED_LOOP
+#endif
+
+export module lab_parallel;
+
+/**
+ * @brief Chunk boundaries are placed on this byte granularity, so two threads never write the same cache line.
+ * @internal
+ */
+inline constexpr std::size_t kParallelCacheLineSize{64};
+
+/**
+ * @brief Smallest chunk handed to a worker, smaller inputs run on the calling thread.
+ * @internal
+ */
+inline constexpr std::size_t kParallelMinChunkBytes{std::size_t{32} << 10};
+
+/**
+ * @brief Amount of chunks per thread, gives some load balancing without much scheduling overhead.
+ * @internal
+ */
+inline constexpr std::size_t kParallelChunksPerThread{4};
+
+/**
+ * @brief Concept for algorithm arguments
+ * @internal
+ * @concept IsParallelRange
+ */
+template<typename Range>
+concept IsParallelRange = std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>;
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for execution policies
+ * @namespace lab::execution
+ */
+namespace lab::execution {
+
+/**
+ * @brief Runs the algorithm on the calling thread.
+ */
+struct Sequenced { };
+
+/**
+ * @brief Splits the algorithm across `ThreadPool::Default()`.
+ */
+struct Parallel { };
+
+/**
+ * @brief Same as `Parallel`, additionally allows vectorizing element operations within a chunk.
+ *
+ * @warning Element operations must not synchronize with each other (no locks, no dependencies between elements).
+ */
+struct ParallelUnsequenced { };
+
+inline constexpr Sequenced kSeq{};
+inline constexpr Parallel kPar{};
+inline constexpr ParallelUnsequenced kParUnseq{};
+
+template<typename Policy>
+concept IsExecutionPolicy = std::same_as<std::remove_cvref_t<Policy>, Sequenced> ||
+                            std::same_as<std::remove_cvref_t<Policy>, Parallel> ||
+                            std::same_as<std::remove_cvref_t<Policy>, ParallelUnsequenced>;
+
+}  // namespace lab::execution
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Fixed size pool of worker threads running fork-join loops.
+ * @class
+ *
+ * @details The calling thread always takes part in `ParallelFor`, so nested calls from inside a chunk cannot
+ * deadlock and a pool without workers degrades to a plain loop.
+ */
+class ThreadPool {
+  struct Job {
+    void (*invoke)(void*, std::size_t);
+    void* body;
+    std::size_t count;
+    std::atomic<std::size_t> next{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr exception{};
+    std::size_t users{0};
+  };
+
+ public:
+  /**
+   * @brief Constructs pool with `worker_count` threads in addition to the caller.
+   * @public
+   *
+   * @throws `std::system_error` if a thread cannot be started.
+   */
+  explicit ThreadPool(std::size_t worker_count = DefaultWorkerCount()) {
+    workers_.reserve(worker_count);
+    LAB_TRY {
+      for (std::size_t i{}; i < worker_count; ++i) {
+        workers_.emplace_back([this] { WorkerLoop(); });
+      }
+    }
+    LAB_CATCH(...) {
+      Stop();
+      LAB_PROPAGATE_EXCEPTION;
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+
+  auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+
+  ~ThreadPool() { Stop(); }
+
+  /**
+   * @brief Process wide pool with `std::thread::hardware_concurrency() - 1` workers.
+   * @public
+   */
+  [[nodiscard]] static auto Default() -> ThreadPool& {
+    static ThreadPool pool;
+    return pool;
+  }
+
+  /**
+   * @brief Amount of threads executing a `ParallelFor` (workers and the caller).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] auto Concurrency() const noexcept -> std::size_t { return workers_.size() + 1; }
+
+  /**
+   * @brief Calls `body(i)` for every `i` in [0, `count`) and waits for completion.
+   * @public
+   *
+   * @throws Rethrows the first exception thrown by `body`, remaining unclaimed chunks are skipped.
+   */
+  template<typename Body>
+  auto ParallelFor(
+    std::size_t count,  //
+    Body&& body
+  ) -> void {
+    if (count <= 1 || workers_.empty()) {
+      for (std::size_t i{}; i < count; ++i) {
+        body(i);
+      }
+      return;
+    }
+
+    Job job{
+      .invoke = [](void* erased, std::size_t index) { (*static_cast<std::remove_reference_t<Body>*>(erased))(index); },
+      .body = static_cast<void*>(std::addressof(body)),
+      .count = count,
+    };
+    {
+      const std::scoped_lock lock{mutex_};
+      jobs_.push_back(&job);
+    }
+    work_available_.notify_all();
+    RunChunks(job);
+    {
+      std::unique_lock lock{mutex_};
+      std::erase(jobs_, &job);
+      job_released_.wait(lock, [&job] { return !job.users; });
+    }
+    if (job.exception) {
+      std::rethrow_exception(job.exception);
+    }
+  }
+
+ private:
+  [[nodiscard]] static auto DefaultWorkerCount() noexcept -> std::size_t {
+    const unsigned concurrency{std::thread::hardware_concurrency()};
+    return concurrency ? concurrency - 1 : 0;
+  }
+
+  static auto RunChunks(Job& job) noexcept -> void {
+    for (std::size_t index{}; (index = job.next.fetch_add(1, std::memory_order_relaxed)) < job.count;) {
+      LAB_TRY { job.invoke(job.body, index); }
+      LAB_CATCH(...) {
+        if (!job.failed.exchange(true, std::memory_order_relaxed)) {
+          job.exception = std::current_exception();
+        }
+        job.next.store(job.count, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * @brief Joins the front job until every chunk is claimed, the job outlives it through `Job::users`.
+   * @private
+   * @internal
+   */
+  auto WorkerLoop() -> void {
+    std::unique_lock lock{mutex_};
+    while (true) {
+      work_available_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+      if (stopping_) {
+        return;
+      }
+      Job* const job{jobs_.front()};
+      ++job->users;
+      lock.unlock();
+      RunChunks(*job);
+      lock.lock();
+      if (!jobs_.empty() && jobs_.front() == job) {
+        jobs_.pop_front();
+      }
+      if (!--job->users) {
+        job_released_.notify_all();
+      }
+    }
+  }
+
+  auto Stop() noexcept -> void {
+    {
+      const std::scoped_lock lock{mutex_};
+      stopping_ = true;
+    }
+    work_available_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+    workers_.clear();
+  }
+
+  std::mutex mutex_;
+  std::condition_variable work_available_;
+  std::condition_variable job_released_;
+  std::deque<Job*> jobs_;
+  bool stopping_{false};
+  std::vector<std::thread> workers_;
+};
+
+/**
+ * @brief Namespace for implementation details shared with other modules
+ * @namespace lab::detail
+ */
+namespace detail {
+
+/**
+ * @brief Splits [0, `n`) elements starting at `base` into cache-line-aligned chunks and calls `body(first, last)`.
+ * @internal
+ *
+ * @details Every chunk boundary except 0 and `n` lands on a cache line boundary of the buffer, so chunks written by
+ * different threads never share a line. Sequential policy and small inputs run `body(0, n)` on the caller.
+ */
+template<typename T, typename Body>
+auto ForEachChunk(
+  execution::IsExecutionPolicy auto policy,  //
+  const T* base,
+  std::size_t n,
+  Body&& body
+) -> void {
+  if (!n) {
+    return;
+  }
+  if constexpr (std::same_as<decltype(policy), execution::Sequenced>) {
+    body(std::size_t{0}, n);
+    return;
+  }
+  constexpr std::size_t kMinChunk{std::max<std::size_t>(1, kParallelMinChunkBytes / sizeof(T))};
+  ThreadPool& pool{ThreadPool::Default()};
+  if (pool.Concurrency() == 1 || n < 2 * kMinChunk) {
+    body(std::size_t{0}, n);
+    return;
+  }
+
+  constexpr std::size_t kStep{std::lcm(kParallelCacheLineSize, sizeof(T)) / sizeof(T)};
+  std::size_t chunk{std::max(kMinChunk, (n + pool.Concurrency() * kParallelChunksPerThread - 1) /
+                                          (pool.Concurrency() * kParallelChunksPerThread))};
+  chunk = (chunk + kStep - 1) / kStep * kStep;
+
+  std::size_t head{};
+  const auto address{reinterpret_cast<std::uintptr_t>(base)};
+  while (head < kStep && (address + head * sizeof(T)) % kParallelCacheLineSize) {
+    ++head;
+  }
+  if (head == kStep) {
+    head = 0;
+  }
+
+  const std::size_t count{head + chunk >= n ? 1 : 1 + (n - head - 1) / chunk};
+  pool.ParallelFor(count, [&](std::size_t index) {
+    body(index ? head + index * chunk : 0, std::min(n, head + (index + 1) * chunk));
+  });
+}
+
+}  // namespace detail
+
+/**
+ * @brief Calls `function` on every element of `range`.
+ *
+ * @throws Propagates the first exception thrown by `function`.
+ */
+template<IsParallelRange Range, typename Function>
+auto ForEach(
+  execution::IsExecutionPolicy auto policy,  //
+  Range&& range,
+  Function function
+) -> void {
+  auto* const data{std::ranges::data(range)};
+  detail::ForEachChunk(policy, data, std::ranges::size(range), [&](std::size_t first, std::size_t last) {
+    if constexpr (std::same_as<decltype(policy), execution::ParallelUnsequenced>) {
+      LAB_UNSEQUENCED_LOOP
+      for (std::size_t i{first}; i < last; ++i) {
+        std::invoke(function, data[i]);
+      }
+    } else {
+      for (std::size_t i{first}; i < last; ++i) {
+        std::invoke(function, data[i]);
+      }
+    }
+  });
+}
+
+/**
+ * @brief Writes `operation(input[i])` to `output[i]`.
+ *
+ * @throws Propagates the first exception thrown by `operation`.
+ *
+ * @warning **Undefined Behaviour** if:
+ * - `output` holds less elements than `input`
+ * - `input` and `output` partially overlap
+ */
+template<typename InputRange, IsParallelRange OutputRange, typename Operation>
+  requires IsParallelRange<const InputRange&>
+auto Transform(
+  execution::IsExecutionPolicy auto policy,  //
+  const InputRange& input,
+  OutputRange&& output,
+  Operation operation
+) -> void {
+  assert(std::ranges::size(output) >= std::ranges::size(input));
+  const auto* const source{std::ranges::data(input)};
+  auto* const destination{std::ranges::data(output)};
+  detail::ForEachChunk(policy, destination, std::ranges::size(input), [&](std::size_t first, std::size_t last) {
+    if constexpr (std::same_as<decltype(policy), execution::ParallelUnsequenced>) {
+      LAB_UNSEQUENCED_LOOP
+      for (std::size_t i{first}; i < last; ++i) {
+        destination[i] = std::invoke(operation, source[i]);
+      }
+    } else {
+      for (std::size_t i{first}; i < last; ++i) {
+        destination[i] = std::invoke(operation, source[i]);
+      }
+    }
+  });
+}
+
+/**
+ * @brief Assigns `value` to every element of `range`.
+ *
+ * @throws Propagates the first exception thrown by copy assignment.
+ */
+template<IsParallelRange Range>
+auto Fill(
+  execution::IsExecutionPolicy auto policy,  //
+  Range&& range,
+  const std::ranges::range_value_t<Range>& value
+) -> void {
+  auto* const data{std::ranges::data(range)};
+  detail::ForEachChunk(policy, data, std::ranges::size(range), [&](std::size_t first, std::size_t last) {
+    std::fill(data + first, data + last, value);
+  });
+}
+
+/**
+ * @brief Copies `input` to the beginning of `output`.
+ *
+ * @throws Propagates the first exception thrown by copy assignment.
+ *
+ * @warning **Undefined Behaviour** if:
+ * - `output` holds less elements than `input`
+ * - `input` and `output` overlap
+ */
+template<typename InputRange, IsParallelRange OutputRange>
+  requires IsParallelRange<const InputRange&>
+auto Copy(
+  execution::IsExecutionPolicy auto policy,  //
+  const InputRange& input,
+  OutputRange&& output
+) -> void {
+  assert(std::ranges::size(output) >= std::ranges::size(input));
+  const auto* const source{std::ranges::data(input)};
+  auto* const destination{std::ranges::data(output)};
+  detail::ForEachChunk(policy, destination, std::ranges::size(input), [&](std::size_t first, std::size_t last) {
+    std::copy(source + first, source + last, destination + first);
+  });
+}
+
+/**
+ * @brief Folds `range` into `init` with `operation`.
+ *
+ * @throws Propagates the first exception thrown by `operation`.
+ *
+ * @details Parallel policies reduce every chunk separately and fold the partial results in chunk order, so
+ * `operation` must be associative (as for `std::reduce`, commutativity is not required here).
+ */
+template<typename Range, typename T, typename Operation = std::plus<>>
+  requires IsParallelRange<const Range&>
+[[nodiscard]] auto Reduce(
+  execution::IsExecutionPolicy auto policy,  //
+  const Range& range,
+  T init,
+  Operation operation = {}
+) -> T {
+  const auto* const data{std::ranges::data(range)};
+  const std::size_t size{std::ranges::size(range)};
+  if constexpr (std::same_as<decltype(policy), execution::Sequenced>) {
+    return std::accumulate(data, data + size, std::move(init), operation);
+  } else {
+    std::vector<std::pair<std::size_t, std::optional<T>>> partials(
+      ThreadPool::Default().Concurrency() * kParallelChunksPerThread + 1
+    );
+    std::atomic<std::size_t> count{0};
+    detail::ForEachChunk(policy, data, size, [&](std::size_t first, std::size_t last) {
+      T partial(data[first]);
+      for (std::size_t i{first + 1}; i < last; ++i) {
+        partial = std::invoke(operation, std::move(partial), data[i]);
+      }
+      auto& slot{partials[count.fetch_add(1, std::memory_order_relaxed)]};
+      slot.first = first;
+      slot.second.emplace(std::move(partial));
+    });
+    partials.resize(count.load(std::memory_order_relaxed));
+    std::ranges::sort(partials, std::ranges::less{}, &std::pair<std::size_t, std::optional<T>>::first);
+    for (auto& [first, partial] : partials) {
+      init = std::invoke(operation, std::move(init), std::move(*partial));
+    }
+    return init;
+  }
+}
+
+/**
+ * @brief Sorts `range` with `compare`, not stable.
+ *
+ * @throws `std::bad_alloc` if merge buffer allocation fails or propagates exception thrown by `compare`/moves.
+ *
+ * @details Parallel policies sort one run per thread, then merge neighbouring runs pairwise in parallel rounds.
+ */
+template<IsParallelRange Range, typename Compare = std::ranges::less>
+auto Sort(
+  execution::IsExecutionPolicy auto policy,  //
+  Range&& range,
+  Compare compare = {}
+) -> void {
+  auto* const data{std::ranges::data(range)};
+  const std::size_t size{std::ranges::size(range)};
+  constexpr std::size_t kMinRun{std::max<std::size_t>(2, kParallelMinChunkBytes / sizeof(*data))};
+  if (std::same_as<decltype(policy), execution::Sequenced> || size < 2 * kMinRun ||
+      ThreadPool::Default().Concurrency() == 1) {
+    std::sort(data, data + size, std::ref(compare));
+    return;
+  }
+
+  ThreadPool& pool{ThreadPool::Default()};
+  const std::size_t runs{std::min(std::bit_ceil(pool.Concurrency()), std::bit_floor(size / kMinRun))};
+  const auto boundary{[&](std::size_t run) { return data + std::min(run, runs) * size / runs; }};
+  pool.ParallelFor(runs, [&](std::size_t run) { std::sort(boundary(run), boundary(run + 1), std::ref(compare)); });
+  for (std::size_t width{1}; width < runs; width <<= 1) {
+    pool.ParallelFor(runs / (2 * width), [&](std::size_t pair) {
+      const std::size_t first{pair * 2 * width};
+      std::inplace_merge(boundary(first), boundary(first + width), boundary(first + 2 * width), std::ref(compare));
+    });
+  }
+}
+
+}  // namespace lab
+
+END_EXPORT_SECTION
@@ -0,0 +1,696 @@
+module;
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <format>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+#include <utility>
+
+export module lab_ring_deque;
+
+import lab_vector_base;
+
+/**
+ * @brief Producer and consumer indices of `SpscRingQueue` live on separate cache lines of this size.
+ * @internal
+ */
+inline constexpr std::size_t kRingDequeCacheLineSize{64};
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Double-ended queue in one contiguous circular buffer.
+ * @class
+ *
+ * @tparam T Value type to store in container
+ * @tparam Allocator Allocator type to use in container
+ *
+ * @details The capacity is always a power of two, so the physical slot of logical index `i` is
+ * `(head + i) & (capacity - 1)` and both ends grow and shrink in O(1) without node allocations. A full buffer
+ * doubles: the at most two contiguous runs of elements are relocated in a single pass to the front of the new
+ * buffer (a `std::memcpy` for trivially relocatable `T`). Throwing relocations copy instead, which keeps the strong
+ * guarantee.
+ *
+ * @note Iterators and references are invalidated by every reallocation, iterators also by `PushFront`/`PopFront`.
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+class [[nodiscard]] RingDeque : protected detail::VectorBase<T, Allocator> {
+ protected:
+  using Base = detail::VectorBase<T, Allocator>;
+  using AllocatorTraits = Base::AllocatorTraits;
+  static constexpr bool kIsNothrowRelocatable{
+    kIsTriviallyRelocatable<T> || std::is_nothrow_move_constructible_v<T>
+  };
+
+ public:
+  using ValueType = Base::ValueType;
+  using value_type = Base::ValueType;
+  using Reference = Base::Reference;
+  using reference = Base::Reference;
+  using ConstReference = Base::ConstReference;
+  using const_reference = Base::ConstReference;
+  using Pointer = Base::Pointer;
+  using pointer = Base::Pointer;
+  using ConstPointer = Base::ConstPointer;
+  using const_pointer = Base::ConstPointer;
+  using DifferenceType = Base::DifferenceType;
+  using difference_type = Base::DifferenceType;
+  using SizeType = Base::SizeType;
+  using size_type = Base::SizeType;
+  using AllocatorType = Base::AllocatorType;
+  using allocator_type = Base::AllocatorType;
+  using Iterator = detail::IndexIterator<false, RingDeque>;
+  using iterator = Iterator;
+  using ConstIterator = detail::IndexIterator<true, RingDeque>;
+  using const_iterator = ConstIterator;
+  using ReverseIterator = std::reverse_iterator<Iterator>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  /**
+   * @brief Capacity of the first allocation.
+   */
+  static constexpr SizeType kMinCapacity{8};
+
+  RingDeque() noexcept(std::is_nothrow_default_constructible_v<AllocatorType>) = default;
+
+  explicit RingDeque(const AllocatorType& allocator) noexcept : allocator_{allocator} { }
+
+  RingDeque(
+    std::initializer_list<ValueType> values,  //
+    const AllocatorType& allocator = AllocatorType{}
+  )
+    : allocator_{allocator} {
+    AssignFrom(values.begin(), values.size());
+  }
+
+  /**
+   * @brief Copy constructor, the copy starts at slot 0 of the smallest power-of-two buffer that fits.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  RingDeque(const RingDeque& other)
+    : allocator_{AllocatorTraits::select_on_container_copy_construction(other.allocator_)} {
+    AssignFrom(other.begin(), other.Size());
+  }
+
+  RingDeque(
+    const RingDeque& other,  //
+    const AllocatorType& allocator
+  )
+    : allocator_{allocator} {
+    AssignFrom(other.begin(), other.Size());
+  }
+
+  RingDeque(RingDeque&& other) noexcept : allocator_{std::move(other.allocator_)} { StealFrom(other); }
+
+  /**
+   * @brief Move constructor with explicit allocator.
+   * @public
+   *
+   * @details Steals the buffer of `other` when the allocators compare equal, otherwise moves its elements into a
+   * buffer obtained from `allocator`.
+   */
+  RingDeque(
+    RingDeque&& other,  //
+    const AllocatorType& allocator
+  )
+    : allocator_{allocator} {
+    if (AllocatorTraits::is_always_equal::value || allocator_ == other.allocator_) {
+      StealFrom(other);
+    } else {
+      AssignFrom(std::make_move_iterator(other.begin()), other.Size());
+    }
+  }
+
+  auto operator=(const RingDeque& other) -> RingDeque& {
+    if (this != &other) {
+      if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value) {
+        RingDeque temp{other, other.allocator_};
+        Release();
+        allocator_ = std::move(temp.allocator_);
+        StealFrom(temp);
+      } else {
+        RingDeque temp{other, allocator_};
+        Release();
+        StealFrom(temp);
+      }
+    }
+    return *this;
+  }
+
+  auto operator=(RingDeque&& other) noexcept(
+    AllocatorTraits::propagate_on_container_move_assignment::value || AllocatorTraits::is_always_equal::value
+  ) -> RingDeque& {
+    if (this == &other) {
+      return *this;
+    }
+    if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+      Release();
+      allocator_ = std::move(other.allocator_);
+      StealFrom(other);
+    } else {
+      if (AllocatorTraits::is_always_equal::value || allocator_ == other.allocator_) {
+        Release();
+        StealFrom(other);
+      } else {
+        RingDeque temp{std::move(other), allocator_};
+        Release();
+        StealFrom(temp);
+      }
+    }
+    return *this;
+  }
+
+  ~RingDeque() { Release(); }
+
+  [[nodiscard]] auto begin() noexcept -> Iterator { return {this, 0}; }
+
+  [[nodiscard]] auto end() noexcept -> Iterator { return {this, Size()}; }
+
+  [[nodiscard]] auto begin() const noexcept -> ConstIterator { return {this, 0}; }
+
+  [[nodiscard]] auto end() const noexcept -> ConstIterator { return {this, Size()}; }
+
+  [[nodiscard]] auto cbegin() const noexcept -> ConstIterator { return begin(); }
+
+  [[nodiscard]] auto cend() const noexcept -> ConstIterator { return end(); }
+
+  [[nodiscard]] auto rbegin() noexcept -> ReverseIterator { return ReverseIterator{end()}; }
+
+  [[nodiscard]] auto rend() noexcept -> ReverseIterator { return ReverseIterator{begin()}; }
+
+  [[nodiscard]] auto crbegin() const noexcept -> ConstReverseIterator { return ConstReverseIterator{cend()}; }
+
+  [[nodiscard]] auto crend() const noexcept -> ConstReverseIterator { return ConstReverseIterator{cbegin()}; }
+
+  [[nodiscard]] auto Size() const noexcept -> SizeType { return tail_ - head_; }
+
+  [[nodiscard]] auto Empty() const noexcept -> bool { return head_ == tail_; }
+
+  /**
+   * @brief Number of slots of the buffer, zero or a power of two.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] auto Capacity() const noexcept -> SizeType { return capacity_; }
+
+  [[nodiscard]] auto MaxSize() const noexcept -> SizeType {
+    return std::bit_floor(static_cast<SizeType>(AllocatorTraits::max_size(allocator_)));
+  }
+
+  [[nodiscard]] auto GetAllocator() const noexcept -> AllocatorType { return allocator_; }
+
+  /**
+   * @brief Element at logical `index`, one add and one mask away from the buffer.
+   * @public
+   *
+   * @warning **Undefined Behaviour** if:
+   * - `index >= Size()`
+   */
+  [[nodiscard]] auto operator[](SizeType index) noexcept -> Reference { return buffer_[Slot(index)]; }
+
+  [[nodiscard]] auto operator[](SizeType index) const noexcept -> ConstReference { return buffer_[Slot(index)]; }
+
+ private:
+  auto RangeCheck(SizeType index) const -> void {
+    if (index >= Size()) {
+      throw std::out_of_range{
+        std::format("RingDeque::RangeCheck: index (which is {}) >= this->size() (which is {})", index, Size())
+      };
+    }
+  }
+
+ public:
+  [[nodiscard]] auto At(SizeType index) -> Reference {
+    RangeCheck(index);
+    return (*this)[index];
+  }
+
+  [[nodiscard]] auto At(SizeType index) const -> ConstReference {
+    RangeCheck(index);
+    return (*this)[index];
+  }
+
+  [[nodiscard]] auto Front() noexcept -> Reference { return (*this)[0]; }
+
+  [[nodiscard]] auto Front() const noexcept -> ConstReference { return (*this)[0]; }
+
+  [[nodiscard]] auto Back() noexcept -> Reference { return (*this)[Size() - 1]; }
+
+  [[nodiscard]] auto Back() const noexcept -> ConstReference { return (*this)[Size() - 1]; }
+
+  /**
+   * @brief Grows the buffer to hold at least `n` elements, rounded up to a power of two.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or `std::length_error` if `n` exceeds
+   * `MaxSize()`, the container is left unchanged.
+   */
+  auto Reserve(SizeType n) -> void {
+    if (n <= capacity_) {
+      return;
+    }
+    if (n > MaxSize()) {
+      throw std::length_error{"RingDeque::Reserve: requested capacity exceeds MaxSize()"};
+    }
+    const SizeType capacity{std::bit_ceil(n)};
+    const Pointer buffer{AllocatorTraits::allocate(allocator_, capacity)};
+    LAB_TRY {
+      RelocateInto(buffer);
+    }
+    LAB_CATCH(...) {
+      AllocatorTraits::deallocate(allocator_, buffer, capacity);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    AdoptBuffer(buffer, capacity, 0, Size());
+  }
+
+  /**
+   * @brief Constructs the object at the end of the container with `args`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception, the
+   * container is left unchanged.
+   *
+   * @return Reference to the constructed element.
+   */
+  template<typename... Args>
+  auto EmplaceBack(Args&&... args) -> Reference {
+    // Indices are read before and written after the construction, whose stores may alias them for integer `T`.
+    const SizeType tail{tail_};
+    if (tail - head_ == capacity_) {
+      return GrowAndEmplace<false>(std::forward<Args>(args)...);
+    }
+    const Pointer slot{buffer_ + (tail & (capacity_ - 1))};
+    AllocatorTraits::construct(allocator_, std::to_address(slot), std::forward<Args>(args)...);
+    tail_ = tail + 1;
+    return *slot;
+  }
+
+  auto PushBack(const ValueType& value) -> Reference { return EmplaceBack(value); }
+
+  auto PushBack(ValueType&& value) -> Reference { return EmplaceBack(std::move(value)); }
+
+  /**
+   * @brief Constructs the object at the beginning of the container with `args`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception, the
+   * container is left unchanged.
+   *
+   * @return Reference to the constructed element.
+   */
+  template<typename... Args>
+  auto EmplaceFront(Args&&... args) -> Reference {
+    const SizeType head{head_ - 1};
+    if (tail_ - head_ == capacity_) {
+      return GrowAndEmplace<true>(std::forward<Args>(args)...);
+    }
+    const Pointer slot{buffer_ + (head & (capacity_ - 1))};
+    AllocatorTraits::construct(allocator_, std::to_address(slot), std::forward<Args>(args)...);
+    head_ = head;
+    return *slot;
+  }
+
+  auto PushFront(const ValueType& value) -> Reference { return EmplaceFront(value); }
+
+  auto PushFront(ValueType&& value) -> Reference { return EmplaceFront(std::move(value)); }
+
+  /**
+   * @brief Destroys the first element.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   * - container is empty
+   */
+  auto PopFront() noexcept -> void {
+    assert(!Empty());
+    const SizeType head{head_};
+    AllocatorTraits::destroy(allocator_, std::to_address(buffer_ + (head & (capacity_ - 1))));
+    head_ = head + 1;
+  }
+
+  /**
+   * @brief Destroys the last element.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   * - container is empty
+   */
+  auto PopBack() noexcept -> void {
+    assert(!Empty());
+    const SizeType tail{tail_ - 1};
+    AllocatorTraits::destroy(allocator_, std::to_address(buffer_ + (tail & (capacity_ - 1))));
+    tail_ = tail;
+  }
+
+  /**
+   * @brief Destroys every element, keeps the buffer.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  auto Clear() noexcept -> void {
+    DestroyElements();
+    head_ = 0;
+    tail_ = 0;
+  }
+
+  /**
+   * @brief Swaps contents of two containers, allocators are swapped only if they propagate on swap.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  auto Swap(RingDeque& other) noexcept -> void {
+    std::swap(buffer_, other.buffer_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    if constexpr (AllocatorTraits::propagate_on_container_swap::value) {
+      std::ranges::swap(allocator_, other.allocator_);
+    }
+  }
+
+  [[nodiscard]] friend auto operator==(
+    const RingDeque& lhs,  //
+    const RingDeque& rhs
+  ) -> bool
+    requires std::equality_comparable<ValueType>
+  {
+    return std::ranges::equal(lhs, rhs);
+  }
+
+ private:
+  /**
+   * @brief Physical head slot, lengths of the run from it to the end of the buffer and of the wrapped run from slot 0.
+   * @private
+   * @internal
+   */
+  struct RunLengths {
+    SizeType head;
+    SizeType first;
+    SizeType second;
+  };
+
+  [[nodiscard]] auto Slot(SizeType index) const noexcept -> SizeType { return (head_ + index) & (capacity_ - 1); }
+
+  [[nodiscard]] auto Runs() const noexcept -> RunLengths {
+    const SizeType head{head_ & (capacity_ - 1)};
+    const SizeType first{std::min(Size(), capacity_ - head)};
+    return {head, first, Size() - first};
+  }
+
+  /**
+   * @brief Moves the elements, front first, to the beginning of `buffer` in one pass over both runs.
+   * @private
+   * @internal
+   *
+   * @details The old elements are destroyed only once both runs arrived, a throwing copy leaves them untouched.
+   */
+  auto RelocateInto(Pointer buffer) -> void {
+    const auto [head, first_count, second_count]{Runs()};
+    if constexpr (kIsNothrowRelocatable) {
+      this->UninitializedRelocateUsingAllocator(buffer_ + head, buffer_ + head + first_count, buffer, allocator_);
+      this->UninitializedRelocateUsingAllocator(buffer_, buffer_ + second_count, buffer + first_count, allocator_);
+    } else {
+      this->UninitializedCopyUsingAllocator(buffer_ + head, buffer_ + head + first_count, buffer, allocator_);
+      LAB_TRY {
+        this->UninitializedCopyUsingAllocator(buffer_, buffer_ + second_count, buffer + first_count, allocator_);
+      }
+      LAB_CATCH(...) {
+        this->DestroyUsingAllocator(buffer, buffer + first_count, allocator_);
+        LAB_PROPAGATE_EXCEPTION;
+      }
+      DestroyElements();
+    }
+  }
+
+  auto DestroyElements() noexcept -> void {
+    const auto [head, first_count, second_count]{Runs()};
+    this->DestroyUsingAllocator(buffer_ + head, buffer_ + head + first_count, allocator_);
+    this->DestroyUsingAllocator(buffer_, buffer_ + second_count, allocator_);
+  }
+
+  /**
+   * @brief Doubles the buffer and constructs the new element in it before the old ones are relocated.
+   * @private
+   * @internal
+   *
+   * @details Constructing first keeps `args` that refer to elements of the container valid. The old elements land
+   * in slots [0, size), the new one right behind them or, for `kAtFront`, in the last slot.
+   */
+  template<bool kAtFront, typename... Args>
+  auto GrowAndEmplace(Args&&... args) -> Reference {
+    if (capacity_ == MaxSize()) {
+      throw std::length_error{"RingDeque::GrowAndEmplace: container is at MaxSize()"};
+    }
+    const SizeType capacity{capacity_ ? capacity_ * 2 : kMinCapacity};
+    const Pointer buffer{AllocatorTraits::allocate(allocator_, capacity)};
+    const SizeType size{Size()};
+    const SizeType slot{kAtFront ? capacity - 1 : size};
+    LAB_TRY {
+      AllocatorTraits::construct(allocator_, std::to_address(buffer + slot), std::forward<Args>(args)...);
+    }
+    LAB_CATCH(...) {
+      AllocatorTraits::deallocate(allocator_, buffer, capacity);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    LAB_TRY {
+      RelocateInto(buffer);
+    }
+    LAB_CATCH(...) {
+      AllocatorTraits::destroy(allocator_, std::to_address(buffer + slot));
+      AllocatorTraits::deallocate(allocator_, buffer, capacity);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    AdoptBuffer(buffer, capacity, kAtFront ? slot : 0, size + 1);
+    return buffer_[slot];
+  }
+
+  /**
+   * @brief Replaces the emptied buffer by `buffer`, whose `size` elements start at slot `head`.
+   * @private
+   * @internal
+   */
+  auto AdoptBuffer(
+    Pointer buffer,  //
+    SizeType capacity,
+    SizeType head,
+    SizeType size
+  ) noexcept -> void {
+    if (buffer_) {
+      AllocatorTraits::deallocate(allocator_, buffer_, capacity_);
+    }
+    buffer_ = buffer;
+    capacity_ = capacity;
+    head_ = head;
+    tail_ = head + size;
+  }
+
+  /**
+   * @brief Fills the empty container with `count` elements constructed from `first`.
+   * @private
+   * @internal
+   */
+  template<std::input_iterator InputIterator>
+  auto AssignFrom(
+    InputIterator first,  //
+    SizeType count
+  ) -> void {
+    if (!count) {
+      return;
+    }
+    const SizeType capacity{std::max(kMinCapacity, std::bit_ceil(count))};
+    const Pointer buffer{AllocatorTraits::allocate(allocator_, capacity)};
+    LAB_TRY {
+      this->UninitializedCopyUsingAllocator(
+        std::counted_iterator{first, static_cast<DifferenceType>(count)}, std::default_sentinel, buffer, allocator_
+      );
+    }
+    LAB_CATCH(...) {
+      AllocatorTraits::deallocate(allocator_, buffer, capacity);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    AdoptBuffer(buffer, capacity, 0, count);
+  }
+
+  auto StealFrom(RingDeque& other) noexcept -> void {
+    buffer_ = std::exchange(other.buffer_, nullptr);
+    capacity_ = std::exchange(other.capacity_, 0);
+    head_ = std::exchange(other.head_, 0);
+    tail_ = std::exchange(other.tail_, 0);
+  }
+
+  auto Release() noexcept -> void {
+    Clear();
+    if (buffer_) {
+      AllocatorTraits::deallocate(allocator_, buffer_, capacity_);
+    }
+    buffer_ = nullptr;
+    capacity_ = 0;
+  }
+
+  Pointer buffer_{nullptr};
+  SizeType capacity_{};
+  SizeType head_{};
+  SizeType tail_{};
+  [[no_unique_address]] AllocatorType allocator_{};
+};
+
+/**
+ * @brief Bounded lock-free single-producer/single-consumer FIFO queue over a power-of-two ring.
+ * @class
+ *
+ * @tparam T Value type to store in container
+ * @tparam Allocator Allocator type to use in container
+ *
+ * @details The producer owns the tail index and the consumer the head index; both are monotonically increasing
+ * counters masked into the ring, published with release stores and read with acquire loads. Each side caches the
+ * last observed index of the other side on its own cache line, so the shared indices are only read when the ring
+ * looks full (producer) or empty (consumer).
+ *
+ * Exactly one thread may call `TryEmplaceBack`/`TryPushBack`, exactly one other thread may call `TryPopFront`.
+ * `Size` and `Empty` are snapshots that may be stale by the time they return.
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+class [[nodiscard]] SpscRingQueue : protected detail::VectorBase<T, Allocator> {
+ protected:
+  using Base = detail::VectorBase<T, Allocator>;
+  using AllocatorTraits = Base::AllocatorTraits;
+
+ public:
+  using ValueType = Base::ValueType;
+  using value_type = Base::ValueType;
+  using Pointer = Base::Pointer;
+  using pointer = Base::Pointer;
+  using SizeType = Base::SizeType;
+  using size_type = Base::SizeType;
+  using AllocatorType = Base::AllocatorType;
+  using allocator_type = Base::AllocatorType;
+
+  /**
+   * @brief Allocates a ring of at least `capacity` slots, rounded up to a power of two.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator).
+   */
+  explicit SpscRingQueue(
+    SizeType capacity,  //
+    const AllocatorType& allocator = AllocatorType{}
+  )
+    : mask_{std::bit_ceil(std::max<SizeType>(capacity, 1)) - 1}
+    , allocator_{allocator} {
+    buffer_ = AllocatorTraits::allocate(allocator_, mask_ + 1);
+  }
+
+  SpscRingQueue(const SpscRingQueue&) = delete;
+  auto operator=(const SpscRingQueue&) -> SpscRingQueue& = delete;
+
+  ~SpscRingQueue() {
+    for (SizeType index{head_.load(std::memory_order_relaxed)}, tail{tail_.load(std::memory_order_relaxed)};
+         index != tail;
+         ++index) {
+      AllocatorTraits::destroy(allocator_, std::to_address(buffer_ + (index & mask_)));
+    }
+    AllocatorTraits::deallocate(allocator_, buffer_, mask_ + 1);
+  }
+
+  [[nodiscard]] auto Capacity() const noexcept -> SizeType { return mask_ + 1; }
+
+  [[nodiscard]] auto Size() const noexcept -> SizeType {
+    const SizeType head{head_.load(std::memory_order_acquire)};
+    return tail_.load(std::memory_order_acquire) - head;
+  }
+
+  [[nodiscard]] auto Empty() const noexcept -> bool { return !Size(); }
+
+  [[nodiscard]] auto GetAllocator() const noexcept -> AllocatorType { return allocator_; }
+
+  /**
+   * @brief Constructs the object at the back of the queue with `args` unless the ring is full. Producer only.
+   * @public
+   *
+   * @throws Propagates user defined exception, the queue is left unchanged.
+   *
+   * @return `true` if the element was enqueued.
+   */
+  template<typename... Args>
+  auto TryEmplaceBack(Args&&... args) -> bool {
+    const SizeType tail{tail_.load(std::memory_order_relaxed)};
+    if (tail - cached_head_ > mask_) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ > mask_) {
+        return false;
+      }
+    }
+    AllocatorTraits::construct(allocator_, std::to_address(buffer_ + (tail & mask_)), std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  auto TryPushBack(const ValueType& value) -> bool { return TryEmplaceBack(value); }
+
+  auto TryPushBack(ValueType&& value) -> bool { return TryEmplaceBack(std::move(value)); }
+
+  /**
+   * @brief Moves out the front element unless the ring is empty. Consumer only.
+   * @public
+   *
+   * @throws Propagates user defined exception of the move constructor, the element then stays queued.
+   *
+   * @return `std::optional<T>` with the dequeued element or `std::nullopt` if the queue was empty.
+   */
+  [[nodiscard]] auto TryPopFront() -> std::optional<T> {
+    const SizeType head{head_.load(std::memory_order_relaxed)};
+    if (head == cached_tail_) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head == cached_tail_) {
+        return std::nullopt;
+      }
+    }
+    const Pointer slot{buffer_ + (head & mask_)};
+    std::optional<T> result{std::move(*slot)};
+    AllocatorTraits::destroy(allocator_, std::to_address(slot));
+    head_.store(head + 1, std::memory_order_release);
+    return result;
+  }
+
+ private:
+  alignas(kRingDequeCacheLineSize) std::atomic<SizeType> head_{};
+  SizeType cached_tail_{};
+  alignas(kRingDequeCacheLineSize) std::atomic<SizeType> tail_{};
+  SizeType cached_head_{};
+  alignas(kRingDequeCacheLineSize) Pointer buffer_{nullptr};
+  SizeType mask_;
+  [[no_unique_address]] AllocatorType allocator_;
+};
+
+}  // namespace lab
+
+END_EXPORT_SECTION
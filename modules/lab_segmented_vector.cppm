@@ -0,0 +1,494 @@
+module;
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <format>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+#include <utility>
+
+export module lab_segmented_vector;
+
+import lab_vector_base;
+
+/**
+ * @brief Concept for allocator validation
+ * @internal
+ * @concept IsValidSegmentedVectorAllocatorType
+ *
+ * @details Segment pointers are published through `std::atomic`, so fancy pointer allocators are rejected.
+ */
+template<typename Allocator>
+concept IsValidSegmentedVectorAllocatorType = std::is_pointer_v<typename std::allocator_traits<Allocator>::pointer>;
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Default size of the first `SegmentedVector` segment: about 1 KiB, rounded down to a power of two.
+ */
+template<typename T>
+inline constexpr std::size_t kSegmentedVectorDefaultFirstSegmentSize{
+  std::bit_floor(std::max<std::size_t>(1, 1024 / sizeof(T)))
+};
+
+/**
+ * @brief Append-only container with stable element addresses and concurrent appends.
+ * @class
+ *
+ * @tparam T Value type to store in container
+ * @tparam Allocator Allocator type used for segments, must be thread-safe for concurrent appends
+ * @tparam kFirstSegmentSize Power of two element count of segment 0, segment `k` holds `kFirstSegmentSize << k`
+ *
+ * @details Elements live in geometrically growing segments that are never relocated, so references and iterators
+ * stay valid while other threads append. Index `i` maps to segment `bit_width(i + kFirstSegmentSize) - 1 -
+ * log2(kFirstSegmentSize)` with a single bit scan.
+ *
+ * `EmplaceBack`/`PushBack` may be called from any number of threads concurrently with each other and with readers
+ * (`Size`, `operator[]`, `At`, iteration up to a previously observed `Size`). Slots are reserved with a CAS on the
+ * reserved counter after the target segment is known to exist, so a throwing allocation never leaves a hole.
+ * The published size advances in index order: it only ever covers fully constructed elements.
+ *
+ * `Clear`, `Swap`, assignment and destruction must not race with any other operation.
+ */
+template<
+  typename T,
+  typename Allocator = std::allocator<T>,
+  std::size_t kFirstSegmentSize = kSegmentedVectorDefaultFirstSegmentSize<T>>
+  requires(std::has_single_bit(kFirstSegmentSize) && IsValidSegmentedVectorAllocatorType<Allocator>)
+class [[nodiscard]] SegmentedVector : protected detail::VectorBase<T, Allocator> {
+ protected:
+  using Base = detail::VectorBase<T, Allocator>;
+  using AllocatorTraits = Base::AllocatorTraits;
+  static constexpr bool kPropagatesOnMoveAssignment{AllocatorTraits::propagate_on_container_move_assignment::value};
+  static constexpr bool kIsAllocatorAlwaysEqual{AllocatorTraits::is_always_equal::value};
+
+ public:
+  using ValueType = Base::ValueType;
+  using value_type = Base::ValueType;
+  using Reference = Base::Reference;
+  using reference = Base::Reference;
+  using ConstReference = Base::ConstReference;
+  using const_reference = Base::ConstReference;
+  using Pointer = Base::Pointer;
+  using pointer = Base::Pointer;
+  using ConstPointer = Base::ConstPointer;
+  using const_pointer = Base::ConstPointer;
+  using DifferenceType = Base::DifferenceType;
+  using difference_type = Base::DifferenceType;
+  using SizeType = Base::SizeType;
+  using size_type = Base::SizeType;
+  using AllocatorType = Base::AllocatorType;
+  using allocator_type = Base::AllocatorType;
+  using Iterator = detail::IndexIterator<false, SegmentedVector>;
+  using iterator = Iterator;
+  using ConstIterator = detail::IndexIterator<true, SegmentedVector>;
+  using const_iterator = ConstIterator;
+  using ReverseIterator = std::reverse_iterator<Iterator>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  static constexpr SizeType kFirstSegmentLog{static_cast<SizeType>(std::countr_zero(kFirstSegmentSize))};
+  static constexpr SizeType kSegmentCount{std::numeric_limits<SizeType>::digits - kFirstSegmentLog};
+
+  SegmentedVector() noexcept(std::is_nothrow_default_constructible_v<AllocatorType>) = default;
+
+  explicit SegmentedVector(const AllocatorType& allocator) noexcept : allocator_{allocator} { }
+
+  SegmentedVector(
+    std::initializer_list<ValueType> values,  //
+    const AllocatorType& allocator = AllocatorType{}
+  )
+    : allocator_{allocator} {
+    LAB_TRY {
+      Reserve(values.size());
+      for (const auto& value : values) {
+        EmplaceBack(value);
+      }
+    }
+    LAB_CATCH(...) {
+      Release();
+      LAB_PROPAGATE_EXCEPTION;
+    }
+  }
+
+  /**
+   * @brief Copy constructor, copies segment by segment.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @warning `other` must not be appended to concurrently.
+   */
+  SegmentedVector(const SegmentedVector& other)
+    : allocator_{AllocatorTraits::select_on_container_copy_construction(other.allocator_)} {
+    const SizeType size{other.Size()};
+    LAB_TRY {
+      for (SizeType segment{}, copied{}; copied < size; ++segment) {
+        const SizeType count{std::min(SegmentSize(segment), size - copied)};
+        const Pointer source{other.segments_[segment].load(std::memory_order_relaxed)};
+        EnsureSegment(segment);
+        this->UninitializedCopyUsingAllocator(
+          source, source + count, segments_[segment].load(std::memory_order_relaxed), allocator_
+        );
+        copied += count;
+        reserved_.store(copied, std::memory_order_relaxed);
+        size_.store(copied, std::memory_order_relaxed);
+      }
+    }
+    LAB_CATCH(...) {
+      Release();
+      LAB_PROPAGATE_EXCEPTION;
+    }
+  }
+
+  /**
+   * @brief Move constructor, steals every segment.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  SegmentedVector(SegmentedVector&& other) noexcept : allocator_{std::move(other.allocator_)} {
+    StealSegments(other);
+  }
+
+  auto operator=(const SegmentedVector& other) -> SegmentedVector& {
+    if (this != &other) {
+      SegmentedVector temp{other};
+      Swap(temp);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Move assignment, steals every segment unless the allocators differ and do not propagate.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception, only
+   * when the allocators compare unequal and do not propagate: the elements are then moved one by one into segments
+   * from the own allocator and the container is left unchanged on failure.
+   */
+  auto operator=(SegmentedVector&& other) noexcept(kPropagatesOnMoveAssignment || kIsAllocatorAlwaysEqual)
+    -> SegmentedVector& {
+    if (this != &other) {
+      if constexpr (!kPropagatesOnMoveAssignment && !kIsAllocatorAlwaysEqual) {
+        if (allocator_ != other.allocator_) {
+          SegmentedVector temp{allocator_};
+          temp.Reserve(other.Size());
+          for (auto& value : other) {
+            temp.EmplaceBack(std::move(value));
+          }
+          Swap(temp);
+          return *this;
+        }
+      }
+      Release();
+      if constexpr (kPropagatesOnMoveAssignment) {
+        allocator_ = std::move(other.allocator_);
+      }
+      StealSegments(other);
+    }
+    return *this;
+  }
+
+  ~SegmentedVector() { Release(); }
+
+  [[nodiscard]] auto begin() noexcept -> Iterator { return {this, 0}; }
+
+  [[nodiscard]] auto end() noexcept -> Iterator { return {this, Size()}; }
+
+  [[nodiscard]] auto begin() const noexcept -> ConstIterator { return {this, 0}; }
+
+  [[nodiscard]] auto end() const noexcept -> ConstIterator { return {this, Size()}; }
+
+  [[nodiscard]] auto cbegin() const noexcept -> ConstIterator { return begin(); }
+
+  [[nodiscard]] auto cend() const noexcept -> ConstIterator { return end(); }
+
+  [[nodiscard]] auto rbegin() noexcept -> ReverseIterator { return ReverseIterator{end()}; }
+
+  [[nodiscard]] auto rend() noexcept -> ReverseIterator { return ReverseIterator{begin()}; }
+
+  [[nodiscard]] auto crbegin() const noexcept -> ConstReverseIterator { return ConstReverseIterator{cend()}; }
+
+  [[nodiscard]] auto crend() const noexcept -> ConstReverseIterator { return ConstReverseIterator{cbegin()}; }
+
+  /**
+   * @brief Number of fully constructed elements, safe to call concurrently with appends.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] auto Size() const noexcept -> SizeType { return size_.load(std::memory_order_acquire); }
+
+  [[nodiscard]] auto Empty() const noexcept -> bool { return !Size(); }
+
+  /**
+   * @brief Number of elements the allocated segments can hold without allocation.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] auto Capacity() const noexcept -> SizeType {
+    SizeType segment{};
+    while (segment < kSegmentCount && segments_[segment].load(std::memory_order_acquire)) {
+      ++segment;
+    }
+    return SegmentOffset(segment);
+  }
+
+  [[nodiscard]] auto MaxSize() const noexcept -> SizeType { return AllocatorTraits::max_size(allocator_); }
+
+  [[nodiscard]] auto GetAllocator() const noexcept -> AllocatorType { return allocator_; }
+
+  /**
+   * @brief O(1) indexed access through a bit scan on `index`.
+   * @public
+   *
+   * @warning **Undefined Behaviour** if:
+   * - `index` is not less than a previously observed `Size()`
+   */
+  [[nodiscard]] auto operator[](SizeType index) noexcept -> Reference {
+    const auto [segment, offset]{Locate(index)};
+    return segments_[segment].load(std::memory_order_relaxed)[offset];
+  }
+
+  [[nodiscard]] auto operator[](SizeType index) const noexcept -> ConstReference {
+    const auto [segment, offset]{Locate(index)};
+    return segments_[segment].load(std::memory_order_relaxed)[offset];
+  }
+
+ private:
+  auto RangeCheck(SizeType index) const -> void {
+    if (index >= Size()) {
+      throw std::out_of_range{
+        std::format("SegmentedVector::RangeCheck: index (which is {}) >= this->size() (which is {})", index, Size())
+      };
+    }
+  }
+
+ public:
+  [[nodiscard]] auto At(SizeType index) -> Reference {
+    RangeCheck(index);
+    return (*this)[index];
+  }
+
+  [[nodiscard]] auto At(SizeType index) const -> ConstReference {
+    RangeCheck(index);
+    return (*this)[index];
+  }
+
+  [[nodiscard]] auto Front() noexcept -> Reference { return (*this)[0]; }
+
+  [[nodiscard]] auto Front() const noexcept -> ConstReference { return (*this)[0]; }
+
+  [[nodiscard]] auto Back() noexcept -> Reference { return (*this)[Size() - 1]; }
+
+  [[nodiscard]] auto Back() const noexcept -> ConstReference { return (*this)[Size() - 1]; }
+
+  /**
+   * @brief Allocates the segments needed to hold `n` elements, safe to call concurrently with appends.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator).
+   */
+  auto Reserve(SizeType n) -> void {
+    if (!n) {
+      return;
+    }
+    const SizeType last{Locate(n - 1).segment};
+    for (SizeType segment{}; segment <= last; ++segment) {
+      EnsureSegment(segment);
+    }
+  }
+
+  /**
+   * @brief Constructs the object at the end of the container with `args`, safe to call concurrently.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception, the
+   * container is left unchanged.
+   *
+   * @return Reference to the constructed element (stable for the container lifetime).
+   */
+  template<typename... Args>
+  auto EmplaceBack(Args&&... args) -> Reference {
+    if constexpr (std::is_nothrow_constructible_v<ValueType, Args...>) {
+      return PublishAt(ReserveSlot(), std::forward<Args>(args)...);
+    } else {
+      static_assert(
+        std::is_nothrow_move_constructible_v<ValueType>,
+        "SegmentedVector::EmplaceBack: throwing construction requires a nothrow move constructor"
+      );
+      ValueType value(std::forward<Args>(args)...);
+      return PublishAt(ReserveSlot(), std::move(value));
+    }
+  }
+
+  auto PushBack(const ValueType& value) -> Reference { return EmplaceBack(value); }
+
+  auto PushBack(ValueType&& value) -> Reference { return EmplaceBack(std::move(value)); }
+
+  /**
+   * @brief Destroys every element, keeps the segments.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning Must not race with any other operation.
+   */
+  auto Clear() noexcept -> void {
+    const SizeType size{Size()};
+    for (SizeType segment{}, destroyed{}; destroyed < size; ++segment) {
+      const SizeType count{std::min(SegmentSize(segment), size - destroyed)};
+      const Pointer first{segments_[segment].load(std::memory_order_relaxed)};
+      this->DestroyUsingAllocator(first, first + count, allocator_);
+      destroyed += count;
+    }
+    reserved_.store(0, std::memory_order_relaxed);
+    size_.store(0, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Swaps contents of two containers.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning Must not race with any other operation on either container.
+   */
+  auto Swap(SegmentedVector& other) noexcept -> void {
+    for (SizeType segment{}; segment < kSegmentCount; ++segment) {
+      const Pointer temp{segments_[segment].load(std::memory_order_relaxed)};
+      segments_[segment].store(other.segments_[segment].load(std::memory_order_relaxed), std::memory_order_relaxed);
+      other.segments_[segment].store(temp, std::memory_order_relaxed);
+    }
+    reserved_.store(other.reserved_.exchange(reserved_.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+    size_.store(other.size_.exchange(size_.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+    if constexpr (AllocatorTraits::propagate_on_container_swap::value) {
+      std::ranges::swap(allocator_, other.allocator_);
+    }
+  }
+
+ private:
+  struct Location {
+    SizeType segment;
+    SizeType offset;
+  };
+
+  [[nodiscard]] static constexpr auto SegmentSize(SizeType segment) noexcept -> SizeType {
+    return SizeType{kFirstSegmentSize} << segment;
+  }
+
+  /**
+   * @brief Index of the first element of `segment` (total size of the preceding segments).
+   * @private
+   * @internal
+   */
+  [[nodiscard]] static constexpr auto SegmentOffset(SizeType segment) noexcept -> SizeType {
+    return (SizeType{kFirstSegmentSize} << segment) - kFirstSegmentSize;
+  }
+
+  [[nodiscard]] static constexpr auto Locate(SizeType index) noexcept -> Location {
+    const SizeType biased{index + kFirstSegmentSize};
+    const auto segment{static_cast<SizeType>(std::bit_width(biased)) - 1 - kFirstSegmentLog};
+    return {segment, biased - (SizeType{kFirstSegmentSize} << segment)};
+  }
+
+  /**
+   * @brief Allocates `segment` unless another thread already did, losers return their allocation.
+   * @private
+   * @internal
+   */
+  auto EnsureSegment(SizeType segment) -> void {
+    if (segments_[segment].load(std::memory_order_acquire)) {
+      return;
+    }
+    Pointer expected{nullptr};
+    const Pointer allocated{AllocatorTraits::allocate(allocator_, SegmentSize(segment))};
+    if (!segments_[segment].compare_exchange_strong(
+          expected, allocated, std::memory_order_acq_rel, std::memory_order_acquire
+        )) {
+      AllocatorTraits::deallocate(allocator_, allocated, SegmentSize(segment));
+    }
+  }
+
+  /**
+   * @brief Reserves the next index once its segment exists, nothing after this point may throw.
+   * @private
+   * @internal
+   */
+  [[nodiscard]] auto ReserveSlot() -> SizeType {
+    SizeType index{reserved_.load(std::memory_order_relaxed)};
+    do {
+      EnsureSegment(Locate(index).segment);
+    } while (!reserved_.compare_exchange_weak(index, index + 1, std::memory_order_relaxed));
+    return index;
+  }
+
+  /**
+   * @brief Constructs the element of a reserved slot and publishes it after every preceding slot.
+   * @private
+   * @internal
+   */
+  template<typename... Args>
+  auto PublishAt(
+    SizeType index,  //
+    Args&&... args
+  ) noexcept -> Reference {
+    Reference slot{(*this)[index]};
+    AllocatorTraits::construct(allocator_, std::addressof(slot), std::forward<Args>(args)...);
+    for (SizeType published{size_.load(std::memory_order_acquire)}; published != index;
+         published = size_.load(std::memory_order_acquire)) {
+      size_.wait(published, std::memory_order_acquire);
+    }
+    size_.store(index + 1, std::memory_order_release);
+    size_.notify_all();
+    return slot;
+  }
+
+  auto StealSegments(SegmentedVector& other) noexcept -> void {
+    for (SizeType segment{}; segment < kSegmentCount; ++segment) {
+      segments_[segment].store(
+        other.segments_[segment].exchange(nullptr, std::memory_order_relaxed), std::memory_order_relaxed
+      );
+    }
+    reserved_.store(other.reserved_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+    size_.store(other.size_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+
+  auto Release() noexcept -> void {
+    Clear();
+    for (SizeType segment{}; segment < kSegmentCount; ++segment) {
+      if (const Pointer first{segments_[segment].exchange(nullptr, std::memory_order_relaxed)}) {
+        AllocatorTraits::deallocate(allocator_, first, SegmentSize(segment));
+      }
+    }
+  }
+
+  std::array<std::atomic<Pointer>, kSegmentCount> segments_{};
+  std::atomic<SizeType> reserved_{};
+  std::atomic<SizeType> size_{};
+  [[no_unique_address]] AllocatorType allocator_{};
+};
+
+}  // namespace lab
+
+END_EXPORT_SECTION
@@ -0,0 +1,392 @@
+module;
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+
+export module lab_serialize;
+
+import lab_forward_list;
+import lab_instrumentation;
+import lab_vector;
+
+/**
+ * @brief Iovecs handed to a single `writev`, `IOV_MAX` on Linux.
+ * @internal
+ */
+constexpr std::size_t kSerializeIovecBatch{1024};
+
+/**
+ * @brief Elements smaller than this are packed into a staging buffer instead of getting an iovec each.
+ * @internal
+ *
+ * @details The kernel walks iovecs one by one, for small elements that costs more than a `memcpy`.
+ */
+constexpr std::size_t kSerializeGatherThreshold{256};
+
+/**
+ * @brief Size of the staging buffer written by one `writev`.
+ * @internal
+ */
+constexpr std::size_t kSerializeStagingBytes{64 * 1024};
+
+/**
+ * @brief Throws `std::system_error` for the current `errno`.
+ * @internal
+ */
+[[noreturn]] auto SerializeThrowErrno(const char* what) -> void {
+  throw std::system_error{errno, std::generic_category(), what};
+}
+
+/**
+ * @brief Writes every buffer of `buffers` to `fd`, resubmitting the rest after short writes.
+ * @internal
+ *
+ * @details The iovecs are consumed: on return their bases and lengths are unspecified.
+ */
+auto SerializeWriteAll(
+  int fd,  //
+  std::span<::iovec> buffers
+) -> void {
+  auto first{buffers.begin()};
+  while (first != buffers.end()) {
+    const auto count{static_cast<int>(std::min<std::ptrdiff_t>(buffers.end() - first, kSerializeIovecBatch))};
+    const ::ssize_t written{::writev(fd, std::to_address(first), count)};
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      SerializeThrowErrno("lab::serialize: writev");
+    }
+    auto remaining{static_cast<std::size_t>(written)};
+    for (; first != buffers.end() && remaining >= first->iov_len; ++first) {
+      remaining -= first->iov_len;
+    }
+    if (remaining > 0) {
+      first->iov_base = static_cast<std::byte*>(first->iov_base) + remaining;
+      first->iov_len -= remaining;
+    }
+  }
+}
+
+/**
+ * @brief Reads until `buffer` is full or end of file is reached.
+ * @internal
+ *
+ * @return Number of bytes read, less than `buffer.size()` only at end of file.
+ */
+auto SerializeReadSome(
+  int fd,  //
+  std::span<std::byte> buffer
+) -> std::size_t {
+  std::size_t filled{};
+  while (filled < buffer.size()) {
+    const ::ssize_t bytes{::read(fd, buffer.data() + filled, buffer.size() - filled)};
+    if (bytes < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      SerializeThrowErrno("lab::serialize: read");
+    }
+    if (bytes == 0) {
+      break;
+    }
+    filled += static_cast<std::size_t>(bytes);
+  }
+  return filled;
+}
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Element types dumped as raw bytes.
+ */
+template<typename T>
+concept IsTriviallySerializable = std::is_trivially_copyable_v<T> && !std::is_const_v<T> && !std::is_volatile_v<T>;
+
+/**
+ * @brief Fixed-size header in front of every serialized sequence, followed by `size` raw elements.
+ *
+ * @details Fields are stored in the byte order of the writer; a reader of the other byte order sees
+ * `byte_order` swapped and rejects the stream instead of decoding garbage.
+ */
+struct SerializedHeader {
+  static constexpr std::uint32_t kMagic{0x5642'414C};  // "LABV" read as little-endian bytes
+  static constexpr std::uint16_t kVersion{1};
+  static constexpr std::uint16_t kByteOrderMark{0xFEFF};
+
+  std::uint32_t magic{kMagic};
+  std::uint16_t version{kVersion};
+  std::uint16_t byte_order{kByteOrderMark};
+  std::uint32_t element_size{};
+  std::uint32_t element_alignment{};
+  std::uint64_t size{};
+
+  /**
+   * @brief Header describing `size` elements of type `T`.
+   * @public
+   */
+  template<IsTriviallySerializable T>
+  [[nodiscard]] static constexpr auto For(std::uint64_t size) noexcept -> SerializedHeader {
+    return {.element_size = sizeof(T), .element_alignment = alignof(T), .size = size};
+  }
+
+  /**
+   * @brief Checks that the stream was produced for `T` on a machine with the same byte order.
+   * @public
+   *
+   * @throws std::runtime_error if the magic, the version, the byte order or the element layout differ.
+   */
+  template<IsTriviallySerializable T>
+  auto Validate() const -> void {
+    // A writer of the other byte order swapped every field, the magic included.
+    if (magic == std::byteswap(kMagic) && byte_order == std::byteswap(kByteOrderMark)) {
+      throw std::runtime_error{"SerializedHeader::Validate: written with a different byte order"};
+    }
+    if (magic != kMagic || version != kVersion || byte_order != kByteOrderMark) {
+      throw std::runtime_error{"SerializedHeader::Validate: not a lab serialized sequence"};
+    }
+    if (element_size != sizeof(T) || element_alignment != alignof(T)) {
+      throw std::runtime_error{std::format(
+        "SerializedHeader::Validate: element size/alignment (which is {}/{}) != sizeof/alignof T (which is {}/{})",
+        element_size,
+        element_alignment,
+        sizeof(T),
+        alignof(T)
+      )};
+    }
+  }
+};
+
+static_assert(sizeof(SerializedHeader) == 24 && std::is_trivially_copyable_v<SerializedHeader>);
+
+/**
+ * @brief Dumps `vector` to `fd` with its header in a single `writev`.
+ *
+ * @throws std::system_error if writing fails; the file then holds an unspecified prefix of the stream.
+ *
+ * @details No element is touched: the kernel copies straight from the vector storage. Short writes (pipes,
+ * sockets, signals) are resumed until everything is written.
+ */
+template<IsTriviallySerializable T, typename Allocator, IsGrowthPolicy GrowthPolicy, IsContainerObserver Observer>
+auto WriteVector(
+  int fd,  //
+  const Vector<T, Allocator, GrowthPolicy, Observer>& vector
+) -> void {
+  auto header{SerializedHeader::For<T>(vector.Size())};
+  std::array<::iovec, 2> buffers{{
+    {.iov_base = &header, .iov_len = sizeof(header)},
+    {.iov_base = const_cast<T*>(vector.Data()), .iov_len = vector.Size() * sizeof(T)},
+  }};
+  SerializeWriteAll(fd, buffers);
+}
+
+/**
+ * @brief Dumps `list` to `fd` in the format of `WriteVector`, so it can be read back into a `Vector`.
+ *
+ * @throws std::system_error if writing fails; the file then holds an unspecified prefix of the stream.
+ *
+ * @details Nodes are gathered into batches of iovecs pointing at the node values, each batch is one `writev`
+ * instead of one `write` per element. Values smaller than 256 bytes are packed into a 64 KiB staging buffer
+ * instead, which is several times faster than an iovec per value. Untracked lists are counted with one extra
+ * traversal for the header.
+ */
+template<IsTriviallySerializable T, typename Allocator, typename SizePolicy, IsContainerObserver Observer>
+auto WriteForwardList(
+  int fd,  //
+  const containers::ForwardList<T, Allocator, SizePolicy, Observer>& list
+) -> void {
+  std::uint64_t size{};
+  if constexpr (SizePolicy::kIsTracked) {
+    size = list.Size();
+  } else {
+    size = static_cast<std::uint64_t>(std::ranges::distance(list));
+  }
+  auto header{SerializedHeader::For<T>(size)};
+  if constexpr (sizeof(T) < kSerializeGatherThreshold) {
+    Vector<std::byte> staging;
+    staging.ResizeForOverwrite(kSerializeStagingBytes);
+    std::memcpy(staging.Data(), &header, sizeof(header));
+    std::size_t used{sizeof(header)};
+    for (const T& value : list) {
+      if (used + sizeof(T) > staging.Size()) {
+        ::iovec buffer{.iov_base = staging.Data(), .iov_len = used};
+        SerializeWriteAll(fd, {&buffer, 1});
+        used = 0;
+      }
+      std::memcpy(staging.Data() + used, std::addressof(value), sizeof(T));
+      used += sizeof(T);
+    }
+    ::iovec buffer{.iov_base = staging.Data(), .iov_len = used};
+    SerializeWriteAll(fd, {&buffer, 1});
+    return;
+  }
+  std::array<::iovec, kSerializeIovecBatch> buffers;
+  buffers[0] = {.iov_base = &header, .iov_len = sizeof(header)};
+  std::size_t count{1};
+  for (const T& value : list) {
+    buffers[count++] = {.iov_base = const_cast<T*>(std::addressof(value)), .iov_len = sizeof(T)};
+    if (count == buffers.size()) {
+      SerializeWriteAll(fd, buffers);
+      count = 0;
+    }
+  }
+  SerializeWriteAll(fd, std::span{buffers}.first(count));
+}
+
+/**
+ * @brief Streaming reader of a sequence written by `WriteVector` or `WriteForwardList`.
+ * @class
+ *
+ * @tparam T Element type, must match the writer
+ *
+ * @details Chunks are read straight into the spare capacity of a `Vector` with `AppendUninitialized`, so the
+ * elements are neither zero-filled nor copied a second time. Growth follows the data actually received: a corrupt
+ * or hostile `size` in the header fails with a truncation error after at most one chunk instead of provoking a
+ * huge allocation up front.
+ */
+template<IsTriviallySerializable T>
+  requires std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>
+class [[nodiscard]] VectorReader {
+ public:
+  using ValueType = T;
+  using SizeType = std::size_t;
+
+  /**
+   * @brief Elements read per chunk by default, 1 MiB worth.
+   */
+  static constexpr SizeType kDefaultChunkSize{std::max<SizeType>((1 << 20) / sizeof(T), 1)};
+
+  /**
+   * @brief Reads and validates the header at the current position of `fd`.
+   * @public
+   *
+   * @throws std::system_error if reading fails.
+   * @throws std::runtime_error if the stream is truncated or was written for another type, see
+   * `SerializedHeader::Validate`.
+   */
+  explicit VectorReader(int fd)
+    : fd_{fd} {
+    if (SerializeReadSome(fd_, std::as_writable_bytes(std::span{&header_, 1})) != sizeof(header_)) {
+      throw std::runtime_error{"VectorReader: truncated header"};
+    }
+    header_.Validate<T>();
+  }
+
+  /**
+   * @brief Header of the stream.
+   * @public
+   */
+  [[nodiscard]] auto Header() const noexcept -> const SerializedHeader& { return header_; }
+
+  /**
+   * @brief Number of elements not read yet.
+   * @public
+   */
+  [[nodiscard]] auto Remaining() const noexcept -> SizeType { return static_cast<SizeType>(header_.size - read_); }
+
+  /**
+   * @brief Whether every element has been read.
+   * @public
+   */
+  [[nodiscard]] auto Done() const noexcept -> bool { return read_ == header_.size; }
+
+  /**
+   * @brief Appends up to `chunk_size` of the next elements to `vector`.
+   * @public
+   *
+   * @return Number of elements appended, zero once `Done()`.
+   *
+   * @throws std::system_error if reading fails.
+   * @throws std::runtime_error if the stream ends before `Header().size` elements; the complete elements of the
+   * last chunk are still appended.
+   */
+  template<typename Allocator, IsGrowthPolicy GrowthPolicy, IsContainerObserver Observer>
+  auto ReadChunk(
+    Vector<T, Allocator, GrowthPolicy, Observer>& vector,  //
+    SizeType chunk_size = kDefaultChunkSize
+  ) -> SizeType {
+    const SizeType count{std::min(chunk_size, Remaining())};
+    if (count == 0) {
+      return 0;
+    }
+    const auto chunk{vector.AppendUninitialized(count)};
+    const std::size_t bytes{SerializeReadSome(fd_, std::as_writable_bytes(chunk))};
+    const SizeType complete{bytes / sizeof(T)};
+    vector.CommitAppend(complete);
+    read_ += complete;
+    if (complete != count) {
+      throw std::runtime_error{std::format(
+        "VectorReader::ReadChunk: stream ended after {} of {} elements",
+        read_,
+        header_.size
+      )};
+    }
+    return count;
+  }
+
+  /**
+   * @brief Appends every remaining element to `vector`, `chunk_size` elements at a time.
+   * @public
+   *
+   * @throws std::system_error if reading fails.
+   * @throws std::runtime_error if the stream is truncated.
+   */
+  template<typename Allocator, IsGrowthPolicy GrowthPolicy, IsContainerObserver Observer>
+  auto ReadAll(
+    Vector<T, Allocator, GrowthPolicy, Observer>& vector,  //
+    SizeType chunk_size = kDefaultChunkSize
+  ) -> void {
+    while (ReadChunk(vector, chunk_size) != 0) {
+    }
+  }
+
+ private:
+  SerializedHeader header_{};
+  std::uint64_t read_{};
+  int fd_;
+};
+
+/**
+ * @brief Reads a whole sequence from `fd` into a new `Vector`.
+ *
+ * @throws std::system_error if reading fails.
+ * @throws std::runtime_error if the stream is truncated or was written for another type.
+ */
+template<IsTriviallySerializable T>
+  requires std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>
+[[nodiscard]] auto ReadVector(
+  int fd,  //
+  std::size_t chunk_size = VectorReader<T>::kDefaultChunkSize
+) -> Vector<T> {
+  VectorReader<T> reader{fd};
+  Vector<T> vector;
+  reader.ReadAll(vector, chunk_size);
+  return vector;
+}
+
+}  // namespace lab
+
+END_EXPORT_SECTION
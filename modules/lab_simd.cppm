@@ -0,0 +1,597 @@
+module;
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+#include <utility>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define LAB_SIMD_X86 1
+#elif defined(__GNUC__) && defined(__aarch64__)
+  #define LAB_SIMD_NEON 1
+#endif
+
+export module lab_simd;
+
+/**
+ * @brief Concept for element types handled by the SIMD kernels
+ * @internal
+ * @concept IsSimdElementType
+ */
+template<typename T>
+concept IsSimdElementType =
+  std::is_arithmetic_v<T> && !std::same_as<T, bool> &&
+  (std::integral<T> ? (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)
+                    : (std::same_as<T, float> || std::same_as<T, double>));
+
+/**
+ * @brief Concept for ranges handled by the SIMD algorithms
+ * @internal
+ * @concept IsSimdRange
+ */
+template<typename Range>
+concept IsSimdRange = std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range> &&
+                      IsSimdElementType<std::ranges::range_value_t<Range>>;
+
+/**
+ * @brief Native vector of `kBytes / sizeof(T)` lanes (GCC/Clang vector extensions).
+ * @internal
+ */
+template<typename T, std::size_t kBytes>
+struct SimdVectorType {
+  typedef T Type __attribute__((vector_size(kBytes)));
+};
+
+template<typename T, std::size_t kBytes>
+using SimdVector = SimdVectorType<T, kBytes>::Type;
+
+/**
+ * @brief Unaligned load of one vector.
+ * @internal
+ *
+ * @details Writes through a reference, wide vectors passed by value would hit ABI differences between targets.
+ */
+template<typename Vector, typename T>
+[[gnu::always_inline]] inline auto SimdLoad(
+  Vector& block,  //
+  const T* data
+) noexcept -> void {
+  std::memcpy(&block, data, sizeof(block));
+}
+
+/**
+ * @brief Checks whether any lane of a comparison mask is set.
+ * @internal
+ */
+template<std::size_t kBytes, typename Mask>
+[[nodiscard, gnu::always_inline]] inline auto SimdAny(const Mask& mask) noexcept -> bool {
+  if constexpr (kBytes > 16) {
+    // Folding halves keeps the reduction in vector registers.
+    SimdVector<std::uint64_t, kBytes / 2> low;
+    SimdVector<std::uint64_t, kBytes / 2> high;
+    std::memcpy(&low, &mask, sizeof(low));
+    std::memcpy(&high, reinterpret_cast<const unsigned char*>(&mask) + sizeof(low), sizeof(high));
+    return SimdAny<kBytes / 2>(low | high);
+  } else {
+    SimdVector<std::uint64_t, kBytes> words;
+    std::memcpy(&words, &mask, sizeof(words));
+    return (words[0] | words[1]) != 0;
+  }
+}
+
+/**
+ * @brief Kernels below are written once over the vector width, `Run<0>` is the scalar fallback.
+ * @internal
+ */
+struct SimdFindKernel {
+  template<std::size_t kBytes, typename T>
+  [[nodiscard, gnu::always_inline]] static auto Run(
+    const T* data,  //
+    std::size_t n,
+    T value
+  ) noexcept -> std::size_t {
+    std::size_t i{};
+    if constexpr (kBytes != 0) {
+      constexpr std::size_t kLanes{kBytes / sizeof(T)};
+      const auto needle{SimdVector<T, kBytes>{} + value};
+      SimdVector<T, kBytes> block;
+      SimdVector<T, kBytes> block1;
+      SimdVector<T, kBytes> block2;
+      SimdVector<T, kBytes> block3;
+      // Four vectors per iteration hide the latency of the mask reduction.
+      for (; i + 4 * kLanes <= n; i += 4 * kLanes) {
+        SimdLoad(block, data + i);
+        SimdLoad(block1, data + i + kLanes);
+        SimdLoad(block2, data + i + 2 * kLanes);
+        SimdLoad(block3, data + i + 3 * kLanes);
+        // Masks are 0 or -1 per lane, adding them (instead of `|`) keeps GCC from going through AVX-512 k-masks.
+        if (SimdAny<kBytes>((block == needle) + (block1 == needle) + (block2 == needle) + (block3 == needle))) {
+          break;
+        }
+      }
+      for (; i + kLanes <= n; i += kLanes) {
+        SimdLoad(block, data + i);
+        if (SimdAny<kBytes>(block == needle)) {
+          break;
+        }
+      }
+    }
+    for (; i < n; ++i) {
+      if (data[i] == value) {
+        return i;
+      }
+    }
+    return n;
+  }
+};
+
+struct SimdCountKernel {
+  template<std::size_t kBytes, typename T>
+  [[nodiscard, gnu::always_inline]] static auto Run(
+    const T* data,  //
+    std::size_t n,
+    T value
+  ) noexcept -> std::size_t {
+    std::size_t count{};
+    std::size_t i{};
+    if constexpr (kBytes != 0) {
+      constexpr std::size_t kLanes{kBytes / sizeof(T)};
+      using Mask = decltype(SimdVector<T, kBytes>{} == SimdVector<T, kBytes>{});
+      // Lane counters are as wide as `T`, flush them before they overflow.
+      constexpr std::size_t kFlushPeriod{
+        sizeof(T) >= sizeof(std::size_t) ? std::numeric_limits<std::size_t>::max()
+                                         : (std::size_t{1} << (8 * sizeof(T) - 1)) - 1
+      };
+      const auto needle{SimdVector<T, kBytes>{} + value};
+      SimdVector<T, kBytes> block;
+      while (i + kLanes <= n) {
+        Mask counters{};
+        for (std::size_t blocks{}; blocks < kFlushPeriod && i + kLanes <= n; ++blocks, i += kLanes) {
+          SimdLoad(block, data + i);
+          counters -= block == needle;
+        }
+        for (std::size_t lane{}; lane < kLanes; ++lane) {
+          count += static_cast<std::size_t>(counters[lane]);
+        }
+      }
+    }
+    for (; i < n; ++i) {
+      count += data[i] == value;
+    }
+    return count;
+  }
+};
+
+struct SimdEqualKernel {
+  template<std::size_t kBytes, typename T>
+  [[nodiscard, gnu::always_inline]] static auto Run(
+    const T* lhs,  //
+    const T* rhs,
+    std::size_t n
+  ) noexcept -> bool {
+    std::size_t i{};
+    if constexpr (kBytes != 0) {
+      constexpr std::size_t kLanes{kBytes / sizeof(T)};
+      SimdVector<T, kBytes> lhs_block;
+      SimdVector<T, kBytes> rhs_block;
+      for (; i + kLanes <= n; i += kLanes) {
+        SimdLoad(lhs_block, lhs + i);
+        SimdLoad(rhs_block, rhs + i);
+        if (SimdAny<kBytes>(lhs_block != rhs_block)) {
+          return false;
+        }
+      }
+    }
+    for (; i < n; ++i) {
+      if (lhs[i] != rhs[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+struct SimdMinMaxKernel {
+  template<std::size_t kBytes, typename T>
+  [[nodiscard, gnu::always_inline]] static auto Run(
+    const T* data,  //
+    std::size_t n
+  ) noexcept -> std::pair<T, T> {
+    T min{data[0]};
+    T max{data[0]};
+    std::size_t i{1};
+    if constexpr (kBytes != 0) {
+      constexpr std::size_t kLanes{kBytes / sizeof(T)};
+      if (n >= kLanes) {
+        SimdVector<T, kBytes> min_block;
+        SimdLoad(min_block, data);
+        auto max_block{min_block};
+        SimdVector<T, kBytes> block;
+        for (i = kLanes; i + kLanes <= n; i += kLanes) {
+          SimdLoad(block, data + i);
+          min_block = block < min_block ? block : min_block;
+          max_block = block > max_block ? block : max_block;
+        }
+        for (std::size_t lane{}; lane < kLanes; ++lane) {
+          min = min_block[lane] < min ? min_block[lane] : min;
+          max = max_block[lane] > max ? max_block[lane] : max;
+        }
+      }
+    }
+    for (; i < n; ++i) {
+      min = data[i] < min ? data[i] : min;
+      max = data[i] > max ? data[i] : max;
+    }
+    return {min, max};
+  }
+};
+
+/**
+ * @brief Concept for the bitwise functors handled by `SimdWordsKernel`
+ * @internal
+ * @concept IsSimdBitwiseOp
+ */
+template<typename Op>
+concept IsSimdBitwiseOp =
+  std::same_as<Op, std::bit_and<>> || std::same_as<Op, std::bit_or<>> || std::same_as<Op, std::bit_xor<>>;
+
+/**
+ * @brief Applies `Op` as a compound assignment.
+ * @internal
+ *
+ * @details Calling the functor itself would return a wide vector by value, see `SimdLoad`.
+ */
+template<IsSimdBitwiseOp Op, typename T>
+[[gnu::always_inline]] inline auto SimdApplyBitwise(
+  T& dst,  //
+  const T& src
+) noexcept -> void {
+  if constexpr (std::same_as<Op, std::bit_and<>>) {
+    dst &= src;
+  } else if constexpr (std::same_as<Op, std::bit_or<>>) {
+    dst |= src;
+  } else {
+    dst ^= src;
+  }
+}
+
+/**
+ * @brief Word-wise `dst[i] = Op{}(dst[i], src[i])` with `std::bit_and<>`, `std::bit_or<>` or `std::bit_xor<>`.
+ * @internal
+ */
+template<IsSimdBitwiseOp Op>
+struct SimdWordsKernel {
+  template<std::size_t kBytes>
+  [[gnu::always_inline]] static auto Run(
+    std::uint64_t* dst,  //
+    const std::uint64_t* src,
+    std::size_t n
+  ) noexcept -> void {
+    std::size_t i{};
+    if constexpr (kBytes != 0) {
+      constexpr std::size_t kLanes{kBytes / sizeof(std::uint64_t)};
+      SimdVector<std::uint64_t, kBytes> dst_block;
+      SimdVector<std::uint64_t, kBytes> src_block;
+      for (; i + kLanes <= n; i += kLanes) {
+        SimdLoad(dst_block, dst + i);
+        SimdLoad(src_block, src + i);
+        SimdApplyBitwise<Op>(dst_block, src_block);
+        std::memcpy(dst + i, &dst_block, sizeof(dst_block));
+      }
+    }
+    for (; i < n; ++i) {
+      SimdApplyBitwise<Op>(dst[i], src[i]);
+    }
+  }
+};
+
+/**
+ * @brief Number of set bits in `n` words.
+ * @internal
+ *
+ * @details The loop is the same for every width: the AVX2 and AVX-512 entry points enable `popcnt`, so
+ * `std::popcount` becomes one instruction there instead of the bit-twiddling fallback. Four accumulators keep the
+ * false output dependency of `popcnt` on older Intel cores off the critical path.
+ */
+struct SimdPopCountKernel {
+  template<std::size_t kBytes>
+  [[nodiscard, gnu::always_inline]] static auto Run(
+    const std::uint64_t* data,  //
+    std::size_t n
+  ) noexcept -> std::size_t {
+    std::size_t counts[4]{};
+    std::size_t i{};
+    for (; i + 4 <= n; i += 4) {
+      counts[0] += static_cast<std::size_t>(std::popcount(data[i]));
+      counts[1] += static_cast<std::size_t>(std::popcount(data[i + 1]));
+      counts[2] += static_cast<std::size_t>(std::popcount(data[i + 2]));
+      counts[3] += static_cast<std::size_t>(std::popcount(data[i + 3]));
+    }
+    for (; i < n; ++i) {
+      counts[0] += static_cast<std::size_t>(std::popcount(data[i]));
+    }
+    return counts[0] + counts[1] + counts[2] + counts[3];
+  }
+};
+
+#if LAB_SIMD_X86
+template<typename Kernel, typename... Args>
+[[gnu::target("sse2")]] auto SimdRunSse2(Args... args) noexcept {
+  return Kernel::template Run<16>(args...);
+}
+
+template<typename Kernel, typename... Args>
+[[gnu::target("avx2,popcnt")]] auto SimdRunAvx2(Args... args) noexcept {
+  return Kernel::template Run<32>(args...);
+}
+
+template<typename Kernel, typename... Args>
+[[gnu::target("avx512f,avx512bw,popcnt")]] auto SimdRunAvx512(Args... args) noexcept {
+  return Kernel::template Run<64>(args...);
+}
+#endif
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for SIMD dispatch control
+ * @namespace lab::simd
+ */
+namespace lab::simd {
+
+/**
+ * @brief Instruction set used by the SIMD algorithms.
+ */
+enum class Level : std::uint8_t {
+  kScalar,
+  kSse2,
+  kAvx2,
+  kAvx512,
+  kNeon,
+};
+
+/**
+ * @brief Checks whether both the build target and the running CPU support `level`.
+ *
+ * @throws None (no-throw guarantee).
+ */
+[[nodiscard]] auto IsSupported(Level level) noexcept -> bool {
+  switch (level) {
+    case Level::kScalar:
+      return true;
+#if LAB_SIMD_X86
+    case Level::kSse2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("sse2");
+    case Level::kAvx2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+    case Level::kAvx512:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+             __builtin_cpu_supports("popcnt");
+#elif LAB_SIMD_NEON
+    case Level::kNeon:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief Widest instruction set supported by the running CPU.
+ *
+ * @throws None (no-throw guarantee).
+ */
+[[nodiscard]] auto DetectedLevel() noexcept -> Level {
+  for (const Level level : {Level::kAvx512, Level::kAvx2, Level::kSse2, Level::kNeon}) {
+    if (IsSupported(level)) {
+      return level;
+    }
+  }
+  return Level::kScalar;
+}
+
+namespace detail {
+
+/**
+ * @brief Process wide dispatch level, initialized with `DetectedLevel()`.
+ * @internal
+ */
+[[nodiscard]] auto ActiveLevelStorage() noexcept -> std::atomic<Level>& {
+  static std::atomic<Level> level{DetectedLevel()};
+  return level;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Instruction set currently used by the SIMD algorithms.
+ *
+ * @throws None (no-throw guarantee).
+ */
+[[nodiscard]] auto ActiveLevel() noexcept -> Level { return detail::ActiveLevelStorage().load(std::memory_order_relaxed); }
+
+/**
+ * @brief Overrides the dispatch level (e.g. forces the scalar fallback in tests and benchmarks).
+ *
+ * @throws None (no-throw guarantee).
+ *
+ * @return `false` and keeps the current level if `level` is not supported.
+ */
+auto SetLevel(Level level) noexcept -> bool {
+  if (!IsSupported(level)) {
+    return false;
+  }
+  detail::ActiveLevelStorage().store(level, std::memory_order_relaxed);
+  return true;
+}
+
+}  // namespace lab::simd
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Namespace for implementation details shared with other modules
+ * @namespace lab::detail
+ */
+namespace detail {
+
+/**
+ * @brief Runs `Kernel` with the widest enabled instruction set.
+ * @internal
+ */
+template<typename Kernel, typename... Args>
+[[nodiscard]] auto SimdDispatch(Args... args) noexcept {
+  switch (simd::ActiveLevel()) {
+#if LAB_SIMD_X86
+    case simd::Level::kAvx512:
+      return SimdRunAvx512<Kernel>(args...);
+    case simd::Level::kAvx2:
+      return SimdRunAvx2<Kernel>(args...);
+    case simd::Level::kSse2:
+      return SimdRunSse2<Kernel>(args...);
+#elif LAB_SIMD_NEON
+    case simd::Level::kNeon:
+      return Kernel::template Run<16>(args...);
+#endif
+    default:
+      return Kernel::template Run<0>(args...);
+  }
+}
+
+/**
+ * @brief Applies a bitwise functor word by word, `dst[i] = Op{}(dst[i], src[i])` (e.g. bitmap intersections).
+ * @internal
+ *
+ * @throws None (no-throw guarantee).
+ */
+template<IsSimdBitwiseOp Op>
+auto SimdTransformWords(
+  std::uint64_t* dst,  //
+  const std::uint64_t* src,
+  std::size_t n
+) noexcept -> void {
+  SimdDispatch<SimdWordsKernel<Op>>(dst, src, n);
+}
+
+/**
+ * @brief Counts the set bits of `n` words.
+ * @internal
+ *
+ * @throws None (no-throw guarantee).
+ */
+[[nodiscard]] auto SimdPopCountWords(
+  const std::uint64_t* data,  //
+  std::size_t n
+) noexcept -> std::size_t {
+  return SimdDispatch<SimdPopCountKernel>(data, n);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Finds the first element equal to `value`.
+ *
+ * @throws None (no-throw guarantee).
+ *
+ * @return Iterator to the found element or end iterator.
+ *
+ * @note Uses `operator==` semantics: `NaN` is never found, `-0.0` and `0.0` are equal.
+ */
+template<IsSimdRange Range>
+[[nodiscard]] auto Find(
+  Range&& range,  //
+  const std::ranges::range_value_t<Range>& value
+) noexcept -> std::ranges::borrowed_iterator_t<Range> {
+  const std::size_t index{detail::SimdDispatch<SimdFindKernel>(
+    std::to_address(std::ranges::begin(range)), static_cast<std::size_t>(std::ranges::size(range)), value
+  )};
+  return std::ranges::next(std::ranges::begin(range), static_cast<std::ranges::range_difference_t<Range>>(index));
+}
+
+/**
+ * @brief Counts elements equal to `value`.
+ *
+ * @throws None (no-throw guarantee).
+ */
+template<IsSimdRange Range>
+[[nodiscard]] auto Count(
+  const Range& range,  //
+  const std::ranges::range_value_t<Range>& value
+) noexcept -> std::size_t {
+  return detail::SimdDispatch<SimdCountKernel>(
+    std::to_address(std::ranges::begin(range)), static_cast<std::size_t>(std::ranges::size(range)), value
+  );
+}
+
+/**
+ * @brief Checks whether `range` holds an element equal to `value`.
+ *
+ * @throws None (no-throw guarantee).
+ */
+template<IsSimdRange Range>
+[[nodiscard]] auto Contains(
+  const Range& range,  //
+  const std::ranges::range_value_t<Range>& value
+) noexcept -> bool {
+  const auto size{static_cast<std::size_t>(std::ranges::size(range))};
+  return detail::SimdDispatch<SimdFindKernel>(std::to_address(std::ranges::begin(range)), size, value) != size;
+}
+
+/**
+ * @brief Checks whether both ranges have the same size and pairwise equal elements.
+ *
+ * @throws None (no-throw guarantee).
+ */
+template<IsSimdRange Lhs, IsSimdRange Rhs>
+  requires std::same_as<std::ranges::range_value_t<Lhs>, std::ranges::range_value_t<Rhs>>
+[[nodiscard]] auto Equal(
+  const Lhs& lhs,  //
+  const Rhs& rhs
+) noexcept -> bool {
+  const auto size{static_cast<std::size_t>(std::ranges::size(lhs))};
+  return size == static_cast<std::size_t>(std::ranges::size(rhs)) &&
+         detail::SimdDispatch<SimdEqualKernel>(
+           std::to_address(std::ranges::begin(lhs)), std::to_address(std::ranges::begin(rhs)), size
+         );
+}
+
+/**
+ * @brief Finds the smallest and the largest elements.
+ *
+ * @throws None (no-throw guarantee).
+ *
+ * @warning **Undefined Behaviour** if:
+ * - `range` is empty
+ *
+ * @note The result is unspecified if a floating point `range` holds `NaN`.
+ */
+template<IsSimdRange Range>
+[[nodiscard]] auto MinMax(const Range& range) noexcept -> std::ranges::minmax_result<std::ranges::range_value_t<Range>> {
+  assert(!std::ranges::empty(range));
+  const auto [min, max]{detail::SimdDispatch<SimdMinMaxKernel>(
+    std::to_address(std::ranges::begin(range)), static_cast<std::size_t>(std::ranges::size(range))
+  )};
+  return {min, max};
+}
+
+}  // namespace lab
+
+END_EXPORT_SECTION
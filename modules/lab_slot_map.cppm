@@ -0,0 +1,380 @@
+module;
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+#include <utility>
+
+export module lab_slot_map;
+
+export import lab_vector;
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Unordered container of values addressed by stable generational handles.
+ * @class
+ *
+ * @tparam T Value type, must be movable since erasure moves the last value into the gap
+ * @tparam Allocator Allocator type, rebound to the index types for the bookkeeping
+ * @tparam GrowthPolicy Capacity growth policy of the value storage, see `IsGrowthPolicy`
+ *
+ * @details Values live densely in a `Vector`, so iteration is a linear scan without holes. A sparse array of slots
+ * maps a `Handle` to the current position of its value and a parallel array maps each position back to its slot.
+ * Erasure moves the last value into the gap and patches its slot, free slots form an intrusive list. Insertion,
+ * erasure and lookup are O(1) (insertion amortized, as `PushBack`).
+ *
+ * Every slot carries a generation: odd while the slot is occupied, bumped to even on erasure. A handle stores the
+ * generation it was issued with, so handles of erased values never match again, even when the slot is reused. A
+ * slot whose generation would wrap around is retired instead of being reused.
+ *
+ * @note Handles stay valid across reallocations and erasure of other values; references and iterators do not,
+ * as with `Vector`.
+ */
+template<std::movable T, typename Allocator = std::allocator<T>, IsGrowthPolicy GrowthPolicy = OneAndHalfGrowth>
+class [[nodiscard]] SlotMap {
+ public:
+  using ValueType = T;
+  using value_type = T;
+  using Reference = T&;
+  using reference = T&;
+  using ConstReference = const T&;
+  using const_reference = const T&;
+  using Pointer = T*;
+  using pointer = T*;
+  using ConstPointer = const T*;
+  using const_pointer = const T*;
+  using DifferenceType = std::ptrdiff_t;
+  using difference_type = std::ptrdiff_t;
+  using SizeType = std::size_t;
+  using size_type = std::size_t;
+  using AllocatorType = Allocator;
+  using allocator_type = Allocator;
+  using GrowthPolicyType = GrowthPolicy;
+  using Iterator = T*;
+  using iterator = T*;
+  using ConstIterator = const T*;
+  using const_iterator = const T*;
+
+  /**
+   * @brief Stable reference to a value of a `SlotMap`, a default constructed handle refers to nothing.
+   * @struct
+   */
+  struct Handle {
+    std::uint32_t index{std::numeric_limits<std::uint32_t>::max()};
+    std::uint32_t generation{};
+
+    [[nodiscard]] friend constexpr auto operator==(Handle, Handle) noexcept -> bool = default;
+  };
+
+ private:
+  using IndexType = std::uint32_t;
+
+  /**
+   * @brief Sparse entry: position of the value while occupied (odd generation), next free slot otherwise.
+   * @internal
+   */
+  struct Slot {
+    IndexType index;
+    IndexType generation;
+  };
+
+  using SlotAllocator = std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+  using IndexAllocator = std::allocator_traits<Allocator>::template rebind_alloc<IndexType>;
+  using ValueVector = Vector<T, Allocator, GrowthPolicy>;
+
+  static constexpr IndexType kNone{std::numeric_limits<IndexType>::max()};
+  static constexpr IndexType kLastGeneration{std::numeric_limits<IndexType>::max()};
+
+ public:
+  SlotMap() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+
+  explicit SlotMap(const Allocator& allocator)
+    : values_{allocator}
+    , slot_of_{IndexAllocator{allocator}}
+    , slots_{SlotAllocator{allocator}} { }
+
+  SlotMap(const SlotMap&) = default;
+
+  SlotMap(SlotMap&& other) noexcept
+    : values_{std::move(other.values_)}
+    , slot_of_{std::move(other.slot_of_)}
+    , slots_{std::move(other.slots_)}
+    , free_head_{std::exchange(other.free_head_, kNone)} { }
+
+  auto operator=(const SlotMap&) -> SlotMap& = default;
+
+  auto operator=(SlotMap&& other) noexcept(std::is_nothrow_move_assignable_v<ValueVector>) -> SlotMap& {
+    values_ = std::move(other.values_);
+    slot_of_ = std::move(other.slot_of_);
+    slots_ = std::move(other.slots_);
+    free_head_ = std::exchange(other.free_head_, kNone);
+    return *this;
+  }
+
+  ~SlotMap() = default;
+
+  [[nodiscard]] auto begin() noexcept -> Iterator { return values_.begin(); }
+
+  [[nodiscard]] auto end() noexcept -> Iterator { return values_.end(); }
+
+  [[nodiscard]] auto begin() const noexcept -> ConstIterator { return values_.begin(); }
+
+  [[nodiscard]] auto end() const noexcept -> ConstIterator { return values_.end(); }
+
+  [[nodiscard]] auto cbegin() const noexcept -> ConstIterator { return begin(); }
+
+  [[nodiscard]] auto cend() const noexcept -> ConstIterator { return end(); }
+
+  [[nodiscard]] auto Size() const noexcept -> SizeType { return values_.Size(); }
+
+  [[nodiscard]] auto Empty() const noexcept -> bool { return values_.Empty(); }
+
+  [[nodiscard]] auto Capacity() const noexcept -> SizeType { return values_.Capacity(); }
+
+  /**
+   * @brief Largest amount of values, handles index slots with 32 bits.
+   * @public
+   */
+  [[nodiscard]] static constexpr auto MaxSize() noexcept -> SizeType { return kNone; }
+
+  [[nodiscard]] auto GetAllocator() const noexcept -> AllocatorType { return values_.GetAllocator(); }
+
+  /**
+   * @brief Dense view of the values in iteration order.
+   * @public
+   */
+  [[nodiscard]] auto Values() noexcept -> std::span<T> { return {values_.Data(), values_.Size()}; }
+
+  [[nodiscard]] auto Values() const noexcept -> std::span<const T> { return {values_.Data(), values_.Size()}; }
+
+  /**
+   * @brief Handle of the value at `position` in iteration order.
+   * @public
+   *
+   * @warning **Undefined Behaviour** if:
+   * - `position >= Size()`
+   */
+  [[nodiscard]] auto HandleAt(SizeType position) const noexcept -> Handle {
+    assert(position < Size());
+    const IndexType slot{slot_of_[position]};
+    return {slot, slots_[slot].generation};
+  }
+
+  /**
+   * @brief Whether `handle` refers to a value of this map.
+   * @public
+   *
+   * @details Only odd generations are issued, so a handle forged with the even generation of a free slot never
+   * matches.
+   */
+  [[nodiscard]] auto Contains(Handle handle) const noexcept -> bool {
+    return handle.index < slots_.Size() && (handle.generation & 1) != 0 &&
+           slots_[handle.index].generation == handle.generation;
+  }
+
+  /**
+   * @brief Pointer to the value of `handle`, `nullptr` if it was erased.
+   * @public
+   */
+  [[nodiscard]] auto Find(Handle handle) noexcept -> Pointer {
+    return Contains(handle) ? std::addressof(values_[slots_[handle.index].index]) : nullptr;
+  }
+
+  [[nodiscard]] auto Find(Handle handle) const noexcept -> ConstPointer {
+    return Contains(handle) ? std::addressof(values_[slots_[handle.index].index]) : nullptr;
+  }
+
+  /**
+   * @brief Value of `handle`.
+   * @public
+   *
+   * @warning **Undefined Behaviour** if:
+   * - `!Contains(handle)`
+   */
+  [[nodiscard]] auto operator[](Handle handle) noexcept -> Reference {
+    assert(Contains(handle));
+    return values_[slots_[handle.index].index];
+  }
+
+  [[nodiscard]] auto operator[](Handle handle) const noexcept -> ConstReference {
+    assert(Contains(handle));
+    return values_[slots_[handle.index].index];
+  }
+
+  /**
+   * @brief Value of `handle`.
+   * @public
+   *
+   * @throws std::out_of_range if `!Contains(handle)`.
+   */
+  [[nodiscard]] auto At(Handle handle) -> Reference {
+    HandleCheck(handle);
+    return (*this)[handle];
+  }
+
+  [[nodiscard]] auto At(Handle handle) const -> ConstReference {
+    HandleCheck(handle);
+    return (*this)[handle];
+  }
+
+  /**
+   * @brief Makes room for `capacity` values and their bookkeeping.
+   * @public
+   *
+   * @throws std::length_error if `capacity > MaxSize()`.
+   */
+  auto Reserve(SizeType capacity) -> void {
+    if (capacity > MaxSize()) {
+      throw std::length_error{"SlotMap::Reserve: capacity exceeds MaxSize()"};
+    }
+    values_.Reserve(capacity);
+    slot_of_.Reserve(capacity);
+    slots_.Reserve(capacity);
+  }
+
+  /**
+   * @brief Constructs a value from `args` and returns its handle.
+   * @public
+   *
+   * @throws std::length_error if `Size() == MaxSize()` or propagates the exception of the construction, the map is
+   * left unchanged (strong guarantee).
+   */
+  template<typename... Args>
+    requires std::constructible_from<T, Args...>
+  auto Emplace(Args&&... args) -> Handle {
+    if (free_head_ == kNone) {
+      AddFreeSlot();
+    }
+    values_.EmplaceBack(std::forward<Args>(args)...);
+    LAB_TRY { slot_of_.PushBack(free_head_); }
+    LAB_CATCH(...) {
+      values_.PopBack();
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    const IndexType index{free_head_};
+    Slot& slot{slots_[index]};
+    free_head_ = slot.index;
+    slot.index = static_cast<IndexType>(values_.Size() - 1);
+    ++slot.generation;
+    return {index, slot.generation};
+  }
+
+  auto Insert(const T& value) -> Handle { return Emplace(value); }
+
+  auto Insert(T&& value) -> Handle { return Emplace(std::move(value)); }
+
+  /**
+   * @brief Erases the value of `handle` by moving the last value into its place.
+   * @public
+   *
+   * @return Whether a value was erased, `false` for stale handles.
+   *
+   * @details Only the handle of the moved value is patched, every other position stays the same.
+   */
+  auto Erase(Handle handle) noexcept(std::is_nothrow_move_assignable_v<T>) -> bool {
+    if (!Contains(handle)) {
+      return false;
+    }
+    const IndexType position{slots_[handle.index].index};
+    const auto last{static_cast<IndexType>(values_.Size() - 1)};
+    if (position != last) {
+      values_[position] = std::move(values_.Back());
+      slot_of_[position] = slot_of_[last];
+      slots_[slot_of_[position]].index = position;
+    }
+    values_.PopBack();
+    slot_of_.PopBack();
+    ReleaseSlot(handle.index);
+    return true;
+  }
+
+  /**
+   * @brief Erases every value, all handles become stale.
+   * @public
+   */
+  auto Clear() noexcept -> void {
+    for (const IndexType slot : slot_of_) {
+      ReleaseSlot(slot);
+    }
+    values_.Clear();
+    slot_of_.Clear();
+  }
+
+  auto Swap(SlotMap& other) noexcept -> void {
+    values_.Swap(other.values_);
+    slot_of_.Swap(other.slot_of_);
+    slots_.Swap(other.slots_);
+    std::swap(free_head_, other.free_head_);
+  }
+
+ private:
+  auto HandleCheck(Handle handle) const -> void {
+    if (!Contains(handle)) {
+      throw std::out_of_range{std::format(
+        "SlotMap::HandleCheck: handle (which is {}:{}) does not refer to a value",
+        handle.index,
+        handle.generation
+      )};
+    }
+  }
+
+  auto AddFreeSlot() -> void {
+    if (slots_.Size() == MaxSize()) {
+      throw std::length_error{"SlotMap::Emplace: no slot left"};
+    }
+    slots_.PushBack({free_head_, 0});
+    free_head_ = static_cast<IndexType>(slots_.Size() - 1);
+  }
+
+  /**
+   * @brief Marks `index` free; a slot that used its last generation is retired, its handles stay stale forever.
+   * @internal
+   */
+  auto ReleaseSlot(IndexType index) noexcept -> void {
+    Slot& slot{slots_[index]};
+    if (slot.generation == kLastGeneration) {
+      slot.generation = 0;
+      slot.index = kNone;
+      return;
+    }
+    ++slot.generation;
+    slot.index = free_head_;
+    free_head_ = index;
+  }
+
+  ValueVector values_;
+  Vector<IndexType, IndexAllocator> slot_of_;
+  Vector<Slot, SlotAllocator> slots_;
+  IndexType free_head_{kNone};
+};
+
+namespace pmr {
+
+/**
+ * @brief `SlotMap` allocating its storage from a `std::pmr::memory_resource`.
+ */
+template<typename T, IsGrowthPolicy GrowthPolicy = OneAndHalfGrowth>
+using SlotMap = lab::SlotMap<T, std::pmr::polymorphic_allocator<T>, GrowthPolicy>;
+
+}  // namespace pmr
+
+}  // namespace lab
+
+END_EXPORT_SECTION
@@ -0,0 +1,598 @@
+module;
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <exception>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+#include <utility>
+
+export module lab_small_vector;
+
+import lab_vector_base;
+
+/**
+ * @brief Concept for allocator validation
+ * @internal
+ * @concept IsValidSmallVectorAllocatorType
+ *
+ * @details Inline storage is addressed through raw pointers, so fancy pointer allocators are rejected.
+ */
+template<typename Allocator>
+concept IsValidSmallVectorAllocatorType =
+  std::is_pointer_v<typename std::allocator_traits<Allocator>::pointer> &&
+  std::is_pointer_v<typename std::allocator_traits<Allocator>::const_pointer>;
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Contiguous container that stores up to `N` elements inline and spills to the heap on overflow.
+ * @class
+ *
+ * @tparam T Value type to store in container
+ * @tparam N Amount of elements stored without heap allocation
+ * @tparam Allocator Allocator type used for the spilled buffer
+ * @tparam GrowthPolicy Growth policy used once the container lives on the heap
+ *
+ * @note Provides the same interface as `Vector`, so code can switch between both types.
+ */
+template<
+  typename T,
+  std::size_t N,
+  typename Allocator = std::allocator<T>,
+  IsGrowthPolicy GrowthPolicy = OneAndHalfGrowth>
+  requires(N > 0 && IsValidSmallVectorAllocatorType<Allocator>)
+class [[nodiscard]] SmallVector : protected detail::VectorBase<T, Allocator> {
+ protected:
+  using Base = detail::VectorBase<T, Allocator>;
+  using AllocatorTraits = Base::AllocatorTraits;
+
+ public:
+  using ValueType = Base::ValueType;
+  using value_type = Base::ValueType;
+  using Reference = Base::Reference;
+  using reference = Base::Reference;
+  using ConstReference = Base::ConstReference;
+  using const_reference = Base::ConstReference;
+  using Pointer = Base::Pointer;
+  using pointer = Base::Pointer;
+  using ConstPointer = Base::ConstPointer;
+  using const_pointer = Base::ConstPointer;
+  using DifferenceType = Base::DifferenceType;
+  using difference_type = Base::DifferenceType;
+  using SizeType = Base::SizeType;
+  using size_type = Base::SizeType;
+  using AllocatorType = Base::AllocatorType;
+  using allocator_type = Base::AllocatorType;
+  using GrowthPolicyType = GrowthPolicy;
+  using Iterator = Pointer;
+  using iterator = pointer;
+  using ConstIterator = ConstPointer;
+  using const_iterator = const_pointer;
+  using ReverseIterator = std::reverse_iterator<Iterator>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_pointer>;
+
+  static constexpr SizeType kInlineCapacity{N};
+
+ private:
+  static constexpr bool kCanStealBuffer{
+    AllocatorTraits::propagate_on_container_move_assignment::value || AllocatorTraits::is_always_equal::value
+  };
+
+ public:
+  /**
+   * @brief Default constructor for `SmallVector`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @details The container starts in inline mode, no allocation is performed.
+   */
+  SmallVector() noexcept(std::is_nothrow_default_constructible_v<AllocatorType>) { }
+
+  /**
+   * @brief Constructs empty `SmallVector` with `allocator` used for the spilled buffer.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  explicit SmallVector(const AllocatorType& allocator) noexcept : allocator_{allocator} { }
+
+  /**
+   * @brief Constructs `SmallVector` with `n` value initialized elements.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  explicit SmallVector(SizeType n, const AllocatorType& allocator = AllocatorType{}) : allocator_{allocator} {
+    ReserveImpl(n);
+    LAB_TRY {
+      this->UninitializedConstructUsingAllocator(first_, first_ + n, allocator_);
+    }
+    LAB_CATCH(...) {
+      ReleaseHeapBuffer();
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    current_ = first_ + n;
+  }
+
+  /**
+   * @brief Constructs `SmallVector` with copies of the elements from [`first`, `last`).
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  template<std::forward_iterator ForwardIterator>
+  SmallVector(ForwardIterator first, ForwardIterator last, const AllocatorType& allocator = AllocatorType{})
+    : allocator_{allocator} {
+    const auto size{static_cast<SizeType>(std::distance(first, last))};
+    ReserveImpl(size);
+    LAB_TRY {
+      this->UninitializedCopyUsingAllocator(first, last, first_, allocator_);
+    }
+    LAB_CATCH(...) {
+      ReleaseHeapBuffer();
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    current_ = first_ + size;
+  }
+
+  /**
+   * @brief Constructs `SmallVector` with copies of the elements from `ilist`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  SmallVector(std::initializer_list<ValueType> ilist, const AllocatorType& allocator = AllocatorType{})
+    : SmallVector{ilist.begin(), ilist.end(), allocator} { }
+
+  /**
+   * @brief Copy constructor for `SmallVector`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  SmallVector(const SmallVector& other)
+    : allocator_{AllocatorTraits::select_on_container_copy_construction(other.allocator_)}
+    , growth_policy_{other.growth_policy_} {
+    ReserveImpl(other.Size());
+    LAB_TRY {
+      this->UninitializedCopyUsingAllocator(other.cbegin(), other.cend(), first_, allocator_);
+    }
+    LAB_CATCH(...) {
+      ReleaseHeapBuffer();
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    current_ = first_ + other.Size();
+  }
+
+  /**
+   * @brief Move constructor for `SmallVector`.
+   * @public
+   *
+   * @throws None if `T` is nothrow move constructible.
+   *
+   * @details Steals the heap buffer of `other` if it has spilled, relocates the inline elements otherwise.
+   */
+  SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<ValueType>)
+    : allocator_{std::move(other.allocator_)}
+    , growth_policy_{std::move(other.growth_policy_)} {
+    if (!other.IsInline()) {
+      first_ = std::exchange(other.first_, other.InlineData());
+      current_ = std::exchange(other.current_, other.InlineData());
+      last_ = std::exchange(other.last_, other.InlineData() + N);
+      return;
+    }
+    this->UninitializedRelocateUsingAllocator(other.first_, other.current_, first_, allocator_);
+    current_ = first_ + other.Size();
+    other.current_ = other.first_;
+  }
+
+  /**
+   * @brief Destructor for `SmallVector`.
+   * @public
+   *
+   * @details Destroys the elements and releases the heap buffer if the container has spilled.
+   */
+  ~SmallVector() {
+    this->DestroyUsingAllocator(first_, current_, allocator_);
+    if (!IsInline()) {
+      AllocatorTraits::deallocate(allocator_, first_, Capacity());
+    }
+  }
+
+  /**
+   * @brief Copy assignment operator for `SmallVector`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @details Propagates the allocator of `other` when `propagate_on_container_copy_assignment` is set.
+   */
+  auto operator=(const SmallVector& other) -> SmallVector& {
+    if (this == &other) {
+      return *this;
+    }
+    Clear();
+    if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value) {
+      if (!AllocatorTraits::is_always_equal::value && allocator_ != other.allocator_) {
+        // The spilled buffer can only be returned to the allocator that provided it.
+        ReleaseHeapBuffer();
+      }
+      allocator_ = other.allocator_;
+    }
+    ReserveImpl(other.Size());
+    this->UninitializedCopyUsingAllocator(other.cbegin(), other.cend(), first_, allocator_);
+    current_ = first_ + other.Size();
+    return *this;
+  }
+
+  /**
+   * @brief Move assignment operator for `SmallVector`.
+   * @public
+   *
+   * @throws None if `T` is nothrow move constructible and the allocator propagates or is always equal.
+   *
+   * @details Steals the heap buffer of `other` when allocators allow it, relocates the elements otherwise.
+   */
+  auto operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<ValueType> && kCanStealBuffer)
+    -> SmallVector& {
+    assert(this != &other);
+    Clear();
+    if (!other.IsInline() && (kCanStealBuffer || allocator_ == other.allocator_)) {
+      ReleaseHeapBuffer();
+      if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+        allocator_ = std::move(other.allocator_);
+      }
+      first_ = std::exchange(other.first_, other.InlineData());
+      current_ = std::exchange(other.current_, other.InlineData());
+      last_ = std::exchange(other.last_, other.InlineData() + N);
+      return *this;
+    }
+    ReserveImpl(other.Size());
+    this->UninitializedRelocateUsingAllocator(other.first_, other.current_, first_, allocator_);
+    current_ = first_ + other.Size();
+    other.current_ = other.first_;
+    return *this;
+  }
+
+  [[nodiscard]] auto begin() noexcept -> Iterator { return first_; }
+
+  [[nodiscard]] auto end() noexcept -> Iterator { return current_; }
+
+  [[nodiscard]] auto begin() const noexcept -> ConstIterator { return first_; }
+
+  [[nodiscard]] auto end() const noexcept -> ConstIterator { return current_; }
+
+  [[nodiscard]] auto cbegin() const noexcept -> ConstIterator { return first_; }
+
+  [[nodiscard]] auto cend() const noexcept -> ConstIterator { return current_; }
+
+  [[nodiscard]] auto rbegin() noexcept -> ReverseIterator { return ReverseIterator{current_}; }
+
+  [[nodiscard]] auto rend() noexcept -> ReverseIterator { return ReverseIterator{first_}; }
+
+  [[nodiscard]] auto crbegin() const noexcept -> ConstReverseIterator { return ConstReverseIterator{current_}; }
+
+  [[nodiscard]] auto crend() const noexcept -> ConstReverseIterator { return ConstReverseIterator{first_}; }
+
+  [[nodiscard]] auto Size() const noexcept -> SizeType { return static_cast<SizeType>(current_ - first_); }
+
+  [[nodiscard]] auto Capacity() const noexcept -> SizeType { return static_cast<SizeType>(last_ - first_); }
+
+  [[nodiscard]] auto Empty() const noexcept -> bool { return first_ == current_; }
+
+  [[nodiscard]] auto MaxSize() const noexcept -> SizeType { return AllocatorTraits::max_size(allocator_); }
+
+  /**
+   * @brief Provides the ability to check whether the elements are stored inline.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `true` if no heap buffer is owned, `false` otherwise.
+   */
+  [[nodiscard]] auto IsInline() const noexcept -> bool { return first_ == InlineData(); }
+
+  /**
+   * @brief Provides access to the first element of the sequence.
+   * @public
+   *
+   * @warning **Undefined Behaviour** if `Empty() == true`.
+   */
+  [[nodiscard]] auto Front() noexcept -> Reference {
+    assert(!Empty());
+    return *first_;
+  }
+
+  [[nodiscard]] auto Front() const noexcept -> ConstReference {
+    assert(!Empty());
+    return *first_;
+  }
+
+  /**
+   * @brief Provides access to the last element of the sequence.
+   * @public
+   *
+   * @warning **Undefined Behaviour** if `Empty() == true`.
+   */
+  [[nodiscard]] auto Back() noexcept -> Reference {
+    assert(!Empty());
+    return *(current_ - 1);
+  }
+
+  [[nodiscard]] auto Back() const noexcept -> ConstReference {
+    assert(!Empty());
+    return *(current_ - 1);
+  }
+
+  [[nodiscard]] auto operator[](SizeType index) noexcept -> Reference {
+    assert(index < Size());
+    return first_[index];
+  }
+
+  [[nodiscard]] auto operator[](SizeType index) const noexcept -> ConstReference {
+    assert(index < Size());
+    return first_[index];
+  }
+
+  /**
+   * @brief Provides bounds checked access to the element at `index`.
+   * @public
+   *
+   * @throws `std::out_of_range` if `index >= Size()`.
+   */
+  [[nodiscard]] auto At(SizeType index) -> Reference {
+    RangeCheck(index);
+    return first_[index];
+  }
+
+  [[nodiscard]] auto At(SizeType index) const -> ConstReference {
+    RangeCheck(index);
+    return first_[index];
+  }
+
+  [[nodiscard]] auto Data() noexcept -> Pointer { return first_; }
+
+  [[nodiscard]] auto Data() const noexcept -> ConstPointer { return first_; }
+
+  [[nodiscard]] auto GetAllocator() const noexcept -> AllocatorType { return allocator_; }
+
+  [[nodiscard]] auto GetGrowthPolicy() noexcept -> GrowthPolicyType& { return growth_policy_; }
+
+  [[nodiscard]] auto GetGrowthPolicy() const noexcept -> const GrowthPolicyType& { return growth_policy_; }
+
+  /**
+   * @brief Copy constructs the element at the end of the sequence.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  auto PushBack(const ValueType& value) -> void { EmplaceBack(value); }
+
+  /**
+   * @brief Move constructs the element at the end of the sequence.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  auto PushBack(ValueType&& value) -> void { EmplaceBack(std::move(value)); }
+
+  /**
+   * @brief Constructs the object at the end of the sequence with `args`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception, the
+   * container is left unchanged.
+   *
+   * @details `args` may refer to elements of the container.
+   */
+  template<typename... Args>
+  auto EmplaceBack(Args&&... args) -> void {
+    if (current_ == last_) {
+      GrowAndEmplace(std::forward<Args>(args)...);
+      return;
+    }
+    AllocatorTraits::construct(allocator_, current_, std::forward<Args>(args)...);
+    ++current_;
+  }
+
+  /**
+   * @brief Destroys the element at the end of the sequence.
+   * @public
+   *
+   * @warning **Undefined Behaviour** if `Empty() == true`.
+   */
+  auto PopBack() noexcept -> void {
+    assert(!Empty());
+    --current_;
+    AllocatorTraits::destroy(allocator_, current_);
+  }
+
+  /**
+   * @brief Destroys all elements, keeping the current buffer.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  auto Clear() noexcept -> void {
+    this->DestroyUsingAllocator(first_, current_, allocator_);
+    current_ = first_;
+  }
+
+  /**
+   * @brief Releases unused capacity, moving the elements back inline if they fit.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  auto ShrinkToFit() -> void {
+    if (IsInline()) {
+      return;
+    }
+    if (Size() <= N) {
+      const SizeType size{Size()};
+      Pointer heap_first{first_};
+      const SizeType heap_capacity{Capacity()};
+      this->UninitializedRelocateUsingAllocator(heap_first, current_, InlineData(), allocator_);
+      first_ = InlineData();
+      current_ = first_ + size;
+      last_ = first_ + N;
+      AllocatorTraits::deallocate(allocator_, heap_first, heap_capacity);
+      return;
+    }
+    const auto new_capacity{static_cast<SizeType>(growth_policy_.Fit(Size(), sizeof(ValueType)))};
+    if (new_capacity < Capacity()) {
+      ReallocateImpl(new_capacity);
+    }
+  }
+
+  /**
+   * @brief Provides the ability to swap `SmallVector` instances.
+   * @public
+   *
+   * @throws None if `T` is nothrow move constructible.
+   */
+  auto Swap(SmallVector& other) noexcept(std::is_nothrow_move_constructible_v<ValueType>) -> void {
+    SmallVector temp{std::move(other)};
+    other = std::move(*this);
+    *this = std::move(temp);
+  }
+
+ private:
+  [[nodiscard]] auto InlineData() noexcept -> Pointer { return inline_storage_; }
+
+  [[nodiscard]] auto InlineData() const noexcept -> ConstPointer { return inline_storage_; }
+
+  auto RangeCheck(SizeType index) const -> void {
+    if (index >= Size()) {
+      throw std::out_of_range{"SmallVector::RangeCheck: index >= this->Size()"};
+    }
+  }
+
+  /**
+   * @brief Makes sure that an empty container can hold `n` elements.
+   * @private
+   * @internal
+   */
+  auto ReserveImpl(SizeType n) -> void {
+    assert(Empty());
+    if (n > Capacity()) {
+      ReallocateImpl(static_cast<SizeType>(growth_policy_.Fit(n, sizeof(ValueType))));
+    }
+  }
+
+  /**
+   * @brief Moves the sequence into a heap buffer of at least `new_capacity` elements.
+   * @private
+   * @internal
+   *
+   * @details Uses `TryExpandInPlace` for spilled buffers when the allocator supports it.
+   */
+  auto ReallocateImpl(SizeType new_capacity) -> void {
+    const SizeType current_capacity{Capacity()};
+    if constexpr (CanExpandInPlace<AllocatorType>) {
+      if (!IsInline() && new_capacity > current_capacity &&
+          allocator_.TryExpandInPlace(first_, current_capacity, new_capacity)) {
+        last_ = first_ + new_capacity;
+        return;
+      }
+    }
+
+    const SizeType size{Size()};
+    auto [new_first, allocated_capacity]{this->AllocateAtLeastUsingAllocator(new_capacity, allocator_)};
+    LAB_TRY {
+      this->UninitializedRelocateUsingAllocator(first_, current_, new_first, allocator_);
+    }
+    LAB_CATCH(...) {
+      AllocatorTraits::deallocate(allocator_, new_first, allocated_capacity);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    ReleaseHeapBuffer();
+    first_ = new_first;
+    current_ = new_first + size;
+    last_ = new_first + allocated_capacity;
+  }
+
+  /**
+   * @brief Grows the buffer and constructs the new element in it before the old ones are relocated.
+   * @private
+   * @internal
+   *
+   * @details Constructing first keeps `args` that refer to elements of the container valid.
+   */
+  template<typename... Args>
+  auto GrowAndEmplace(Args&&... args) -> void {
+    const auto new_capacity{static_cast<SizeType>(growth_policy_.Grow(Capacity(), Size() + 1, sizeof(ValueType)))};
+    if constexpr (CanExpandInPlace<AllocatorType>) {
+      if (!IsInline() && allocator_.TryExpandInPlace(first_, Capacity(), new_capacity)) {
+        last_ = first_ + new_capacity;
+        AllocatorTraits::construct(allocator_, current_, std::forward<Args>(args)...);
+        ++current_;
+        return;
+      }
+    }
+
+    const SizeType size{Size()};
+    auto [new_first, allocated_capacity]{this->AllocateAtLeastUsingAllocator(new_capacity, allocator_)};
+    LAB_TRY {
+      AllocatorTraits::construct(allocator_, new_first + size, std::forward<Args>(args)...);
+    }
+    LAB_CATCH(...) {
+      AllocatorTraits::deallocate(allocator_, new_first, allocated_capacity);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    LAB_TRY {
+      this->UninitializedRelocateUsingAllocator(first_, current_, new_first, allocator_);
+    }
+    LAB_CATCH(...) {
+      AllocatorTraits::destroy(allocator_, new_first + size);
+      AllocatorTraits::deallocate(allocator_, new_first, allocated_capacity);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    ReleaseHeapBuffer();
+    first_ = new_first;
+    current_ = new_first + size + 1;
+    last_ = new_first + allocated_capacity;
+  }
+
+  /**
+   * @brief Deallocates the spilled buffer (elements must be already destroyed or relocated).
+   * @private
+   * @internal
+   */
+  auto ReleaseHeapBuffer() noexcept -> void {
+    if (!IsInline()) {
+      AllocatorTraits::deallocate(allocator_, first_, Capacity());
+      first_ = current_ = InlineData();
+      last_ = first_ + N;
+    }
+  }
+
+  union {
+    ValueType inline_storage_[N];
+  };
+  Pointer first_{inline_storage_};
+  Pointer current_{inline_storage_};
+  Pointer last_{inline_storage_ + N};
+  [[no_unique_address]] AllocatorType allocator_{};
+  [[no_unique_address]] GrowthPolicyType growth_policy_{};
+};
+
+}  // namespace lab
+
+END_EXPORT_SECTION
@@ -0,0 +1,607 @@
+module;
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+export module lab_soa_vector;
+
+import lab_vector_base;
+
+/**
+ * @brief Columns start on this byte boundary, so column scans begin at a cache line.
+ * @internal
+ */
+inline constexpr std::size_t kSoAColumnAlignment{64};
+
+/**
+ * @brief Allocation unit of the shared column block.
+ * @internal
+ */
+struct alignas(kSoAColumnAlignment) SoACacheLine {
+  std::byte bytes[kSoAColumnAlignment];
+};
+
+/**
+ * @brief Exposes the `VectorBase` helpers for one column.
+ * @internal
+ * @struct
+ */
+template<typename T, typename Allocator>
+struct SoAColumnOps final
+  : lab::detail::VectorBase<T, typename std::allocator_traits<Allocator>::template rebind_alloc<T>> {
+  using Base = lab::detail::VectorBase<T, typename std::allocator_traits<Allocator>::template rebind_alloc<T>>;
+  using typename Base::AllocatorTraits;
+  using typename Base::AllocatorType;
+  using Base::DestroyUsingAllocator;
+  using Base::UninitializedConstructUsingAllocator;
+  using Base::UninitializedCopyUsingAllocator;
+  using Base::UninitializedMoveUsingAllocator;
+};
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab
+ */
+namespace lab {
+
+/**
+ * @brief Structure-of-arrays container: one contiguous column per field with shared size and capacity.
+ * @class
+ *
+ * @tparam Allocator Allocator type, rebound to cache lines for the shared block and to `Ts` for construction
+ * @tparam GrowthPolicy Growth policy, called with the row size (sum of `sizeof(Ts)`) as element size
+ * @tparam Ts Field types, one column each
+ *
+ * @details All columns live in a single allocation, each one starting on a 64-byte boundary. Rows are accessed
+ * through proxy references (`std::tuple<Ts&...>`), columns through `Column<I>()` spans suitable for vectorized
+ * scans. Reallocation keeps the strong guarantee: new columns are built before the old ones are destroyed.
+ */
+template<typename Allocator, IsGrowthPolicy GrowthPolicy, typename... Ts>
+  requires(sizeof...(Ts) > 0)
+class [[nodiscard]] BasicSoAVector {
+  static constexpr std::size_t kColumnCount{sizeof...(Ts)};
+  template<typename T>
+  static constexpr bool kIsCopiedOnRelocation{!kIsTriviallyRelocatable<T> && !std::is_nothrow_move_constructible_v<T>};
+  using BlockAllocatorType = std::allocator_traits<Allocator>::template rebind_alloc<SoACacheLine>;
+  using BlockAllocatorTraits = std::allocator_traits<BlockAllocatorType>;
+  static constexpr bool kPropagatesOnMoveAssignment{
+    std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value
+  };
+  static constexpr bool kIsAllocatorAlwaysEqual{std::allocator_traits<Allocator>::is_always_equal::value};
+  template<std::size_t I>
+  using ColumnType = std::tuple_element_t<I, std::tuple<Ts...>>;
+  template<std::size_t I>
+  using ColumnOps = SoAColumnOps<ColumnType<I>, Allocator>;
+
+ public:
+  using ValueType = std::tuple<Ts...>;
+  using value_type = ValueType;
+  using Reference = std::tuple<Ts&...>;
+  using reference = Reference;
+  using ConstReference = std::tuple<const Ts&...>;
+  using const_reference = ConstReference;
+  using SizeType = std::size_t;
+  using size_type = std::size_t;
+  using DifferenceType = std::ptrdiff_t;
+  using difference_type = std::ptrdiff_t;
+  using AllocatorType = Allocator;
+  using allocator_type = Allocator;
+  using GrowthPolicyType = GrowthPolicy;
+  using Iterator = detail::IndexIterator<false, BasicSoAVector>;
+  using iterator = Iterator;
+  using ConstIterator = detail::IndexIterator<true, BasicSoAVector>;
+  using const_iterator = ConstIterator;
+  using ReverseIterator = std::reverse_iterator<Iterator>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  /**
+   * @brief Bytes of one row across all columns.
+   */
+  static constexpr std::size_t kRowSize{(sizeof(Ts) + ...)};
+
+  BasicSoAVector() noexcept(std::is_nothrow_default_constructible_v<AllocatorType>) = default;
+
+  explicit BasicSoAVector(const AllocatorType& allocator) noexcept : allocator_{allocator} { }
+
+  /**
+   * @brief Constructs `n` value-initialized rows.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  explicit BasicSoAVector(
+    SizeType n,  //
+    const AllocatorType& allocator = AllocatorType{}
+  )
+    : allocator_{allocator} {
+    Resize(n);
+  }
+
+  BasicSoAVector(const BasicSoAVector& other)
+    : allocator_{std::allocator_traits<AllocatorType>::select_on_container_copy_construction(other.allocator_)}
+    , growth_policy_{other.growth_policy_} {
+    if (other.Empty()) {
+      return;
+    }
+    Block block{AllocateBlock(static_cast<SizeType>(growth_policy_.Fit(other.size_, kRowSize)))};
+    LAB_TRY {
+      CopyColumns(other, block, std::index_sequence_for<Ts...>{});
+    }
+    LAB_CATCH(...) {
+      DeallocateBlock(block);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    Adopt(block);
+    size_ = other.size_;
+  }
+
+  BasicSoAVector(BasicSoAVector&& other) noexcept
+    : storage_{std::exchange(other.storage_, Block{})}
+    , size_{std::exchange(other.size_, 0)}
+    , allocator_{std::move(other.allocator_)}
+    , growth_policy_{std::move(other.growth_policy_)} { }
+
+  auto operator=(const BasicSoAVector& other) -> BasicSoAVector& {
+    if (this != &other) {
+      BasicSoAVector temp{other};
+      Swap(temp);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Move assignment, steals the block unless the allocators differ and do not propagate.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception, only
+   * when the allocators compare unequal and do not propagate: the rows are then moved one by one into a block from
+   * the own allocator and the container is left unchanged on failure.
+   */
+  auto operator=(BasicSoAVector&& other) noexcept(kPropagatesOnMoveAssignment || kIsAllocatorAlwaysEqual)
+    -> BasicSoAVector& {
+    if (this == &other) {
+      return *this;
+    }
+    if constexpr (!kPropagatesOnMoveAssignment && !kIsAllocatorAlwaysEqual) {
+      if (allocator_ != other.allocator_) {
+        BasicSoAVector temp{allocator_};
+        temp.growth_policy_ = other.growth_policy_;
+        temp.Reserve(other.size_);
+        for (SizeType row{}; row < other.size_; ++row) {
+          std::apply([&temp](Ts&... fields) { temp.EmplaceBack(std::move(fields)...); }, other[row]);
+        }
+        Swap(temp);
+        return *this;
+      }
+    }
+    Release();
+    storage_ = std::exchange(other.storage_, Block{});
+    size_ = std::exchange(other.size_, 0);
+    growth_policy_ = std::move(other.growth_policy_);
+    if constexpr (kPropagatesOnMoveAssignment) {
+      allocator_ = std::move(other.allocator_);
+    }
+    return *this;
+  }
+
+  ~BasicSoAVector() { Release(); }
+
+  [[nodiscard]] auto begin() noexcept -> Iterator { return {this, 0}; }
+
+  [[nodiscard]] auto end() noexcept -> Iterator { return {this, size_}; }
+
+  [[nodiscard]] auto begin() const noexcept -> ConstIterator { return {this, 0}; }
+
+  [[nodiscard]] auto end() const noexcept -> ConstIterator { return {this, size_}; }
+
+  [[nodiscard]] auto cbegin() const noexcept -> ConstIterator { return begin(); }
+
+  [[nodiscard]] auto cend() const noexcept -> ConstIterator { return end(); }
+
+  [[nodiscard]] auto rbegin() noexcept -> ReverseIterator { return ReverseIterator{end()}; }
+
+  [[nodiscard]] auto rend() noexcept -> ReverseIterator { return ReverseIterator{begin()}; }
+
+  [[nodiscard]] auto crbegin() const noexcept -> ConstReverseIterator { return ConstReverseIterator{cend()}; }
+
+  [[nodiscard]] auto crend() const noexcept -> ConstReverseIterator { return ConstReverseIterator{cbegin()}; }
+
+  [[nodiscard]] auto Size() const noexcept -> SizeType { return size_; }
+
+  [[nodiscard]] auto Capacity() const noexcept -> SizeType { return storage_.capacity; }
+
+  [[nodiscard]] auto Empty() const noexcept -> bool { return !size_; }
+
+  [[nodiscard]] auto MaxSize() const noexcept -> SizeType {
+    return BlockAllocatorTraits::max_size(BlockAllocatorType{allocator_}) * sizeof(SoACacheLine) / kRowSize;
+  }
+
+  [[nodiscard]] auto GetAllocator() const noexcept -> AllocatorType { return allocator_; }
+
+  [[nodiscard]] auto GetGrowthPolicy() noexcept -> GrowthPolicyType& { return growth_policy_; }
+
+  [[nodiscard]] auto GetGrowthPolicy() const noexcept -> const GrowthPolicyType& { return growth_policy_; }
+
+  /**
+   * @brief Contiguous view of field `I` for every row.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  template<std::size_t I>
+    requires(I < kColumnCount)
+  [[nodiscard]] auto Column() noexcept -> std::span<ColumnType<I>> {
+    return {std::get<I>(storage_.columns), size_};
+  }
+
+  template<std::size_t I>
+    requires(I < kColumnCount)
+  [[nodiscard]] auto Column() const noexcept -> std::span<const ColumnType<I>> {
+    return {std::get<I>(storage_.columns), size_};
+  }
+
+  /**
+   * @brief Proxy reference to row `index`.
+   * @public
+   *
+   * @warning **Undefined Behaviour** if:
+   * - `index` >= `Size()`
+   */
+  [[nodiscard]] auto operator[](SizeType index) noexcept -> Reference {
+    assert(index < size_);
+    return std::apply([index](Ts*... columns) { return Reference{columns[index]...}; }, storage_.columns);
+  }
+
+  [[nodiscard]] auto operator[](SizeType index) const noexcept -> ConstReference {
+    assert(index < size_);
+    return std::apply([index](Ts*... columns) { return ConstReference{columns[index]...}; }, storage_.columns);
+  }
+
+  [[nodiscard]] auto Front() noexcept -> Reference { return (*this)[0]; }
+
+  [[nodiscard]] auto Front() const noexcept -> ConstReference { return (*this)[0]; }
+
+  [[nodiscard]] auto Back() noexcept -> Reference { return (*this)[size_ - 1]; }
+
+  [[nodiscard]] auto Back() const noexcept -> ConstReference { return (*this)[size_ - 1]; }
+
+  /**
+   * @brief Reserves space for at least `n` rows in one allocation.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  auto Reserve(SizeType n) -> void {
+    if (n > Capacity()) {
+      Reallocate(static_cast<SizeType>(growth_policy_.Fit(n, kRowSize)));
+    }
+  }
+
+  auto ShrinkToFit() -> void {
+    if (!size_) {
+      Release();
+    } else if (size_ < Capacity()) {
+      Reallocate(static_cast<SizeType>(growth_policy_.Fit(size_, kRowSize)));
+    }
+  }
+
+  auto Clear() noexcept -> void {
+    DestroyRows(0, size_, std::index_sequence_for<Ts...>{});
+    size_ = 0;
+  }
+
+  /**
+   * @brief Resizes to `n` rows, new rows are value-initialized.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  auto Resize(SizeType n) -> void {
+    if (n <= size_) {
+      DestroyRows(n, size_, std::index_sequence_for<Ts...>{});
+      size_ = n;
+      return;
+    }
+    Reserve(n);
+    ConstructRows(n, std::index_sequence_for<Ts...>{});
+    size_ = n;
+  }
+
+  /**
+   * @brief Appends a row constructed from one argument per column.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @details Arguments may refer to rows of this container: on growth they are materialized before reallocation.
+   */
+  template<typename... Args>
+    requires(sizeof...(Args) == kColumnCount)
+  auto EmplaceBack(Args&&... args) -> Reference {
+    if (size_ == Capacity()) {
+      ValueType row(std::forward<Args>(args)...);
+      Reallocate(static_cast<SizeType>(growth_policy_.Grow(Capacity(), size_ + 1, kRowSize)));
+      ConstructRowFromTuple(std::move(row), std::index_sequence_for<Ts...>{});
+    } else {
+      ConstructRow(std::index_sequence_for<Ts...>{}, std::forward<Args>(args)...);
+    }
+    return (*this)[size_++];
+  }
+
+  auto PushBack(const ValueType& row) -> Reference {
+    return std::apply([this](const Ts&... fields) -> Reference { return EmplaceBack(fields...); }, row);
+  }
+
+  auto PushBack(ValueType&& row) -> Reference {
+    return std::apply([this](Ts&... fields) -> Reference { return EmplaceBack(std::move(fields)...); }, row);
+  }
+
+  auto PopBack() noexcept -> void {
+    assert(size_);
+    DestroyRows(size_ - 1, size_, std::index_sequence_for<Ts...>{});
+    --size_;
+  }
+
+  auto Swap(BasicSoAVector& other) noexcept -> void {
+    std::swap(storage_, other.storage_);
+    std::swap(size_, other.size_);
+    std::swap(growth_policy_, other.growth_policy_);
+    if constexpr (std::allocator_traits<AllocatorType>::propagate_on_container_swap::value) {
+      std::swap(allocator_, other.allocator_);
+    }
+  }
+
+ private:
+  struct Block {
+    SoACacheLine* lines{nullptr};
+    SizeType line_count{0};
+    SizeType capacity{0};
+    std::tuple<Ts*...> columns{};
+  };
+
+  /**
+   * @brief Byte offsets of every column (and the total size) for `capacity` rows.
+   * @private
+   * @internal
+   */
+  [[nodiscard]] static constexpr auto ColumnOffsets(SizeType capacity) noexcept -> std::array<SizeType, kColumnCount + 1> {
+    std::array<SizeType, kColumnCount + 1> offsets{};
+    constexpr std::array kSizes{sizeof(Ts)...};
+    for (std::size_t column{}; column < kColumnCount; ++column) {
+      const SizeType end{offsets[column] + kSizes[column] * capacity};
+      offsets[column + 1] = (end + kSoAColumnAlignment - 1) / kSoAColumnAlignment * kSoAColumnAlignment;
+    }
+    return offsets;
+  }
+
+  [[nodiscard]] auto AllocateBlock(SizeType capacity) -> Block {
+    const auto offsets{ColumnOffsets(capacity)};
+    BlockAllocatorType block_allocator{allocator_};
+    Block block{.line_count = offsets.back() / sizeof(SoACacheLine), .capacity = capacity};
+    block.lines = BlockAllocatorTraits::allocate(block_allocator, block.line_count);
+    auto* const bytes{reinterpret_cast<std::byte*>(std::to_address(block.lines))};
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+      ((std::get<I>(block.columns) = reinterpret_cast<ColumnType<I>*>(bytes + offsets[I])), ...);
+    }(std::index_sequence_for<Ts...>{});
+    return block;
+  }
+
+  auto DeallocateBlock(Block& block) noexcept -> void {
+    if (block.lines) {
+      BlockAllocatorType block_allocator{allocator_};
+      BlockAllocatorTraits::deallocate(block_allocator, block.lines, block.line_count);
+    }
+    block = Block{};
+  }
+
+  auto Adopt(Block& block) noexcept -> void {
+    DeallocateBlock(storage_);
+    storage_ = std::exchange(block, Block{});
+  }
+
+  auto Release() noexcept -> void {
+    Clear();
+    DeallocateBlock(storage_);
+  }
+
+  template<std::size_t I>
+  auto DestroyColumn(
+    ColumnType<I>* column,  //
+    SizeType first,
+    SizeType last
+  ) noexcept -> void {
+    if constexpr (!std::is_trivially_destructible_v<ColumnType<I>>) {
+      typename ColumnOps<I>::AllocatorType allocator{allocator_};
+      ColumnOps<I>::DestroyUsingAllocator(column + first, column + last, allocator);
+    }
+  }
+
+  template<std::size_t... I>
+  auto DestroyRows(
+    SizeType first,  //
+    SizeType last,
+    std::index_sequence<I...>
+  ) noexcept -> void {
+    (DestroyColumn<I>(std::get<I>(storage_.columns), first, last), ...);
+  }
+
+  /**
+   * @brief Runs `construct(column<I>)` for every column, destroying already built columns if one throws.
+   * @private
+   * @internal
+   */
+  template<std::size_t... I>
+  auto ForEachColumnOrRollback(
+    auto&& construct,  //
+    auto&& rollback,
+    std::index_sequence<I...>
+  ) -> void {
+    std::size_t built{};
+    LAB_TRY {
+      ((construct(std::integral_constant<std::size_t, I>{}), ++built), ...);
+    }
+    LAB_CATCH(...) {
+      ((I < built ? rollback(std::integral_constant<std::size_t, I>{}) : void()), ...);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+  }
+
+  template<std::size_t... I>
+  auto CopyColumns(
+    const BasicSoAVector& other,  //
+    Block& block,
+    std::index_sequence<I...> sequence
+  ) -> void {
+    ForEachColumnOrRollback(
+      [&]<std::size_t J>(std::integral_constant<std::size_t, J>) {
+        typename ColumnOps<J>::AllocatorType allocator{allocator_};
+        const auto* const source{std::get<J>(other.storage_.columns)};
+        ColumnOps<J>::UninitializedCopyUsingAllocator(
+          source, source + other.size_, std::get<J>(block.columns), allocator
+        );
+      },
+      [&]<std::size_t J>(std::integral_constant<std::size_t, J>) {
+        DestroyColumn<J>(std::get<J>(block.columns), 0, other.size_);
+      },
+      sequence
+    );
+  }
+
+  /**
+   * @brief Relocates every column into a block of `capacity` rows with the strong guarantee.
+   * @private
+   * @internal
+   *
+   * @details Columns that can only be copied are built first, so a throwing copy leaves the old rows untouched;
+   * then trivially relocatable columns are copied with `std::memcpy` and nothrow movable columns are moved. Old
+   * rows are destroyed only after every column was built.
+   */
+  auto Reallocate(SizeType capacity) -> void {
+    Block block{AllocateBlock(capacity)};
+    LAB_TRY {
+      ForEachColumnOrRollback(
+        [&]<std::size_t J>(std::integral_constant<std::size_t, J>) {
+          if constexpr (kIsCopiedOnRelocation<ColumnType<J>>) {
+            typename ColumnOps<J>::AllocatorType allocator{allocator_};
+            const auto* const source{std::get<J>(storage_.columns)};
+            ColumnOps<J>::UninitializedCopyUsingAllocator(
+              source, source + size_, std::get<J>(block.columns), allocator
+            );
+          }
+        },
+        [&]<std::size_t J>(std::integral_constant<std::size_t, J>) {
+          if constexpr (kIsCopiedOnRelocation<ColumnType<J>>) {
+            DestroyColumn<J>(std::get<J>(block.columns), 0, size_);
+          }
+        },
+        std::index_sequence_for<Ts...>{}
+      );
+    }
+    LAB_CATCH(...) {
+      DeallocateBlock(block);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+      (RelocateColumnNoexcept<I>(block), ...);
+      ((kIsTriviallyRelocatable<ColumnType<I>> ? void() : DestroyColumn<I>(std::get<I>(storage_.columns), 0, size_)),
+       ...);
+    }(std::index_sequence_for<Ts...>{});
+    Adopt(block);
+  }
+
+  template<std::size_t I>
+  auto RelocateColumnNoexcept(Block& block) noexcept -> void {
+    using T = ColumnType<I>;
+    auto* const source{std::get<I>(storage_.columns)};
+    auto* const destination{std::get<I>(block.columns)};
+    if constexpr (kIsTriviallyRelocatable<T>) {
+      if (size_) {
+        std::memcpy(static_cast<void*>(destination), static_cast<const void*>(source), size_ * sizeof(T));
+      }
+    } else if constexpr (std::is_nothrow_move_constructible_v<T>) {
+      typename ColumnOps<I>::AllocatorType allocator{allocator_};
+      ColumnOps<I>::UninitializedMoveUsingAllocator(source, source + size_, destination, allocator);
+    }
+  }
+
+  template<std::size_t... I>
+  auto ConstructRows(
+    SizeType n,  //
+    std::index_sequence<I...> sequence
+  ) -> void {
+    ForEachColumnOrRollback(
+      [&]<std::size_t J>(std::integral_constant<std::size_t, J>) {
+        typename ColumnOps<J>::AllocatorType allocator{allocator_};
+        auto* const column{std::get<J>(storage_.columns)};
+        ColumnOps<J>::UninitializedConstructUsingAllocator(column + size_, column + n, allocator);
+      },
+      [&]<std::size_t J>(std::integral_constant<std::size_t, J>) {
+        DestroyColumn<J>(std::get<J>(storage_.columns), size_, n);
+      },
+      sequence
+    );
+  }
+
+  template<std::size_t... I, typename... Args>
+  auto ConstructRow(
+    std::index_sequence<I...> sequence,  //
+    Args&&... args
+  ) -> void {
+    auto arguments{std::forward_as_tuple(std::forward<Args>(args)...)};
+    ForEachColumnOrRollback(
+      [&]<std::size_t J>(std::integral_constant<std::size_t, J>) {
+        typename ColumnOps<J>::AllocatorType allocator{allocator_};
+        ColumnOps<J>::AllocatorTraits::construct(
+          allocator,
+          std::get<J>(storage_.columns) + size_,
+          std::forward<std::tuple_element_t<J, std::tuple<Args&&...>>>(std::get<J>(arguments))
+        );
+      },
+      [&]<std::size_t J>(std::integral_constant<std::size_t, J>) {
+        DestroyColumn<J>(std::get<J>(storage_.columns), size_, size_ + 1);
+      },
+      sequence
+    );
+  }
+
+  template<std::size_t... I>
+  auto ConstructRowFromTuple(
+    ValueType&& row,  //
+    std::index_sequence<I...> sequence
+  ) -> void {
+    ConstructRow(sequence, std::move(std::get<I>(row))...);
+  }
+
+  Block storage_{};
+  SizeType size_{0};
+  [[no_unique_address]] AllocatorType allocator_{};
+  [[no_unique_address]] GrowthPolicyType growth_policy_{};
+};
+
+/**
+ * @brief `BasicSoAVector` with `std::allocator` and the default `Vector` growth policy.
+ */
+template<typename... Ts>
+using SoAVector = BasicSoAVector<std::allocator<std::byte>, OneAndHalfGrowth, Ts...>;
+
+}  // namespace lab
+
+END_EXPORT_SECTION
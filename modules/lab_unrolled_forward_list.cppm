@@ -0,0 +1,834 @@
+module;
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+#include <utility>
+
+export module lab_unrolled_forward_list;
+
+/**
+ * @brief Concept for type validation
+ * @internal
+ * @concept IsValidUnrolledForwardListType
+ *
+ * @details Elements are shifted inside of the node and moved between nodes on split/merge, so the move
+ * constructor is required to be `noexcept`.
+ */
+template<typename T>
+concept IsValidUnrolledForwardListType = std::movable<T> && std::is_nothrow_move_constructible_v<T> &&
+                                         std::destructible<T>;
+
+/**
+ * @brief Concept for allocator validation
+ * @internal
+ * @concept IsValidUnrolledForwardListAllocatorType
+ */
+template<typename Allocator, typename T>
+concept IsValidUnrolledForwardListAllocatorType =
+  IsValidUnrolledForwardListType<typename std::allocator_traits<Allocator>::value_type> &&
+  std::same_as<typename std::allocator_traits<Allocator>::value_type, T>;
+
+/**
+ * @brief Internal node type for unrolled single-linked list
+ * @internal
+ * @struct
+ *
+ * @tparam T Value type to store in node
+ * @tparam K Maximum amount of elements stored in one node
+ *
+ * @details Only first `count_` elements of `values_` are alive, lifetime of elements is managed by the list.
+ */
+template<typename T, std::size_t K>
+struct [[nodiscard]] UnrolledForwardListNode final {
+  constexpr UnrolledForwardListNode() noexcept { }
+
+  constexpr ~UnrolledForwardListNode() { }
+
+  UnrolledForwardListNode* next_{nullptr};
+  std::size_t count_{};
+
+  union {
+    T values_[K];
+  };
+};
+
+/**
+ * @brief Iterator base for UnrolledForwardList (for const and non-const)
+ * @internal
+ * @class
+ *
+ * @tparam IsConst Boolean value for const iterator check
+ * @tparam UnrolledForwardList UnrolledForwardList class type for traversing
+ */
+template<bool IsConst, typename UnrolledForwardList>
+class UnrolledForwardListIteratorBase final {
+  friend UnrolledForwardList;
+  friend UnrolledForwardListIteratorBase<!IsConst, UnrolledForwardList>;
+  using NodePointer = UnrolledForwardList::NodePointer;
+  using SizeType = UnrolledForwardList::SizeType;
+
+ public:
+  using ValueType = UnrolledForwardList::ValueType;
+  using value_type = UnrolledForwardList::ValueType;
+  using Reference =
+    std::conditional_t<IsConst, typename UnrolledForwardList::ConstReference, typename UnrolledForwardList::Reference>;
+  using reference = Reference;
+  using Pointer =
+    std::conditional_t<IsConst, typename UnrolledForwardList::ConstPointer, typename UnrolledForwardList::Pointer>;
+  using pointer = Pointer;
+  using DifferenceType = UnrolledForwardList::DifferenceType;
+  using difference_type = UnrolledForwardList::DifferenceType;
+  using IteratorCategory = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+
+  constexpr UnrolledForwardListIteratorBase() noexcept = default;
+
+ private:
+  constexpr UnrolledForwardListIteratorBase(NodePointer node, SizeType index) noexcept
+    : current_{node}  //
+    , index_{index} { }
+
+ public:
+  constexpr UnrolledForwardListIteratorBase(const UnrolledForwardListIteratorBase<!IsConst, UnrolledForwardList> other
+  ) noexcept
+    : current_{other.current_}  //
+    , index_{other.index_} { }
+
+  constexpr auto operator*() const noexcept -> Reference {
+    assert(current_ && index_ < current_->count_);
+    return current_->values_[index_];
+  }
+
+  constexpr auto operator->() const noexcept -> Pointer {
+    assert(current_ && index_ < current_->count_);
+    return &current_->values_[index_];
+  }
+
+  constexpr auto operator++() noexcept -> UnrolledForwardListIteratorBase& {
+    assert(current_);
+    if (++index_ == current_->count_) {
+      current_ = current_->next_;
+      index_ = 0;
+    }
+    return *this;
+  }
+
+  constexpr auto operator++(int) noexcept -> UnrolledForwardListIteratorBase {
+    auto temp{*this};
+    ++*this;
+    return temp;
+  }
+
+  [[nodiscard]] friend constexpr auto operator==(
+    const UnrolledForwardListIteratorBase lhs,  //
+    const UnrolledForwardListIteratorBase rhs
+  ) noexcept -> bool {
+    return lhs.current_ == rhs.current_ && lhs.index_ == rhs.index_;
+  }
+
+  [[nodiscard]] friend constexpr auto operator!=(
+    const UnrolledForwardListIteratorBase lhs,  //
+    const UnrolledForwardListIteratorBase rhs
+  ) noexcept -> bool {
+    return !(lhs == rhs);
+  }
+
+ private:
+  NodePointer current_{nullptr};
+  SizeType index_{};
+};
+
+START_EXPORT_SECTION
+
+/**
+ * @brief Namespace for Containers laboratory work
+ * @namespace lab::containers
+ */
+namespace lab::containers {
+
+/**
+ * @brief Default amount of elements per node, the node (with `next_` pointer and element count) fills a cache line.
+ */
+template<typename T>
+inline constexpr std::size_t kUnrolledForwardListDefaultCapacity{
+  std::max<std::size_t>(1, (64 - sizeof(void*) - sizeof(std::size_t)) / sizeof(T))
+};
+
+/**
+ * @brief Class that represents unrolled singly-linked list
+ * @class
+ *
+ * @tparam T Value type to store in container
+ * @tparam K Maximum amount of elements stored in one node
+ * @tparam Allocator Allocator type to use in container
+ *
+ * @details Every node stores up to `K` elements in an inline array, so traversal touches one node (and one cache
+ * miss) per `K` elements. Full nodes are split in half on insertion, a node is merged with its successor whenever
+ * their elements fit into one node after erasure, so no node (except during teardown) is ever empty.
+ *
+ * @note Insertion and erasure invalidate iterators to the elements of the affected node and its successor.
+ */
+template<
+  IsValidUnrolledForwardListType T,
+  std::size_t K = kUnrolledForwardListDefaultCapacity<T>,
+  IsValidUnrolledForwardListAllocatorType<T> Allocator = std::allocator<T>>
+  requires(K > 0)
+class [[nodiscard]] UnrolledForwardList {
+  friend UnrolledForwardListIteratorBase<true, UnrolledForwardList<T, K, Allocator>>;
+  friend UnrolledForwardListIteratorBase<false, UnrolledForwardList<T, K, Allocator>>;
+  using Node = UnrolledForwardListNode<T, K>;
+  using InternalAllocatorType = std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using AllocatorTraits = std::allocator_traits<InternalAllocatorType>;
+  using NodePointer = Node*;
+  static constexpr bool kPropagatesOnMoveAssignment{AllocatorTraits::propagate_on_container_move_assignment::value};
+  static constexpr bool kIsAllocatorAlwaysEqual{AllocatorTraits::is_always_equal::value};
+
+ public:
+  using ValueType = T;
+  using value_type = T;
+  using Reference = ValueType&;
+  using reference = value_type&;
+  using ConstReference = const ValueType&;
+  using const_reference = const value_type&;
+  using Pointer = ValueType*;
+  using pointer = value_type*;
+  using ConstPointer = const ValueType*;
+  using const_pointer = const value_type*;
+  using AllocatorType = InternalAllocatorType;
+  using allocator_type = InternalAllocatorType;
+  using SizeType = AllocatorTraits::size_type;
+  using size_type = AllocatorTraits::size_type;
+  using DifferenceType = AllocatorTraits::difference_type;
+  using difference_type = AllocatorTraits::difference_type;
+  using Iterator = UnrolledForwardListIteratorBase<false, UnrolledForwardList<T, K, Allocator>>;
+  using iterator = Iterator;
+  using ConstIterator = UnrolledForwardListIteratorBase<true, UnrolledForwardList<T, K, Allocator>>;
+  using const_iterator = ConstIterator;
+
+  static constexpr SizeType kNodeCapacity{K};
+
+  /**
+   * @brief Default constructor for `UnrolledForwardList`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @details This constructor is defaulted.
+   */
+  constexpr UnrolledForwardList() noexcept = default;
+
+  /**
+   * @brief Constructs `UnrolledForwardList` with allocator.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr explicit UnrolledForwardList(const Allocator& allocator) noexcept : allocator_{allocator} { }
+
+  /**
+   * @brief Copy constructor for `UnrolledForwardList`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  UnrolledForwardList(const UnrolledForwardList& other)
+    : allocator_{AllocatorTraits::select_on_container_copy_construction(other.allocator_)} {
+    AppendRange(other.cbegin(), other.cend());
+  }
+
+  /**
+   * @brief Move constructor for `UnrolledForwardList`.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr UnrolledForwardList(UnrolledForwardList&& other) noexcept
+    : head_{std::exchange(other.head_, nullptr)}  //
+    , allocator_{std::move(other.allocator_)} { }
+
+  /**
+   * @brief Parametrisized constructor for `count` default constructed elements for `UnrolledForwardList`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @details Nodes are filled completely.
+   */
+  constexpr explicit UnrolledForwardList(
+    SizeType count,  //
+    const Allocator& allocator = Allocator{}
+  )
+    : allocator_{allocator} {
+    NodePointer tail{nullptr};
+    LAB_TRY {
+      for (SizeType i{}; i < count; ++i) {
+        EmplaceBackImpl(tail);
+      }
+    }
+    LAB_CATCH(...) {
+      Clear();
+      LAB_PROPAGATE_EXCEPTION;
+    }
+  }
+
+  /**
+   * @brief Parametrisized constructor `Range` like types for `UnrolledForwardList`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @details Nodes are filled completely.
+   */
+  template<std::input_iterator InputIterator>
+  constexpr UnrolledForwardList(
+    InputIterator first,  //
+    InputIterator last,
+    const Allocator& allocator = Allocator{}
+  )
+    : allocator_{allocator} {
+    AppendRange(std::move(first), std::move(last));
+  }
+
+  /**
+   * @brief Parametrisized constructor with `std::initializer_list` for `UnrolledForwardList`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  constexpr explicit UnrolledForwardList(
+    std::initializer_list<ValueType> ilist,  //
+    const Allocator& allocator = Allocator{}
+  )
+    : UnrolledForwardList{ilist.begin(), ilist.end(), allocator} { }
+
+  /**
+   * @brief Destructor for `UnrolledForwardList`.
+   * @public
+   * @internal
+   *
+   * @details Delegates node sequence destruction to `DeleteRange`.
+   * @see DeleteRange
+   */
+  constexpr ~UnrolledForwardList() { DeleteRange(); }
+
+  /**
+   * @brief Returns `Iterator` to the beginning of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto begin() noexcept -> Iterator { return {head_, 0}; }
+
+  /**
+   * @brief Returns `Iterator` to the end of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto end() noexcept -> Iterator { return {}; }
+
+  /**
+   * @brief Returns `ConstIterator` to the beginning of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto begin() const noexcept -> ConstIterator { return {head_, 0}; }
+
+  /**
+   * @brief Returns `ConstIterator` to the end of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto end() const noexcept -> ConstIterator { return {}; }
+
+  /**
+   * @brief Returns `ConstIterator` to the beginning of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> ConstIterator { return {head_, 0}; }
+
+  /**
+   * @brief Returns `ConstIterator` to the end of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto cend() const noexcept -> ConstIterator { return {}; }
+
+  /**
+   * @brief Provides access to the first element of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `Empty() == true`
+   * @see Empty
+   */
+  [[nodiscard]] constexpr auto Front() noexcept -> Reference {
+    assert(head_);
+    return head_->values_[0];
+  }
+
+  /**
+   * @brief Provides access to the first element of the sequence (const overload).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `Empty() == true`
+   * @see Empty
+   */
+  [[nodiscard]] constexpr auto Front() const noexcept -> ConstReference {
+    assert(head_);
+    return head_->values_[0];
+  }
+
+  /**
+   * @brief Provides the ability to check underlying container state.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto Empty() const noexcept -> bool { return !head_; }
+
+  /**
+   * @brief Returns amount of nodes in the sequence in O(nodes).
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto NodeCount() const noexcept -> SizeType {
+    SizeType count{};
+    for (NodePointer node{head_}; node; node = node->next_) {
+      ++count;
+    }
+    return count;
+  }
+
+  /**
+   * @brief Provides the access of allocator type used by the contianer.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto GetAllocator() const noexcept -> AllocatorType { return allocator_; }
+
+  /**
+   * @brief Returns theoretical maximum size of the container.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  [[nodiscard]] constexpr auto MaxSize() const noexcept -> SizeType {
+    return AllocatorTraits::max_size(allocator_) * kNodeCapacity;
+  }
+
+  /**
+   * @brief Destroys the sequence obtained by the container.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto Clear() noexcept -> void { DeleteRange(); }
+
+ private:
+  /**
+   * @brief Helper method for empty node allocation.
+   * @private
+   * @internal
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  constexpr auto AllocateNode() -> NodePointer {
+    NodePointer node{AllocatorTraits::allocate(allocator_, 1)};
+    std::construct_at(node);
+    return node;
+  }
+
+  /**
+   * @brief Helper method for node deallocation, elements must be destroyed beforehand.
+   * @private
+   * @internal
+   */
+  constexpr auto DeallocateNode(NodePointer node) noexcept -> void {
+    assert(node);
+    std::destroy_at(node);
+    AllocatorTraits::deallocate(allocator_, node, 1);
+  }
+
+  constexpr auto ConstructElement(NodePointer node, SizeType index, auto&&... args) -> void {
+    AllocatorTraits::construct(allocator_, node->values_ + index, std::forward<decltype(args)>(args)...);
+  }
+
+  constexpr auto DestroyElement(NodePointer node, SizeType index) noexcept -> void {
+    if constexpr (!std::is_trivially_destructible_v<ValueType>) {
+      AllocatorTraits::destroy(allocator_, node->values_ + index);
+    }
+  }
+
+  /**
+   * @brief Moves `[first, last)` elements of `source` to `destination` starting at `index`.
+   * @private
+   * @internal
+   *
+   * @details Element counts are left to the caller.
+   */
+  constexpr auto MoveElements(
+    NodePointer source,  //
+    SizeType first,
+    SizeType last,
+    NodePointer destination,
+    SizeType index
+  ) noexcept -> void {
+    for (; first != last; ++first, ++index) {
+      ConstructElement(destination, index, std::move(source->values_[first]));
+      DestroyElement(source, first);
+    }
+  }
+
+  /**
+   * @brief Shifts elements `[index, count_)` one slot right, leaving uninitialized slot at `index`.
+   * @private
+   * @internal
+   */
+  constexpr auto OpenGap(NodePointer node, SizeType index) noexcept -> void {
+    assert(node->count_ < kNodeCapacity);
+    for (SizeType i{node->count_}; i != index; --i) {
+      ConstructElement(node, i, std::move(node->values_[i - 1]));
+      DestroyElement(node, i - 1);
+    }
+  }
+
+  /**
+   * @brief Shifts elements `[index + 1, count_ + 1)` one slot left, closing uninitialized slot at `index`.
+   * @private
+   * @internal
+   */
+  constexpr auto CloseGap(NodePointer node, SizeType index) noexcept -> void {
+    for (SizeType i{index}; i != node->count_; ++i) {
+      ConstructElement(node, i, std::move(node->values_[i + 1]));
+      DestroyElement(node, i + 1);
+    }
+  }
+
+  /**
+   * @brief Constructs the element at the end of the sequence ending with `tail` node.
+   * @private
+   * @internal
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  constexpr auto EmplaceBackImpl(NodePointer& tail, auto&&... args) -> void {
+    if (tail && tail->count_ != kNodeCapacity) {
+      ConstructElement(tail, tail->count_, std::forward<decltype(args)>(args)...);
+      ++tail->count_;
+      return;
+    }
+    NodePointer node{AllocateNode()};
+    LAB_TRY { ConstructElement(node, 0, std::forward<decltype(args)>(args)...); }
+    LAB_CATCH(...) {
+      DeallocateNode(node);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    node->count_ = 1;
+    (tail ? tail->next_ : head_) = node;
+    tail = node;
+  }
+
+  template<typename InputIterator, typename Sentinel>
+  constexpr auto AppendRange(InputIterator first, Sentinel last) -> void {
+    NodePointer tail{nullptr};
+    LAB_TRY {
+      for (; first != last; ++first) {
+        EmplaceBackImpl(tail, *first);
+      }
+    }
+    LAB_CATCH(...) {
+      Clear();
+      LAB_PROPAGATE_EXCEPTION;
+    }
+  }
+
+  /**
+   * @brief Constructs the element at `index` of `node`, splitting full node in half.
+   * @private
+   * @internal
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @return `Iterator` to the constructed element.
+   */
+  constexpr auto EmplaceAt(NodePointer node, SizeType index, auto&&... args) -> Iterator {
+    assert(node && index <= node->count_);
+    const NodePointer origin{node};
+    NodePointer split{nullptr};
+    if (node->count_ == kNodeCapacity) {
+      split = AllocateNode();
+      const SizeType middle{(kNodeCapacity + 1) / 2};
+      MoveElements(node, middle, kNodeCapacity, split, 0);
+      split->count_ = kNodeCapacity - middle;
+      node->count_ = middle;
+      split->next_ = node->next_;
+      node->next_ = split;
+      if (index > node->count_ || node->count_ == kNodeCapacity) {
+        index -= node->count_;
+        node = split;
+      }
+    }
+    OpenGap(node, index);
+    LAB_TRY { ConstructElement(node, index, std::forward<decltype(args)>(args)...); }
+    LAB_CATCH(...) {
+      CloseGap(node, index);
+      if (split && split->count_ == 0) {
+        UnlinkNext(origin);
+      }
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    ++node->count_;
+    return {node, index};
+  }
+
+  /**
+   * @brief Unlinks and deallocates the empty successor of `previous` or head if `previous` is `nullptr`.
+   * @private
+   * @internal
+   */
+  constexpr auto UnlinkNext(NodePointer previous) noexcept -> void {
+    NodePointer& link{previous ? previous->next_ : head_};
+    NodePointer node{link};
+    assert(node && node->count_ == 0);
+    link = node->next_;
+    DeallocateNode(node);
+  }
+
+  /**
+   * @brief Finds predecessor of `node` (or `nullptr` for head) in O(nodes).
+   * @private
+   * @internal
+   */
+  [[nodiscard]] constexpr auto FindPrevious(NodePointer node) const noexcept -> NodePointer {
+    if (node == head_) {
+      return nullptr;
+    }
+    NodePointer traverser{head_};
+    while (traverser->next_ != node) {
+      traverser = traverser->next_;
+    }
+    return traverser;
+  }
+
+ public:
+  /**
+   * @brief Copy constructs the element at the beginning of the sequence.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  constexpr auto PushFront(const ValueType& value) -> void { EmplaceFront(value); }
+
+  /**
+   * @brief Move constructs the element at the beginning of the sequence.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   */
+  constexpr auto PushFront(ValueType&& value) -> void { EmplaceFront(std::move(value)); }
+
+  /**
+   * @brief Constructs the object at the beginning of the sequence with `args`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception.
+   *
+   * @details Shifts elements of the head node if it has a free slot, otherwise prepends a new node.
+   */
+  constexpr auto EmplaceFront(auto&&... args) -> void {
+    if (head_ && head_->count_ != kNodeCapacity) {
+      EmplaceAt(head_, 0, std::forward<decltype(args)>(args)...);
+      return;
+    }
+    NodePointer node{AllocateNode()};
+    LAB_TRY { ConstructElement(node, 0, std::forward<decltype(args)>(args)...); }
+    LAB_CATCH(...) {
+      DeallocateNode(node);
+      LAB_PROPAGATE_EXCEPTION;
+    }
+    node->count_ = 1;
+    node->next_ = head_;
+    head_ = node;
+  }
+
+  /**
+   * @brief Inserts the element after `position` by copy constructing.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails or propagates user defined exception.
+   *
+   * @details Inserts at the beginning of the sequence if `position == cend()`.
+   */
+  constexpr auto InsertAfter(ConstIterator position, const ValueType& value) -> Iterator {
+    return EmplaceAfter(position, value);
+  }
+
+  /**
+   * @brief Inserts the element after `position` by move constructing.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails or propagates user defined exception.
+   *
+   * @details Inserts at the beginning of the sequence if `position == cend()`.
+   */
+  constexpr auto InsertAfter(ConstIterator position, ValueType&& value) -> Iterator {
+    return EmplaceAfter(position, std::move(value));
+  }
+
+  /**
+   * @brief Constructs the element after `position` with `args`.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails or propagates user defined exception.
+   *
+   * @details Inserts at the beginning of the sequence if `position == cend()`.
+   */
+  constexpr auto EmplaceAfter(ConstIterator position, auto&&... args) -> Iterator {
+    if (position == cend()) {
+      EmplaceFront(std::forward<decltype(args)>(args)...);
+      return begin();
+    }
+    return EmplaceAt(position.current_, position.index_ + 1, std::forward<decltype(args)>(args)...);
+  }
+
+  /**
+   * @brief Erases element at the specified position.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   *
+   * @return `Iterator` to the element following the erased one.
+   *
+   * @details Merges the node with its successor if their elements fit into one node. Predecessor lookup (O(nodes)) is
+   * only required when the last element of the tail node is erased.
+   *
+   * @warning **Undefined Behaviour** if:
+   *   - `position` argument is not in range [`cbegin()`, `cend()`)
+   * @see cbegin, cend
+   */
+  constexpr auto Erase(ConstIterator position) noexcept -> Iterator {
+    NodePointer node{position.current_};
+    const SizeType index{position.index_};
+    assert(node && index < node->count_);
+    DestroyElement(node, index);
+    --node->count_;
+    CloseGap(node, index);
+
+    if (NodePointer next{node->next_}; next && node->count_ + next->count_ <= kNodeCapacity) {
+      MoveElements(next, 0, next->count_, node, node->count_);
+      node->count_ += std::exchange(next->count_, 0);
+      UnlinkNext(node);
+    }
+    if (node->count_ == 0) {
+      UnlinkNext(FindPrevious(node));
+      return end();
+    }
+    if (index == node->count_) {
+      return {node->next_, 0};
+    }
+    return {node, index};
+  }
+
+  /**
+   * @brief Provides the ability to swap `UnrolledForwardList` instances.
+   * @public
+   *
+   * @throws May throw exception if user defined allocator throws when swapping.
+   */
+  constexpr auto Swap(UnrolledForwardList& other) noexcept(AllocatorTraits::is_always_equal::value) -> void {
+    assert(this != &other);
+    if constexpr (AllocatorTraits::propagate_on_container_swap::value) {
+      std::swap(allocator_, other.allocator_);
+    }
+    std::swap(head_, other.head_);
+  }
+
+  /**
+   * @brief Destroys element from the beginning of the sequence.
+   * @public
+   *
+   * @throws None (no-throw guarantee).
+   */
+  constexpr auto PopFront() noexcept -> void { Erase(cbegin()); }
+
+ private:
+  /**
+   * @brief Helper function for destructing the whole sequence.
+   * @private
+   * @internal
+   */
+  constexpr auto DeleteRange() noexcept -> void {
+    while (head_) {
+      NodePointer node{std::exchange(head_, head_->next_)};
+      for (SizeType i{}; i != node->count_; ++i) {
+        DestroyElement(node, i);
+      }
+      DeallocateNode(node);
+    }
+  }
+
+ public:
+  auto operator=(const UnrolledForwardList& other) -> UnrolledForwardList& {
+    assert(this != &other);
+    auto temp{other};
+    return *this = std::move(temp);
+  }
+
+  /**
+   * @brief Move assignment, steals the nodes unless the allocators differ and do not propagate.
+   * @public
+   *
+   * @throws `std::bad_alloc` if memory allocation fails (std::allocator) or propagates user defined exception, only
+   * when the allocators compare unequal and do not propagate: the elements are then moved one by one into nodes
+   * from the own allocator and the container is left unchanged on failure.
+   */
+  constexpr auto operator=(UnrolledForwardList&& other) noexcept(kPropagatesOnMoveAssignment || kIsAllocatorAlwaysEqual)
+    -> UnrolledForwardList& {
+    assert(this != &other);
+    if constexpr (!kPropagatesOnMoveAssignment && !kIsAllocatorAlwaysEqual) {
+      if (allocator_ != other.allocator_) {
+        UnrolledForwardList temp{allocator_};
+        temp.AppendRange(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        DeleteRange();
+        head_ = std::exchange(temp.head_, nullptr);
+        return *this;
+      }
+    }
+    DeleteRange();
+    std::swap(head_, other.head_);
+    if constexpr (kPropagatesOnMoveAssignment) {
+      allocator_ = std::move(other.allocator_);
+    }
+    return *this;
+  }
+
+ private:
+  NodePointer head_{nullptr};
+  [[no_unique_address]] AllocatorType allocator_;
+};
+
+}  // namespace lab::containers
+
+END_EXPORT_SECTION
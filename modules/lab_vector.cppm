@@ -1,178 +1,60 @@
 module;
 
 #include <algorithm>
-#include <concepts>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
 #include <exception>
 #include <format>
 #include <initializer_list>
 #include <iterator>
-#include <limits>
 #include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <span>
 #include <stdexcept>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
 #include <type_traits>
 #include <utility>
 
 export module lab_vector;
 
-template<typename T>
-concept IsValidVectorValueType = (std::copyable<T> || std::movable<T>) && std::is_nothrow_destructible_v<T>;
-
-template<typename Allocator, typename T>
-concept IsValidVectorAllocatorType = IsValidVectorValueType<typename std::allocator_traits<Allocator>::value_type> &&
-                                     std::same_as<typename std::allocator_traits<Allocator>::value_type, T>;
-
-// clang-format off
-#if __cplusplus > 202302L
-  #define LAB_CXX26_CONSTEXPR constexpr
-#else
-  #define LAB_CXX26_CONSTEXPR
-#endif
-// clang-format on
-
-#ifdef __cpp_exceptions
-  #define LAB_TRY_BEGIN \
-    try                 \
-    {
-  #define LAB_TRY_END }
-  #define LAB_CATCH_BEGIN(exception) \
-    catch (exception)                \
-    {
-  #define LAB_CATCH_END }
-  #define LAB_PROPAGATE_EXCEPTION
-#else
-  #define LAB_TRY_BEGIN \
-    if (true)           \
-    {
-  #define LAB_TRY_END }
-  #define LAB_CATCH_BEGIN(exception) \
-    if (false)                       \
-    {
-  #define LAB_CATCH_END }
-  #define LAB_PROPAGATE_EXCEPTION throw;
-#endif
-
-template<IsValidVectorValueType T, IsValidVectorAllocatorType<T> Allocator>
-class VectorBase
-{
- public:
-  using AllocatorType = Allocator;
-  using AllocatorTraits = std::allocator_traits<AllocatorType>;
-  using ValueType = T;
-  using Reference = ValueType&;
-  using ConstReference = const ValueType&;
-  using Pointer = AllocatorTraits::pointer;
-  using ConstPointer = AllocatorTraits::const_pointer;
-  using SizeType = AllocatorTraits::size_type;
-  using DifferenceType = AllocatorTraits::difference_type;
+export import lab_vector_base;
 
- protected:
-  template<std::input_iterator InputIterator>
-  static auto UninitializedCopyUsingAllocator(
-    InputIterator first_s,  //
-    InputIterator last_s,
-    Pointer first_d,
-    AllocatorType& allocator
-  ) -> void
-  {
-    Pointer temp{first_d};
-    LAB_TRY_BEGIN
-    while (first_s != last_s)
-    {
-      AllocatorTraits::construct(allocator, first_d, *first_s);
-      ++first_s;
-      ++first_d;
-    }
-    LAB_TRY_END
-    LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
-    while (temp != first_d)
-    {
-      AllocatorTraits::destroy(allocator, temp);
-      ++temp;
-    }
-    LAB_PROPAGATE_EXCEPTION
-    LAB_CATCH_END
-  }
+import lab_instrumentation;
+import lab_parallel;
 
-  template<std::input_iterator InputIterator>
-  static auto UninitializedMoveUsingAllocator(
-    InputIterator first_s,  //
-    InputIterator last_s,
-    Pointer first_d,
-    Allocator& allocator
-  ) -> void
-  {
-    Pointer temp{first_d};
-    LAB_TRY_BEGIN
-    while (first_s != last_s)
-    {
-      AllocatorTraits::construct(allocator, first_d, std::move(*first_s));
-      ++first_s;
-      ++first_d;
-    }
-    LAB_TRY_END
-    LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
-    while (temp != first_d)
-    {
-      AllocatorTraits::destroy(allocator, temp);
-      ++temp;
-    }
-    LAB_CATCH_END
-  }
-
-  template<std::input_iterator InputIterator, typename... Args>
-  static auto UninitializedConstructUsingAllocator(
-    InputIterator first,  //
-    InputIterator last,
-    AllocatorType& allocator,
-    Args&&... args
-  ) -> void
-  {
-    InputIterator temp{first};
-    LAB_TRY_BEGIN
-    while (first != last)
-    {
-      AllocatorTraits::construct(allocator, first, std::forward<Args>(args)...);
-      ++first;
-    }
-    LAB_TRY_END
-    LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
-    while (temp != first)
-    {
-      AllocatorTraits::destroy(allocator, temp);
-      ++temp;
-    }
-    LAB_PROPAGATE_EXCEPTION
-    LAB_CATCH_END
-  }
-
-  static auto DestroyUsingAllocator(
-    Pointer first,  //
-    Pointer last,
-    AllocatorType& allocator
-  ) -> void
-  {
-    while (first != last)
-    {
-      AllocatorTraits::destroy(allocator, first);
-      ++first;
-    }
-  }
-};
-
-#define BEGIN_EXPORT_SECTION export {
-#define END_EXPORT_SECTION }
-
-BEGIN_EXPORT_SECTION
+START_EXPORT_SECTION
 
 namespace lab
 {
 
-template<typename T, typename Allocator = std::allocator<T>>
-class [[nodiscard]] Vector : protected VectorBase<T, Allocator>
+/**
+ * @brief Contiguous dynamic array.
+ *
+ * @tparam T Value type to store in container
+ * @tparam Allocator Allocator type to use in container
+ * @tparam GrowthPolicy Capacity growth policy, see `IsGrowthPolicy`
+ * @tparam Observer Storage event observer, see `IsContainerObserver`; the default `NullObserver` costs nothing
+ *
+ * @details Usable in constant expressions with `std::allocator`: `std::memcpy`/`std::memmove` fast paths and the
+ * parallel construction fall back to element-wise loops during constant evaluation. As with `std::vector`, the
+ * storage must be released before the evaluation ends, copy the result into a `FixedVector` to keep it.
+ */
+template<
+  typename T,
+  typename Allocator = std::allocator<T>,
+  IsGrowthPolicy GrowthPolicy = OneAndHalfGrowth,
+  IsContainerObserver Observer = NullObserver>
+class [[nodiscard]] Vector : protected detail::VectorBase<T, Allocator>
 {
  protected:
-  using Base = VectorBase<T, Allocator>;
+  using Base = detail::VectorBase<T, Allocator>;
   using AllocatorTraits = Base::AllocatorTraits;
+  static constexpr bool kPropagatesOnCopyAssignment{AllocatorTraits::propagate_on_container_copy_assignment::value};
+  static constexpr bool kPropagatesOnMoveAssignment{AllocatorTraits::propagate_on_container_move_assignment::value};
+  static constexpr bool kIsAllocatorAlwaysEqual{AllocatorTraits::is_always_equal::value};
 
  public:
   using ValueType = Base::ValueType;
@@ -191,6 +73,8 @@ class [[nodiscard]] Vector : protected VectorBase<T, Allocator>
   using size_type = Base::SizeType;
   using AllocatorType = Base::AllocatorType;
   using allocator_type = Base::AllocatorType;
+  using GrowthPolicyType = GrowthPolicy;
+  using ObserverType = Observer;
   using Iterator = Pointer;
   using iterator = pointer;
   using ConstIterator = ConstPointer;
@@ -200,15 +84,22 @@ class [[nodiscard]] Vector : protected VectorBase<T, Allocator>
   using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
   using const_reverse_iterator = std::reverse_iterator<const_pointer>;
 
-  LAB_CXX26_CONSTEXPR Vector() noexcept(std::is_nothrow_default_constructible_v<AllocatorType>) = default;
+  /**
+   * @brief Buffers of at least this many bytes are constructed in parallel by `Vector(n)` and the copy constructors.
+   *
+   * @details Spreads the first touch of fresh pages across `ThreadPool::Default()`.
+   */
+  static constexpr std::size_t kParallelConstructionThreshold{std::size_t{8} << 20};
 
-  explicit LAB_CXX26_CONSTEXPR Vector(
+  constexpr Vector() noexcept(std::is_nothrow_default_constructible_v<AllocatorType>) = default;
+
+  explicit constexpr Vector(
     const AllocatorType& allocator
   ) noexcept
     : allocator_{allocator}
   { }
 
-  LAB_CXX26_CONSTEXPR Vector(
+  constexpr Vector(
     SizeType n,  //
     const AllocatorType& allocator = AllocatorType{}
   )
@@ -219,74 +110,144 @@ class [[nodiscard]] Vector : protected VectorBase<T, Allocator>
       return;
     }
 
-    first_ = AllocatorTraits::allocate(allocator_, n);
+    AllocateStorage(n);
 
     LAB_TRY_BEGIN
-    this->UninitializedConstructUsingAllocator(first_, first_ + n, allocator_);
+    if (ShouldConstructInParallel<std::is_nothrow_default_constructible_v<ValueType>>(n))
+    {
+      detail::ForEachChunk(
+        execution::kPar,
+        std::to_address(first_),
+        n,
+        [this](std::size_t first, std::size_t last)
+        { this->UninitializedConstructUsingAllocator(first_ + first, first_ + last, allocator_); }
+      );
+    }
+    else
+    {
+      this->UninitializedConstructUsingAllocator(first_, first_ + n, allocator_);
+    }
     LAB_TRY_END
     LAB_CATCH_BEGIN(const std::exception& /* error */)
-    AllocatorTraits::deallocate(allocator_, std::exchange(first_, nullptr), std::distance(first_, last_));
-    LAB_PROPAGATE_EXCEPTION
+    DeallocateStorage();
+    LAB_PROPAGATE_EXCEPTION;
     LAB_CATCH_END
 
-    current_ = last_ = first_ + n;
+    current_ = first_ + n;
+  }
+
+  /**
+   * @brief Constructs `n` default-initialized elements.
+   *
+   * @details Trivially default constructible `T` are left indeterminate, so staging buffers that are overwritten
+   * right away (e.g. by `read()`) skip the zeroing pass of `Vector(n)`.
+   */
+  constexpr Vector(
+    SizeType n,  //
+    DefaultInit /* tag */,
+    const AllocatorType& allocator = AllocatorType{}
+  )
+    : allocator_{allocator}
+  {
+    if (!n)
+    {
+      return;
+    }
+
+    AllocateStorage(n);
+    LAB_TRY_BEGIN
+    this->UninitializedDefaultConstructUsingAllocator(first_, first_ + n, allocator_);
+    LAB_TRY_END
+    LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
+    DeallocateStorage();
+    LAB_PROPAGATE_EXCEPTION;
+    LAB_CATCH_END
+    current_ = first_ + n;
   }
 
   constexpr Vector(
     const Vector& other
   )
     : allocator_{AllocatorTraits::select_on_container_copy_construction(other.allocator_)}
+    , growth_policy_{other.growth_policy_}
   {
     if (other.Empty())
     {
       return;
     }
 
-    SizeType capacity{other.Capacity()};
-    first_ = AllocatorTraits::allocate(allocator_, capacity);
+    AllocateStorage(other.Size());
     LAB_TRY_BEGIN
-    this->UninitializedCopyUsingAllocator(other.cbegin(), other.cend(), first_, allocator_);
+    CopyConstructFrom(other);
     LAB_TRY_END
     LAB_CATCH_BEGIN(const std::exception& /* error */)
-    AllocatorTraits::deallocate(allocator_, std::exchange(first_, nullptr), capacity);
-    LAB_PROPAGATE_EXCEPTION
+    DeallocateStorage();
+    LAB_PROPAGATE_EXCEPTION;
     LAB_CATCH_END
-    current_ = last_ = first_ + other.Size();
+    current_ = first_ + other.Size();
   }
 
-  LAB_CXX26_CONSTEXPR Vector(
+  constexpr Vector(
     const Vector& other,  //
     const AllocatorType& allocator
   )
     : Vector{allocator}
   {
+    growth_policy_ = other.growth_policy_;
     if (other.Empty())
     {
       return;
     }
 
-    SizeType capacity{other.Capacity()};
-    first_ = AllocatorTraits::allocate(allocator_, capacity);
+    AllocateStorage(other.Size());
     LAB_TRY_BEGIN
-    UninitializedCopyUsingAllocator(other.cbegin(), other.cend(), first_, allocator_);
+    CopyConstructFrom(other);
     LAB_TRY_END
     LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
-    AllocatorTraits::deallocate(allocator_, std::exchange(first_, nullptr), capacity);
+    DeallocateStorage();
+    LAB_PROPAGATE_EXCEPTION;
     LAB_CATCH_END
-    current_ = last_ = first_ + other.Size();
+    current_ = first_ + other.Size();
   }
 
-  LAB_CXX26_CONSTEXPR Vector(
+  constexpr Vector(
     Vector&& other
   ) noexcept
     : first_{std::exchange(other.first_, nullptr)}  //
     , current_{std::exchange(other.current_, nullptr)}
     , last_{std::exchange(other.last_, nullptr)}
     , allocator_{std::move(other.allocator_)}
+    , growth_policy_{std::move(other.growth_policy_)}
+    , observer_{std::exchange(other.observer_, ObserverType{})}
   { }
 
+  /**
+   * @brief Move constructor with explicit allocator.
+   *
+   * @details Steals the buffer of `other` when the allocators compare equal, otherwise moves its elements into a
+   * buffer obtained from `allocator`.
+   */
+  constexpr Vector(
+    Vector&& other,  //
+    const AllocatorType& allocator
+  )
+    : allocator_{allocator}
+    , growth_policy_{other.growth_policy_}
+  {
+    if (kIsAllocatorAlwaysEqual || allocator_ == other.allocator_)
+    {
+      first_ = std::exchange(other.first_, nullptr);
+      current_ = std::exchange(other.current_, nullptr);
+      last_ = std::exchange(other.last_, nullptr);
+      observer_ = std::exchange(other.observer_, ObserverType{});
+      return;
+    }
+    observer_ = other.observer_;
+    MoveConstructFrom(other);
+  }
+
   template<std::input_iterator InputIterator>
-  LAB_CXX26_CONSTEXPR Vector(
+  constexpr Vector(
     InputIterator first,  //
     InputIterator last,
     const AllocatorType& allocator = AllocatorType{}
@@ -299,25 +260,25 @@ class [[nodiscard]] Vector : protected VectorBase<T, Allocator>
     }
 
     const SizeType size{static_cast<SizeType>(std::distance(first, last))};
-    first_ = AllocatorTraits::allocate(allocator_, size);
+    AllocateStorage(size);
     LAB_TRY_BEGIN
     this->UninitializedCopyUsingAllocator(first, last, first_, allocator_);
     LAB_TRY_END
     LAB_CATCH_BEGIN([[maybe_unused]] std::exception& /* error */)
-    AllocatorTraits::deallocate(allocator_, first_, size);
-    LAB_PROPAGATE_EXCEPTION
+    DeallocateStorage();
+    LAB_PROPAGATE_EXCEPTION;
     LAB_CATCH_END
-    current_ = last_ = first_ + size;
+    current_ = first_ + size;
   }
 
-  LAB_CXX26_CONSTEXPR Vector(
+  constexpr Vector(
     std::initializer_list<ValueType> ilist,  //
     const AllocatorType& allocator = AllocatorType{}
   )
     : Vector{ilist.begin(), ilist.end(), allocator}
   { }
 
-  LAB_CXX26_CONSTEXPR ~Vector()
+  constexpr ~Vector()
   {
     if (first_)
     {
@@ -325,89 +286,98 @@ class [[nodiscard]] Vector : protected VectorBase<T, Allocator>
       {
         this->DestroyUsingAllocator(first_, current_, allocator_);
       }
-      AllocatorTraits::deallocate(allocator_, first_, Capacity());
-      first_ = current_ = last_ = nullptr;
+      DeallocateStorage();
     }
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto begin() noexcept -> Iterator
+  [[nodiscard]] constexpr auto begin() noexcept -> Iterator
   {
     return first_;
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto end() noexcept -> Iterator
+  [[nodiscard]] constexpr auto end() noexcept -> Iterator
   {
     return current_;
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto cbegin() const noexcept -> ConstIterator
+  [[nodiscard]] constexpr auto begin() const noexcept -> ConstIterator
   {
     return first_;
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto cend() const noexcept -> ConstIterator
+  [[nodiscard]] constexpr auto end() const noexcept -> ConstIterator
   {
     return current_;
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto rbegin() noexcept -> ReverseIterator
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> ConstIterator
+  {
+    return first_;
+  }
+
+  [[nodiscard]] constexpr auto cend() const noexcept -> ConstIterator
+  {
+    return current_;
+  }
+
+  [[nodiscard]] constexpr auto rbegin() noexcept -> ReverseIterator
   {
     return {current_};
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto rend() noexcept -> ReverseIterator
+  [[nodiscard]] constexpr auto rend() noexcept -> ReverseIterator
   {
     return {first_};
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto crbegin() const noexcept -> ConstReverseIterator
+  [[nodiscard]] constexpr auto crbegin() const noexcept -> ConstReverseIterator
   {
     return {current_};
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto crend() const noexcept -> ConstReverseIterator
+  [[nodiscard]] constexpr auto crend() const noexcept -> ConstReverseIterator
   {
     return {first_};
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto Size() const noexcept -> SizeType
+  [[nodiscard]] constexpr auto Size() const noexcept -> SizeType
   {
     return std::distance(first_, current_);
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto Capacity() const noexcept -> SizeType
+  [[nodiscard]] constexpr auto Capacity() const noexcept -> SizeType
   {
     return std::distance(first_, last_);
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto Front() noexcept -> Reference
+  [[nodiscard]] constexpr auto Front() noexcept -> Reference
   {
     return *first_;
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto Front() const noexcept -> ConstReference
+  [[nodiscard]] constexpr auto Front() const noexcept -> ConstReference
   {
     return *first_;
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto Back() noexcept -> Reference
+  [[nodiscard]] constexpr auto Back() noexcept -> Reference
   {
     return *std::prev(current_);
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto Back() const noexcept -> ConstReference
+  [[nodiscard]] constexpr auto Back() const noexcept -> ConstReference
   {
     return *std::prev(current_);
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto operator[](
+  [[nodiscard]] constexpr auto operator[](
     SizeType index
   ) noexcept -> Reference
   {
     return first_[index];
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto operator[](
+  [[nodiscard]] constexpr auto operator[](
     SizeType index
   ) const noexcept -> ConstReference
   {
@@ -415,11 +385,11 @@ class [[nodiscard]] Vector : protected VectorBase<T, Allocator>
   }
 
  private:
-  auto RangeCheck(
+  constexpr auto RangeCheck(
     SizeType index
   ) const -> void
   {
-    if (first_ == nullptr || first_ + index >= current_)
+    if (index >= Size())
     {
       throw std::out_of_range{
         std::format("Vector::RangeCheck: index (which is {}) >= this->size() (which is {})", index, Size())
@@ -428,7 +398,7 @@ class [[nodiscard]] Vector : protected VectorBase<T, Allocator>
   }
 
  public:
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto At(
+  [[nodiscard]] constexpr auto At(
     SizeType index
   ) -> Reference
   {
@@ -436,7 +406,7 @@ class [[nodiscard]] Vector : protected VectorBase<T, Allocator>
     return first_[index];
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto At(
+  [[nodiscard]] constexpr auto At(
     SizeType index
   ) const -> ConstReference
   {
@@ -444,208 +414,818 @@ class [[nodiscard]] Vector : protected VectorBase<T, Allocator>
     return first_[index];
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto Data() noexcept -> Pointer
+  [[nodiscard]] constexpr auto Data() noexcept -> Pointer
   {
     return first_;
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto Data() const noexcept -> ConstPointer
+  [[nodiscard]] constexpr auto Data() const noexcept -> ConstPointer
   {
     return first_;
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto Empty() const noexcept -> bool
+  [[nodiscard]] constexpr auto Empty() const noexcept -> bool
   {
     return first_ == current_;
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto MaxSize() const noexcept -> SizeType
+  [[nodiscard]] constexpr auto MaxSize() const noexcept -> SizeType
   {
     return AllocatorTraits::max_size(allocator_);
   }
 
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto GetAllocator() const noexcept -> AllocatorType
+  [[nodiscard]] constexpr auto GetAllocator() const noexcept -> AllocatorType
   {
     return allocator_;
   }
 
-  LAB_CXX26_CONSTEXPR auto ShrinkToFit() -> void
+  [[nodiscard]] constexpr auto GetGrowthPolicy() noexcept -> GrowthPolicyType&
+  {
+    return growth_policy_;
+  }
+
+  [[nodiscard]] constexpr auto GetGrowthPolicy() const noexcept -> const GrowthPolicyType&
+  {
+    return growth_policy_;
+  }
+
+  [[nodiscard]] constexpr auto GetObserver() noexcept -> ObserverType&
+  {
+    return observer_;
+  }
+
+  [[nodiscard]] constexpr auto GetObserver() const noexcept -> const ObserverType&
+  {
+    return observer_;
+  }
+
+  constexpr auto ShrinkToFit() -> void
   {
     if (first_ == current_ || current_ == last_)
     {
       return;
     }
 
-    SizeType new_size{Size()};
-    Pointer new_first{AllocatorTraits::allocate(allocator_, new_size)};
+    const SizeType new_capacity{static_cast<SizeType>(growth_policy_.Fit(Size(), sizeof(ValueType)))};
+    if (new_capacity < Capacity())
+    {
+      ReallocateImpl(new_capacity);
+    }
+  }
+
+  constexpr auto Clear() noexcept -> void
+  {
+    this->DestroyUsingAllocator(first_, current_, allocator_);
+    current_ = first_;
+  }
 
-    LAB_TRY_BEGIN
-    if constexpr (std::is_nothrow_move_constructible_v<ValueType>)
+  constexpr auto Reserve(
+    SizeType new_capacity
+  ) -> void
+  {
+    if (new_capacity > Capacity())
     {
-      UninitializedMoveUsingAllocator(first_, current_, new_first, allocator_);
+      ReallocateImpl(static_cast<SizeType>(growth_policy_.Fit(new_capacity, sizeof(ValueType))));
     }
-    else
+  }
+
+  constexpr auto Resize(
+    SizeType new_size
+  ) -> void
+  {
+    if (new_size <= Size())
     {
-      UninitializedCopyUsingAllocator(first_, current_, new_first, allocator_);
+      EraseAtEnd(first_ + new_size);
+      return;
     }
-    LAB_TRY_END
-    LAB_CATCH_BEGIN([[maybe_unused]] std::exception& /* error */)
-    AllocatorTraits::deallocate(allocator_, new_first, new_size);
-    LAB_PROPAGATE_EXCEPTION
-    LAB_CATCH_END
+    if (new_size > Capacity())
+    {
+      ResizeImpl(new_size);
+    }
+    this->UninitializedConstructUsingAllocator(current_, first_ + new_size, allocator_);
+    current_ = first_ + new_size;
+  }
 
-    if constexpr (!std::is_fundamental_v<ValueType>)
+  constexpr auto Resize(
+    SizeType new_size,  //
+    const ValueType& value
+  ) -> void
+  {
+    if (new_size <= Size())
     {
-      DestroyUsingAllocator(first_, current_, allocator_);
+      EraseAtEnd(first_ + new_size);
+      return;
     }
-    AllocatorTraits::deallocate(allocator_, first_, Capacity());
-    first_ = new_first;
-    current_ = last_ = new_first + new_size;
+    if (new_size > Capacity())
+    {
+      const ValueType copy{value};
+      ResizeImpl(new_size);
+      this->UninitializedConstructUsingAllocator(current_, first_ + new_size, allocator_, copy);
+    }
+    else
+    {
+      this->UninitializedConstructUsingAllocator(current_, first_ + new_size, allocator_, value);
+    }
+    current_ = first_ + new_size;
   }
 
-  LAB_CXX26_CONSTEXPR auto Clear() -> void
+  /**
+   * @brief Resizes to `new_size` elements, new elements are default-initialized.
+   *
+   * @details Same as `Resize(new_size)` but trivially default constructible `T` are not zeroed.
+   */
+  constexpr auto ResizeForOverwrite(
+    SizeType new_size
+  ) -> void
   {
-    if (first_ == last_)
+    if (new_size <= Size())
     {
+      EraseAtEnd(first_ + new_size);
       return;
     }
+    if (new_size > Capacity())
+    {
+      ResizeImpl(new_size);
+    }
+    this->UninitializedDefaultConstructUsingAllocator(current_, first_ + new_size, allocator_);
+    current_ = first_ + new_size;
+  }
 
-    if constexpr (!std::is_fundamental_v<ValueType>)
+  /**
+   * @brief Makes room for `n` elements past the end and returns them without changing `Size()`.
+   *
+   * @return `std::span` over the uninitialized tail, valid until the next modification of the container.
+   *
+   * @details The caller fills a prefix of the span and publishes it with `CommitAppend(count)`; elements that are
+   * not committed are simply dropped. Growth is amortized like `PushBack`.
+   */
+  constexpr auto AppendUninitialized(
+    SizeType n
+  ) -> std::span<ValueType>
+    requires std::is_trivially_default_constructible_v<ValueType> && std::is_trivially_destructible_v<ValueType>
+  {
+    if (n > static_cast<SizeType>(last_ - current_))
     {
-      std::destroy(first_, current_);
+      ResizeImpl(Size() + n);
     }
-    AllocatorTraits::deallocate(allocator_, first_, Size());
+    return {std::to_address(current_), n};
   }
 
- private:
-  [[nodiscard]] LAB_CXX26_CONSTEXPR auto ResizeFactor() const noexcept -> bool
+  /**
+   * @brief Appends the first `count` elements written into the span returned by `AppendUninitialized`.
+   *
+   * @warning **Undefined Behaviour** if:
+   * - `count` exceeds the size of the last `AppendUninitialized` span
+   */
+  constexpr auto CommitAppend(
+    SizeType count
+  ) noexcept -> void
+    requires std::is_trivially_default_constructible_v<ValueType> && std::is_trivially_destructible_v<ValueType>
   {
-    return current_ == last_;
+    assert(count <= static_cast<SizeType>(last_ - current_));
+    current_ += count;
   }
 
-  LAB_CXX26_CONSTEXPR auto ResizeImpl() -> void
+  /**
+   * @brief Appends copies of the elements of `range` to the end of the sequence.
+   *
+   * @details The final size of forward and sized ranges is computed once, so at most one reallocation happens and
+   * contiguous ranges of trivially copyable `T` are copied with `std::memcpy`. Other input ranges are appended with
+   * amortized growth. `range` must not overlap with the container.
+   */
+  template<std::ranges::input_range Range>
+    requires std::constructible_from<ValueType, std::ranges::range_reference_t<Range>>
+  constexpr auto AppendRange(
+    Range&& range
+  ) -> void
   {
-    SizeType current_capacity{Capacity()};
-    SizeType new_capacity{current_capacity + (current_capacity >> 1) + 2};
-    Pointer new_first{AllocatorTraits::allocate(allocator_, new_capacity)};
+    if constexpr (std::ranges::forward_range<Range> || std::ranges::sized_range<Range>)
+    {
+      const auto count{static_cast<SizeType>(std::ranges::distance(range))};
+      if (count > static_cast<SizeType>(last_ - current_))
+      {
+        ReallocateWithGapImpl(Size(), count, std::ranges::begin(range), std::ranges::end(range));
+        return;
+      }
+      this->UninitializedCopyUsingAllocator(std::ranges::begin(range), std::ranges::end(range), current_, allocator_);
+      current_ += count;
+    }
+    else
+    {
+      for (auto&& value : range)
+      {
+        EmplaceBack(std::forward<decltype(value)>(value));
+      }
+    }
+  }
 
-    if constexpr (std::is_nothrow_move_constructible_v<ValueType>)
+  /**
+   * @brief Inserts copies of the elements of `range` before `position`.
+   *
+   * @return `Iterator` to the first inserted element.
+   *
+   * @details Same allocation guarantees as `AppendRange`. Without reallocation trivially relocatable elements are
+   * shifted with a single `std::memmove`, other elements are appended and rotated into place.
+   */
+  template<std::ranges::input_range Range>
+    requires std::constructible_from<ValueType, std::ranges::range_reference_t<Range>>
+  constexpr auto InsertRange(
+    ConstIterator position,  //
+    Range&& range
+  ) -> Iterator
+  {
+    const auto index{static_cast<SizeType>(position - cbegin())};
+    if constexpr (std::ranges::forward_range<Range> || std::ranges::sized_range<Range>)
     {
-      std::uninitialized_move(first_, current_, new_first);
+      const auto count{static_cast<SizeType>(std::ranges::distance(range))};
+      if (count == 0)
+      {
+        return first_ + index;
+      }
+      if (count > static_cast<SizeType>(last_ - current_))
+      {
+        ReallocateWithGapImpl(index, count, std::ranges::begin(range), std::ranges::end(range));
+        return first_ + index;
+      }
+
+      Pointer gap{first_ + index};
+      if constexpr (kIsTriviallyRelocatable<ValueType>)
+      {
+        if !consteval
+        {
+          const auto tail_size{static_cast<std::size_t>(current_ - gap)};
+          std::memmove(
+            static_cast<void*>(std::to_address(gap + count)),
+            static_cast<const void*>(std::to_address(gap)),
+            tail_size * sizeof(ValueType)
+          );
+          LAB_TRY_BEGIN
+          this->UninitializedCopyUsingAllocator(std::ranges::begin(range), std::ranges::end(range), gap, allocator_);
+          LAB_TRY_END
+          LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
+          std::memmove(
+            static_cast<void*>(std::to_address(gap)),
+            static_cast<const void*>(std::to_address(gap + count)),
+            tail_size * sizeof(ValueType)
+          );
+          LAB_PROPAGATE_EXCEPTION;
+          LAB_CATCH_END
+          current_ += count;
+          return gap;
+        }
+      }
+
+      Pointer old_last{current_};
+      this->UninitializedCopyUsingAllocator(std::ranges::begin(range), std::ranges::end(range), current_, allocator_);
+      current_ += count;
+      std::rotate(gap, old_last, current_);
+      return gap;
     }
     else
     {
-      try
+      const SizeType old_size{Size()};
+      for (auto&& value : range)
+      {
+        EmplaceBack(std::forward<decltype(value)>(value));
+      }
+      std::rotate(first_ + index, first_ + old_size, current_);
+      return first_ + index;
+    }
+  }
+
+ private:
+  /**
+   * @brief Checks whether constructing `n` elements is worth spreading across `ThreadPool::Default()`.
+   *
+   * @details Only constructions that cannot throw and do not go through a custom allocator `construct` are split,
+   * so a failure never leaves a partially constructed buffer behind.
+   */
+  template<bool kIsNothrow>
+  [[nodiscard]] static constexpr auto ShouldConstructInParallel(
+    SizeType n
+  ) noexcept -> bool
+  {
+    if constexpr (kIsNothrow && Base::kUsesDefaultConstruct)
+    {
+      if !consteval
       {
-        std::uninitialized_copy(first_, current_, new_first);
+        return n * sizeof(ValueType) >= kParallelConstructionThreshold;
       }
-      catch ([[maybe_unused]] const std::exception& /* error */)
+    }
+    return false;
+  }
+
+  /**
+   * @brief Copy constructs elements of `other` into the freshly allocated storage.
+   */
+  constexpr auto CopyConstructFrom(
+    const Vector& other
+  ) -> void
+  {
+    const SizeType size{other.Size()};
+    if (ShouldConstructInParallel<std::is_nothrow_copy_constructible_v<ValueType>>(size))
+    {
+      detail::ForEachChunk(
+        execution::kPar,
+        std::to_address(first_),
+        size,
+        [this, &other](std::size_t first, std::size_t last)
+        { this->UninitializedCopyUsingAllocator(other.first_ + first, other.first_ + last, first_ + first, allocator_); }
+      );
+      return;
+    }
+    this->UninitializedCopyUsingAllocator(other.cbegin(), other.cend(), first_, allocator_);
+  }
+
+  [[nodiscard]] constexpr auto ResizeFactor() const noexcept -> bool
+  {
+    return current_ == last_;
+  }
+
+  constexpr auto ResizeImpl(
+    SizeType required
+  ) -> void
+  {
+    ReallocateImpl(static_cast<SizeType>(growth_policy_.Grow(Capacity(), required, sizeof(ValueType))));
+  }
+
+  constexpr auto EraseAtEnd(
+    Pointer new_last
+  ) noexcept -> void
+  {
+    this->DestroyUsingAllocator(new_last, current_, allocator_);
+    current_ = new_last;
+  }
+
+  constexpr auto AllocateStorage(
+    SizeType n
+  ) -> void
+  {
+    auto [new_first, new_capacity]{
+      this->AllocateAtLeastUsingAllocator(static_cast<SizeType>(growth_policy_.Fit(n, sizeof(ValueType))), allocator_)
+    };
+    first_ = current_ = new_first;
+    last_ = new_first + new_capacity;
+    observer_.OnReallocate(0, new_capacity, 0, sizeof(ValueType));
+  }
+
+  constexpr auto DeallocateStorage() noexcept -> void
+  {
+    observer_.OnReallocate(Capacity(), 0, 0, sizeof(ValueType));
+    AllocatorTraits::deallocate(allocator_, first_, Capacity());
+    first_ = current_ = last_ = nullptr;
+  }
+
+  constexpr auto ReallocateImpl(
+    SizeType new_capacity
+  ) -> void
+  {
+    SizeType current_capacity{Capacity()};
+    if constexpr (CanExpandInPlace<AllocatorType>)
+    {
+      if (first_ && new_capacity > current_capacity &&
+          allocator_.TryExpandInPlace(first_, current_capacity, new_capacity))
       {
-        AllocatorTraits::deallocate(allocator_, new_first, new_capacity);
-        throw;
+        last_ = first_ + new_capacity;
+        observer_.OnReallocate(current_capacity, new_capacity, 0, sizeof(ValueType));
+        return;
       }
     }
 
-    if constexpr (std::is_fundamental_v<ValueType>)
+    SizeType size{Size()};
+    auto [new_first, allocated_capacity]{this->AllocateAtLeastUsingAllocator(new_capacity, allocator_)};
+
+    LAB_TRY_BEGIN
+    this->UninitializedRelocateUsingAllocator(first_, current_, new_first, allocator_);
+    LAB_TRY_END
+    LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
+    AllocatorTraits::deallocate(allocator_, new_first, allocated_capacity);
+    LAB_PROPAGATE_EXCEPTION;
+    LAB_CATCH_END
+
+    if (first_)
     {
-      std::destroy(first_, current_);
+      AllocatorTraits::deallocate(allocator_, first_, current_capacity);
     }
-    AllocatorTraits::deallocate(allocator_, first_, current_capacity);
     first_ = new_first;
-    current_ = new_first + current_capacity;
-    last_ = new_first + new_capacity;
+    current_ = new_first + size;
+    last_ = new_first + allocated_capacity;
+    observer_.OnReallocate(current_capacity, allocated_capacity, size, sizeof(ValueType));
+  }
+
+  /**
+   * @brief Grows the buffer and constructs the element from `args` at its end before the old ones are relocated.
+   *
+   * @details Constructing first keeps `args` that refer to elements of the container valid, the container is left
+   * untouched if construction throws.
+   */
+  template<typename... Args>
+  constexpr auto GrowAndEmplaceImpl(
+    Args&&... args
+  ) -> void
+  {
+    const SizeType current_capacity{Capacity()};
+    const auto new_capacity{
+      static_cast<SizeType>(growth_policy_.Grow(current_capacity, Size() + 1, sizeof(ValueType)))
+    };
+    if constexpr (CanExpandInPlace<AllocatorType>)
+    {
+      if (first_ && allocator_.TryExpandInPlace(first_, current_capacity, new_capacity))
+      {
+        last_ = first_ + new_capacity;
+        observer_.OnReallocate(current_capacity, new_capacity, 0, sizeof(ValueType));
+        AllocatorTraits::construct(allocator_, current_, std::forward<Args>(args)...);
+        ++current_;
+        return;
+      }
+    }
+
+    const SizeType size{Size()};
+    auto [new_first, allocated_capacity]{this->AllocateAtLeastUsingAllocator(new_capacity, allocator_)};
+
+    LAB_TRY_BEGIN
+    AllocatorTraits::construct(allocator_, new_first + size, std::forward<Args>(args)...);
+    LAB_TRY_END
+    LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
+    AllocatorTraits::deallocate(allocator_, new_first, allocated_capacity);
+    LAB_PROPAGATE_EXCEPTION;
+    LAB_CATCH_END
+
+    LAB_TRY_BEGIN
+    this->UninitializedRelocateUsingAllocator(first_, current_, new_first, allocator_);
+    LAB_TRY_END
+    LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
+    AllocatorTraits::destroy(allocator_, new_first + size);
+    AllocatorTraits::deallocate(allocator_, new_first, allocated_capacity);
+    LAB_PROPAGATE_EXCEPTION;
+    LAB_CATCH_END
+
+    if (first_)
+    {
+      AllocatorTraits::deallocate(allocator_, first_, current_capacity);
+    }
+    first_ = new_first;
+    current_ = new_first + size + 1;
+    last_ = new_first + allocated_capacity;
+    observer_.OnReallocate(current_capacity, allocated_capacity, size, sizeof(ValueType));
+  }
+
+  /**
+   * @brief Reallocates the sequence leaving room for `count` copies of [`first`, `last`) at `index`.
+   *
+   * @details New elements are constructed in the new buffer before the old ones are relocated around them, so the
+   * container is left untouched if construction throws.
+   */
+  template<std::input_iterator InputIterator, std::sentinel_for<InputIterator> Sentinel>
+  constexpr auto ReallocateWithGapImpl(
+    SizeType index,  //
+    SizeType count,
+    InputIterator first,
+    Sentinel last
+  ) -> void
+  {
+    const SizeType size{Size()};
+    auto [new_first, allocated_capacity]{this->AllocateAtLeastUsingAllocator(
+      static_cast<SizeType>(growth_policy_.Grow(Capacity(), size + count, sizeof(ValueType))),
+      allocator_
+    )};
+    Pointer gap{new_first + index};
+
+    LAB_TRY_BEGIN
+    this->UninitializedCopyUsingAllocator(std::move(first), std::move(last), gap, allocator_);
+    LAB_TRY_END
+    LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
+    AllocatorTraits::deallocate(allocator_, new_first, allocated_capacity);
+    LAB_PROPAGATE_EXCEPTION;
+    LAB_CATCH_END
+
+    if constexpr (kIsTriviallyRelocatable<ValueType> || std::is_nothrow_move_constructible_v<ValueType>)
+    {
+      this->UninitializedRelocateUsingAllocator(first_, first_ + index, new_first, allocator_);
+      this->UninitializedRelocateUsingAllocator(first_ + index, current_, gap + count, allocator_);
+    }
+    else
+    {
+      LAB_TRY_BEGIN
+      this->UninitializedCopyUsingAllocator(first_, first_ + index, new_first, allocator_);
+      LAB_TRY_END
+      LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
+      this->DestroyUsingAllocator(gap, gap + count, allocator_);
+      AllocatorTraits::deallocate(allocator_, new_first, allocated_capacity);
+      LAB_PROPAGATE_EXCEPTION;
+      LAB_CATCH_END
+
+      LAB_TRY_BEGIN
+      this->UninitializedCopyUsingAllocator(first_ + index, current_, gap + count, allocator_);
+      LAB_TRY_END
+      LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
+      this->DestroyUsingAllocator(new_first, gap + count, allocator_);
+      AllocatorTraits::deallocate(allocator_, new_first, allocated_capacity);
+      LAB_PROPAGATE_EXCEPTION;
+      LAB_CATCH_END
+
+      this->DestroyUsingAllocator(first_, current_, allocator_);
+    }
+
+    const SizeType old_capacity{Capacity()};
+    if (first_)
+    {
+      AllocatorTraits::deallocate(allocator_, first_, old_capacity);
+    }
+    first_ = new_first;
+    current_ = new_first + size + count;
+    last_ = new_first + allocated_capacity;
+    observer_.OnReallocate(old_capacity, allocated_capacity, size, sizeof(ValueType));
   }
 
  public:
-  LAB_CXX26_CONSTEXPR auto PushBack(
+  constexpr auto PushBack(
     const ValueType& value
   ) -> void
   {
     if (ResizeFactor())
     {
-      ResizeImpl();
+      ValueType copy{value};
+      ResizeImpl(Size() + 1);
+      AllocatorTraits::construct(allocator_, current_, std::move(copy));
+      ++current_;
+      return;
     }
     AllocatorTraits::construct(allocator_, current_, value);
     ++current_;
   }
 
-  LAB_CXX26_CONSTEXPR auto PushBack(
+  constexpr auto PushBack(
     ValueType&& value
   ) -> void
   {
-    if (ResizeFactor())
-    {
-      ResizeImpl();
-    }
-    AllocatorTraits::construct(allocator_, current_, std::move(value));
-    ++current_;
+    EmplaceBack(std::move(value));
   }
 
+  /**
+   * @brief Constructs the object at the end of the sequence with `args`, which may refer to elements of the container.
+   */
   template<typename... Args>
-  LAB_CXX26_CONSTEXPR auto EmplaceBack(
+  constexpr auto EmplaceBack(
     Args&&... args
   ) -> void
   {
     if (ResizeFactor())
     {
-      ResizeImpl();
+      GrowAndEmplaceImpl(std::forward<Args>(args)...);
+      return;
     }
     AllocatorTraits::construct(allocator_, current_, std::forward<Args>(args)...);
     ++current_;
   }
 
-  LAB_CXX26_CONSTEXPR auto PopBack() noexcept -> void
+  constexpr auto PopBack() noexcept -> void
   {
     AllocatorTraits::destroy(allocator_, current_ - 1);
     --current_;
   }
 
-  LAB_CXX26_CONSTEXPR auto Swap(
+  /**
+   * @brief Inserts an element constructed from `args` before `position`.
+   *
+   * @return `Iterator` to the inserted element.
+   *
+   * @details The element is constructed before the tail is shifted, so `args` may refer to elements of the
+   * container. Allocation and shifting follow `InsertRange`.
+   */
+  template<typename... Args>
+  constexpr auto Emplace(
+    ConstIterator position,  //
+    Args&&... args
+  ) -> Iterator
+  {
+    ValueType value(std::forward<Args>(args)...);
+    ValueType* const pointer{std::addressof(value)};
+    return InsertRange(
+      position,
+      std::ranges::subrange{std::make_move_iterator(pointer), std::make_move_iterator(pointer + 1)}
+    );
+  }
+
+  constexpr auto Insert(
+    ConstIterator position,  //
+    const ValueType& value
+  ) -> Iterator
+  {
+    return Emplace(position, value);
+  }
+
+  constexpr auto Insert(
+    ConstIterator position,  //
+    ValueType&& value
+  ) -> Iterator
+  {
+    return Emplace(position, std::move(value));
+  }
+
+  constexpr auto Erase(
+    ConstIterator position
+  ) noexcept(std::is_nothrow_move_assignable_v<ValueType>) -> Iterator
+  {
+    return Erase(position, position + 1);
+  }
+
+  /**
+   * @brief Erases [`first`, `last`) and closes the gap.
+   *
+   * @return `Iterator` following the last erased element.
+   *
+   * @details Trivially relocatable tails are shifted with a single `std::memmove`, other ones are move assigned.
+   */
+  constexpr auto Erase(
+    ConstIterator first,  //
+    ConstIterator last
+  ) noexcept(std::is_nothrow_move_assignable_v<ValueType>) -> Iterator
+  {
+    Pointer gap_first{first_ + (first - cbegin())};
+    if (first == last)
+    {
+      return gap_first;
+    }
+
+    Pointer gap_last{first_ + (last - cbegin())};
+    if constexpr (kIsTriviallyRelocatable<ValueType>)
+    {
+      if !consteval
+      {
+        this->DestroyUsingAllocator(gap_first, gap_last, allocator_);
+        std::memmove(
+          static_cast<void*>(std::to_address(gap_first)),
+          static_cast<const void*>(std::to_address(gap_last)),
+          static_cast<std::size_t>(current_ - gap_last) * sizeof(ValueType)
+        );
+        current_ -= gap_last - gap_first;
+        return gap_first;
+      }
+    }
+    EraseAtEnd(std::move(gap_last, current_, gap_first));
+    return gap_first;
+  }
+
+  /**
+   * @brief Swaps the contents, allocators are swapped only if they propagate on swap.
+   *
+   * @warning **Undefined Behaviour** if:
+   * - allocators do not propagate on swap and `GetAllocator() != other.GetAllocator()`
+   */
+  constexpr auto Swap(
     Vector& other
   ) noexcept(std::is_nothrow_swappable_v<AllocatorType>) -> void
   {
     std::swap(first_, other.first_);
     std::swap(current_, other.current_);
     std::swap(last_, other.last_);
-    if constexpr (AllocatorTraits::propogate_on_container_swap::value)
+    std::swap(growth_policy_, other.growth_policy_);
+    std::swap(observer_, other.observer_);
+    if constexpr (AllocatorTraits::propagate_on_container_swap::value)
     {
       std::swap(allocator_, other.allocator_);
     }
+    else
+    {
+      assert(kIsAllocatorAlwaysEqual || allocator_ == other.allocator_);
+    }
   }
 
-  auto operator=(
+  /**
+   * @brief Copy assignment, reuses the own buffer when it is large enough and the allocator is kept.
+   *
+   * @details A propagating allocator that compares unequal releases the own buffer first. Reusing the buffer
+   * gives the basic guarantee, a reallocation the strong one.
+   */
+  constexpr auto operator=(
     const Vector& other
   ) -> Vector&
   {
     assert(this != &other);
 
+    if constexpr (kPropagatesOnCopyAssignment)
+    {
+      if (!kIsAllocatorAlwaysEqual && allocator_ != other.allocator_)
+      {
+        ReleaseStorage();
+      }
+      allocator_ = other.allocator_;
+    }
+    growth_policy_ = other.growth_policy_;
+
+    if (other.Size() > Capacity())
+    {
+      Vector temp{other, allocator_};
+      ReleaseStorage();
+      first_ = std::exchange(temp.first_, nullptr);
+      current_ = std::exchange(temp.current_, nullptr);
+      last_ = std::exchange(temp.last_, nullptr);
+      observer_.OnReallocate(0, Capacity(), 0, sizeof(ValueType));
+      return *this;
+    }
+    Clear();
+    this->UninitializedCopyUsingAllocator(other.cbegin(), other.cend(), first_, allocator_);
+    current_ = first_ + other.Size();
     return *this;
   }
 
-  auto operator=(
+  /**
+   * @brief Move assignment, steals the buffer of `other` unless the allocators are unequal and do not propagate.
+   *
+   * @throws `std::bad_alloc` only for unequal non-propagating allocators, the elements are moved one by one then.
+   */
+  constexpr auto operator=(
     Vector&& other
-  ) noexcept -> Vector&
+  ) noexcept(kPropagatesOnMoveAssignment || kIsAllocatorAlwaysEqual) -> Vector&
   {
     assert(this != &other);
 
-    Clear();
-    std::swap(first_, other.first_);
-    std::swap(current_, other.current_);
-    std::swap(last_, other.last_);
-    if constexpr (AllocatorTraits::on_container_move_assignment::value)
+    growth_policy_ = std::move(other.growth_policy_);
+    if constexpr (!kPropagatesOnMoveAssignment && !kIsAllocatorAlwaysEqual)
+    {
+      if (allocator_ != other.allocator_)
+      {
+        ReleaseStorage();
+        MoveConstructFrom(other);
+        return *this;
+      }
+    }
+
+    ReleaseStorage();
+    if constexpr (kPropagatesOnMoveAssignment)
     {
       allocator_ = std::move(other.allocator_);
     }
+    first_ = std::exchange(other.first_, nullptr);
+    current_ = std::exchange(other.current_, nullptr);
+    last_ = std::exchange(other.last_, nullptr);
+    observer_ = std::exchange(other.observer_, ObserverType{});
     return *this;
   }
 
  private:
+  /**
+   * @brief Destroys the elements and returns the buffer to the allocator.
+   */
+  constexpr auto ReleaseStorage() noexcept -> void
+  {
+    if (first_)
+    {
+      Clear();
+      DeallocateStorage();
+    }
+  }
+
+  /**
+   * @brief Moves the elements of `other` into a fresh buffer from the own allocator, the own storage must be empty.
+   */
+  constexpr auto MoveConstructFrom(
+    Vector& other
+  ) -> void
+  {
+    if (other.Empty())
+    {
+      return;
+    }
+
+    AllocateStorage(other.Size());
+    LAB_TRY_BEGIN
+    if constexpr (std::is_nothrow_move_constructible_v<ValueType>)
+    {
+      this->UninitializedMoveUsingAllocator(other.first_, other.current_, first_, allocator_);
+    }
+    else
+    {
+      this->UninitializedCopyUsingAllocator(other.cbegin(), other.cend(), first_, allocator_);
+    }
+    LAB_TRY_END
+    LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
+    DeallocateStorage();
+    LAB_PROPAGATE_EXCEPTION;
+    LAB_CATCH_END
+    current_ = first_ + other.Size();
+  }
+
   Pointer first_{nullptr};
   Pointer current_{nullptr};
   Pointer last_{nullptr};
   [[no_unique_address]] AllocatorType allocator_{};
+  [[no_unique_address]] GrowthPolicyType growth_policy_{};
+  [[no_unique_address]] ObserverType observer_{};
 };
 
+namespace pmr
+{
+
+/**
+ * @brief `Vector` allocating its buffer from a `std::pmr::memory_resource`.
+ */
+template<typename T, IsGrowthPolicy GrowthPolicy = OneAndHalfGrowth>
+using Vector = lab::Vector<T, std::pmr::polymorphic_allocator<T>, GrowthPolicy>;
+
+}  // namespace pmr
+
 }  // namespace lab
 
 END_EXPORT_SECTION
@@ -0,0 +1,676 @@
+module;
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <tpu/helper_macros.hpp>
+#include <tpu/modules/module_helper_macros.hpp>
+#include <type_traits>
+#include <utility>
+
+export module lab_vector_base;
+
+template<typename T>
+concept IsValidVectorValueType = (std::copyable<T> || std::movable<T>) && std::is_nothrow_destructible_v<T>;
+
+template<typename Allocator, typename T>
+concept IsValidVectorAllocatorType = IsValidVectorValueType<typename std::allocator_traits<Allocator>::value_type> &&
+                                     std::same_as<typename std::allocator_traits<Allocator>::value_type, T>;
+
+START_EXPORT_SECTION
+
+namespace lab
+{
+
+/**
+ * @brief Trait that marks `T` as relocatable by a plain byte copy.
+ *
+ * @details A trivially relocatable object may be moved to a new address with `std::memcpy` and the source storage
+ * released without running its destructor. Trivially copyable types are detected automatically, other types
+ * (e.g. handles owning a heap buffer) can opt in by specializing this trait with `std::true_type`.
+ */
+template<typename T>
+struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+{ };
+
+template<typename T>
+inline constexpr bool kIsTriviallyRelocatable = IsTriviallyRelocatable<T>::value;
+
+/**
+ * @brief A pair is relocated member-wise, so it is trivially relocatable when both members are.
+ */
+template<typename First, typename Second>
+struct IsTriviallyRelocatable<std::pair<First, Second>>
+  : std::bool_constant<kIsTriviallyRelocatable<First> && kIsTriviallyRelocatable<Second>>
+{ };
+
+/**
+ * @brief Optional allocator extension for growing a block without relocation.
+ *
+ * @details `allocator.TryExpandInPlace(pointer, count, new_count)` returns `true` if the block obtained for `count`
+ * elements now holds `new_count` elements at the same address (e.g. bump arenas extending their last block or
+ * `mremap`-backed allocators); the block is later deallocated with `new_count`. On `false` the block is unchanged.
+ */
+template<typename Allocator>
+concept CanExpandInPlace = requires(
+  Allocator& allocator,
+  typename std::allocator_traits<Allocator>::pointer pointer,
+  typename std::allocator_traits<Allocator>::size_type count
+) {
+  { allocator.TryExpandInPlace(pointer, count, count) } -> std::same_as<bool>;
+};
+
+/**
+ * @brief Interface of `Vector` growth policies.
+ *
+ * @details `policy.Grow(capacity, required, element_size)` returns the capacity to reallocate to when `required`
+ * elements do not fit into `capacity`, `policy.Fit(required, element_size)` returns the capacity used for exact
+ * requests (construction, `ShrinkToFit`). Both must return at least `required`.
+ */
+template<typename Policy>
+concept IsGrowthPolicy = std::semiregular<Policy> && requires(const Policy& policy, std::size_t n) {
+  { policy.Grow(n, n, n) } -> std::same_as<std::size_t>;
+  { policy.Fit(n, n) } -> std::same_as<std::size_t>;
+};
+
+/**
+ * @brief Default growth policy: `capacity * 1.5 + 2`.
+ */
+struct OneAndHalfGrowth
+{
+  [[nodiscard]] constexpr auto Grow(
+    std::size_t capacity,  //
+    std::size_t required,
+    [[maybe_unused]] std::size_t element_size
+  ) const noexcept -> std::size_t
+  {
+    return std::max(capacity + (capacity >> 1) + 2, required);
+  }
+
+  [[nodiscard]] constexpr auto Fit(
+    std::size_t required,  //
+    [[maybe_unused]] std::size_t element_size
+  ) const noexcept -> std::size_t
+  {
+    return required;
+  }
+};
+
+/**
+ * @brief Aggressive growth policy: `capacity * 2`, suited for small short-lived vectors.
+ */
+struct DoubleGrowth
+{
+  [[nodiscard]] constexpr auto Grow(
+    std::size_t capacity,  //
+    std::size_t required,
+    [[maybe_unused]] std::size_t element_size
+  ) const noexcept -> std::size_t
+  {
+    return std::max(capacity ? capacity << 1 : 4, required);
+  }
+
+  [[nodiscard]] constexpr auto Fit(
+    std::size_t required,  //
+    [[maybe_unused]] std::size_t element_size
+  ) const noexcept -> std::size_t
+  {
+    return required;
+  }
+};
+
+/**
+ * @brief Growth policy with factor close to the golden ratio (`capacity * 1.618 + 2`).
+ */
+struct GoldenRatioGrowth
+{
+  [[nodiscard]] constexpr auto Grow(
+    std::size_t capacity,  //
+    std::size_t required,
+    [[maybe_unused]] std::size_t element_size
+  ) const noexcept -> std::size_t
+  {
+    return std::max(capacity + (capacity >> 10) * 633 + ((capacity & 1023) * 633 >> 10) + 2, required);
+  }
+
+  [[nodiscard]] constexpr auto Fit(
+    std::size_t required,  //
+    [[maybe_unused]] std::size_t element_size
+  ) const noexcept -> std::size_t
+  {
+    return required;
+  }
+};
+
+/**
+ * @brief Growth policy that rounds the buffer size up to a multiple of `kPageSize` bytes.
+ *
+ * @tparam kPageSize Power of two granularity in bytes (4 KiB pages, 2 MiB transparent huge pages).
+ * @tparam Base Policy that picks the unrounded capacity.
+ */
+template<std::size_t kPageSize, IsGrowthPolicy Base = OneAndHalfGrowth>
+  requires(std::has_single_bit(kPageSize))
+struct PageGranularGrowth
+{
+  [[nodiscard]] constexpr auto Grow(
+    std::size_t capacity,  //
+    std::size_t required,
+    std::size_t element_size
+  ) const noexcept -> std::size_t
+  {
+    return RoundUp(base_.Grow(capacity, required, element_size), element_size);
+  }
+
+  [[nodiscard]] constexpr auto Fit(
+    std::size_t required,  //
+    std::size_t element_size
+  ) const noexcept -> std::size_t
+  {
+    return RoundUp(base_.Fit(required, element_size), element_size);
+  }
+
+ private:
+  [[nodiscard]] static constexpr auto RoundUp(
+    std::size_t count,  //
+    std::size_t element_size
+  ) noexcept -> std::size_t
+  {
+    const std::size_t bytes{(count * element_size + kPageSize - 1) & ~(kPageSize - 1)};
+    return std::max(bytes / element_size, count);
+  }
+
+  [[no_unique_address]] Base base_{};
+};
+
+using PageGrowth = PageGranularGrowth<std::size_t{4} << 10>;
+using HugePageGrowth = PageGranularGrowth<std::size_t{2} << 20>;
+
+/**
+ * @brief Growth policy that jumps straight to a caller supplied expected size.
+ *
+ * @details While the required size does not exceed the hint the first reallocation allocates exactly `Hint()`
+ * elements, afterwards growth is delegated to `Base`.
+ */
+template<IsGrowthPolicy Base = OneAndHalfGrowth>
+class HintedGrowth
+{
+ public:
+  constexpr HintedGrowth() noexcept = default;
+
+  explicit constexpr HintedGrowth(
+    std::size_t hint
+  ) noexcept
+    : hint_{hint}
+  { }
+
+  [[nodiscard]] constexpr auto Grow(
+    std::size_t capacity,  //
+    std::size_t required,
+    std::size_t element_size
+  ) const noexcept -> std::size_t
+  {
+    if (capacity < hint_ && required <= hint_)
+    {
+      return hint_;
+    }
+    return base_.Grow(capacity, required, element_size);
+  }
+
+  [[nodiscard]] constexpr auto Fit(
+    std::size_t required,  //
+    std::size_t element_size
+  ) const noexcept -> std::size_t
+  {
+    return base_.Fit(required, element_size);
+  }
+
+  [[nodiscard]] constexpr auto Hint() const noexcept -> std::size_t
+  {
+    return hint_;
+  }
+
+  constexpr auto SetHint(
+    std::size_t hint
+  ) noexcept -> void
+  {
+    hint_ = hint;
+  }
+
+ private:
+  std::size_t hint_{};
+  [[no_unique_address]] Base base_{};
+};
+
+/**
+ * @brief Tag type selecting default-initialization instead of value-initialization of new elements.
+ *
+ * @details Default-initialized trivial elements are left indeterminate, so no bytes are written to fresh storage.
+ */
+struct DefaultInit
+{
+  explicit DefaultInit() = default;
+};
+
+inline constexpr DefaultInit default_init{};
+
+namespace detail
+{
+
+/**
+ * @brief Uninitialized memory helpers shared by the contiguous containers.
+ * @internal
+ */
+template<IsValidVectorValueType T, IsValidVectorAllocatorType<T> Allocator>
+class VectorBase
+{
+ public:
+  using AllocatorType = Allocator;
+  using AllocatorTraits = std::allocator_traits<AllocatorType>;
+  using ValueType = T;
+  using Reference = ValueType&;
+  using ConstReference = const ValueType&;
+  using Pointer = AllocatorTraits::pointer;
+  using ConstPointer = AllocatorTraits::const_pointer;
+  using SizeType = AllocatorTraits::size_type;
+  using DifferenceType = AllocatorTraits::difference_type;
+
+  struct AllocationResult
+  {
+    Pointer pointer;
+    SizeType count;
+  };
+
+ protected:
+  static constexpr bool kUsesDefaultConstruct{
+    !requires(AllocatorType& allocator, Pointer pointer, ConstReference value) { allocator.construct(pointer, value); }
+  };
+
+  template<std::input_iterator InputIterator, std::sentinel_for<InputIterator> Sentinel = InputIterator>
+  static constexpr auto UninitializedCopyUsingAllocator(
+    InputIterator first_s,  //
+    Sentinel last_s,
+    Pointer first_d,
+    AllocatorType& allocator
+  ) -> void
+  {
+    if constexpr (std::contiguous_iterator<InputIterator> && std::sized_sentinel_for<Sentinel, InputIterator> &&
+                  std::same_as<std::remove_cvref_t<std::iter_reference_t<InputIterator>>, ValueType> &&
+                  std::is_trivially_copyable_v<ValueType> && kUsesDefaultConstruct)
+    {
+      if !consteval
+      {
+        if (first_s != last_s)
+        {
+          std::memcpy(
+            static_cast<void*>(std::to_address(first_d)),
+            static_cast<const void*>(std::to_address(first_s)),
+            static_cast<std::size_t>(last_s - first_s) * sizeof(ValueType)
+          );
+        }
+        return;
+      }
+    }
+
+    Pointer temp{first_d};
+    LAB_TRY_BEGIN
+    while (first_s != last_s)
+    {
+      AllocatorTraits::construct(allocator, first_d, *first_s);
+      ++first_s;
+      ++first_d;
+    }
+    LAB_TRY_END
+    LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
+    while (temp != first_d)
+    {
+      AllocatorTraits::destroy(allocator, temp);
+      ++temp;
+    }
+    LAB_PROPAGATE_EXCEPTION;
+    LAB_CATCH_END
+  }
+
+  template<std::input_iterator InputIterator>
+  static constexpr auto UninitializedMoveUsingAllocator(
+    InputIterator first_s,  //
+    InputIterator last_s,
+    Pointer first_d,
+    Allocator& allocator
+  ) -> void
+  {
+    Pointer temp{first_d};
+    LAB_TRY_BEGIN
+    while (first_s != last_s)
+    {
+      AllocatorTraits::construct(allocator, first_d, std::move(*first_s));
+      ++first_s;
+      ++first_d;
+    }
+    LAB_TRY_END
+    LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
+    while (temp != first_d)
+    {
+      AllocatorTraits::destroy(allocator, temp);
+      ++temp;
+    }
+    LAB_CATCH_END
+  }
+
+  template<std::input_iterator InputIterator, typename... Args>
+  static constexpr auto UninitializedConstructUsingAllocator(
+    InputIterator first,  //
+    InputIterator last,
+    AllocatorType& allocator,
+    Args&&... args
+  ) -> void
+  {
+    InputIterator temp{first};
+    LAB_TRY_BEGIN
+    while (first != last)
+    {
+      AllocatorTraits::construct(allocator, first, std::forward<Args>(args)...);
+      ++first;
+    }
+    LAB_TRY_END
+    LAB_CATCH_BEGIN([[maybe_unused]] const std::exception& /* error */)
+    while (temp != first)
+    {
+      AllocatorTraits::destroy(allocator, temp);
+      ++temp;
+    }
+    LAB_PROPAGATE_EXCEPTION;
+    LAB_CATCH_END
+  }
+
+  /**
+   * @brief Default-initializes [`first`, `last`), a no-op for trivially default constructible `T`.
+   *
+   * @details Allocators with a custom `construct` are honoured and value-initialize through it.
+   */
+  static constexpr auto UninitializedDefaultConstructUsingAllocator(
+    Pointer first,  //
+    Pointer last,
+    AllocatorType& allocator
+  ) -> void
+  {
+    if constexpr (kUsesDefaultConstruct)
+    {
+      if !consteval
+      {
+        std::uninitialized_default_construct(std::to_address(first), std::to_address(last));
+        return;
+      }
+    }
+    UninitializedConstructUsingAllocator(first, last, allocator);
+  }
+
+  static constexpr auto UninitializedRelocateUsingAllocator(
+    Pointer first_s,  //
+    Pointer last_s,
+    Pointer first_d,
+    AllocatorType& allocator
+  ) -> void
+  {
+    if constexpr (lab::kIsTriviallyRelocatable<ValueType>)
+    {
+      if !consteval
+      {
+        if (first_s != last_s)
+        {
+          std::memcpy(
+            static_cast<void*>(std::to_address(first_d)),
+            static_cast<const void*>(std::to_address(first_s)),
+            static_cast<std::size_t>(std::distance(first_s, last_s)) * sizeof(ValueType)
+          );
+        }
+        return;
+      }
+    }
+
+    if constexpr (std::is_nothrow_move_constructible_v<ValueType>)
+    {
+      UninitializedMoveUsingAllocator(first_s, last_s, first_d, allocator);
+    }
+    else
+    {
+      UninitializedCopyUsingAllocator(first_s, last_s, first_d, allocator);
+    }
+    DestroyUsingAllocator(first_s, last_s, allocator);
+  }
+
+  static constexpr auto AllocateAtLeastUsingAllocator(
+    SizeType n,  //
+    AllocatorType& allocator
+  ) -> AllocationResult
+  {
+#ifdef __cpp_lib_allocate_at_least
+    auto [pointer, count]{AllocatorTraits::allocate_at_least(allocator, n)};
+    return {pointer, static_cast<SizeType>(count)};
+#else
+    return {AllocatorTraits::allocate(allocator, n), n};
+#endif
+  }
+
+  static constexpr auto DestroyUsingAllocator(
+    Pointer first,  //
+    Pointer last,
+    AllocatorType& allocator
+  ) -> void
+  {
+    while (first != last)
+    {
+      AllocatorTraits::destroy(allocator, first);
+      ++first;
+    }
+  }
+};
+
+/**
+ * @brief Random access iterator over the elements of an indexed container
+ * @internal
+ * @class
+ *
+ * @tparam IsConst Boolean value for const iterator check
+ * @tparam Container Container class type for traversing, must befriend this iterator when its accessors are private
+ *
+ * @details Stores the container and a logical index, so it survives layouts without contiguous storage (segments,
+ * rings, columns, packed bits). Dereferencing calls `container.ReferenceAt(index)` if the container provides it
+ * (containers whose `operator[]` takes a key), `container[index]` otherwise. Proxy references get an `operator->`
+ * that keeps the proxy alive, plain references an `operator->` returning the element address.
+ */
+template<bool IsConst, typename Container>
+class IndexIterator final
+{
+  friend Container;
+  friend IndexIterator<!IsConst, Container>;
+  using ContainerPointer = std::conditional_t<IsConst, const Container*, Container*>;
+  using SizeType = Container::SizeType;
+
+ public:
+  using ValueType = Container::ValueType;
+  using value_type = Container::ValueType;
+  using Reference = std::conditional_t<IsConst, typename Container::ConstReference, typename Container::Reference>;
+  using reference = Reference;
+  using Pointer = std::conditional_t<std::is_lvalue_reference_v<Reference>, std::add_pointer_t<Reference>, void>;
+  using pointer = Pointer;
+  using DifferenceType = Container::DifferenceType;
+  using difference_type = Container::DifferenceType;
+  using IteratorCategory = std::random_access_iterator_tag;
+  using iterator_category = std::random_access_iterator_tag;
+
+  /**
+   * @brief Keeps a proxy reference alive for `operator->`.
+   */
+  struct ArrowProxy
+  {
+    Reference reference;
+
+    constexpr auto operator->() noexcept -> Reference*
+    {
+      return std::addressof(reference);
+    }
+  };
+
+  constexpr IndexIterator() noexcept = default;
+
+ private:
+  constexpr IndexIterator(
+    ContainerPointer container,  //
+    SizeType index
+  ) noexcept
+    : container_{container}
+    , index_{index}
+  { }
+
+ public:
+  constexpr IndexIterator(
+    const IndexIterator<!IsConst, Container> other
+  ) noexcept
+    requires(IsConst)
+    : container_{other.container_}
+    , index_{other.index_}
+  { }
+
+  constexpr auto operator*() const noexcept -> Reference
+  {
+    return At(index_);
+  }
+
+  constexpr auto operator->() const noexcept -> Pointer
+    requires(std::is_lvalue_reference_v<Reference>)
+  {
+    return std::addressof(At(index_));
+  }
+
+  constexpr auto operator->() const noexcept -> ArrowProxy
+    requires(std::is_class_v<Reference>)
+  {
+    return ArrowProxy{At(index_)};
+  }
+
+  constexpr auto operator[](
+    DifferenceType n
+  ) const noexcept -> Reference
+  {
+    return At(static_cast<SizeType>(static_cast<DifferenceType>(index_) + n));
+  }
+
+  constexpr auto operator++() noexcept -> IndexIterator&
+  {
+    ++index_;
+    return *this;
+  }
+
+  constexpr auto operator++(int) noexcept -> IndexIterator
+  {
+    auto temp{*this};
+    ++index_;
+    return temp;
+  }
+
+  constexpr auto operator--() noexcept -> IndexIterator&
+  {
+    --index_;
+    return *this;
+  }
+
+  constexpr auto operator--(int) noexcept -> IndexIterator
+  {
+    auto temp{*this};
+    --index_;
+    return temp;
+  }
+
+  constexpr auto operator+=(
+    DifferenceType n
+  ) noexcept -> IndexIterator&
+  {
+    index_ = static_cast<SizeType>(static_cast<DifferenceType>(index_) + n);
+    return *this;
+  }
+
+  constexpr auto operator-=(
+    DifferenceType n
+  ) noexcept -> IndexIterator&
+  {
+    return *this += -n;
+  }
+
+  [[nodiscard]] friend constexpr auto operator+(
+    IndexIterator iterator,  //
+    DifferenceType n
+  ) noexcept -> IndexIterator
+  {
+    return iterator += n;
+  }
+
+  [[nodiscard]] friend constexpr auto operator+(
+    DifferenceType n,  //
+    IndexIterator iterator
+  ) noexcept -> IndexIterator
+  {
+    return iterator += n;
+  }
+
+  [[nodiscard]] friend constexpr auto operator-(
+    IndexIterator iterator,  //
+    DifferenceType n
+  ) noexcept -> IndexIterator
+  {
+    return iterator -= n;
+  }
+
+  [[nodiscard]] friend constexpr auto operator-(
+    const IndexIterator lhs,  //
+    const IndexIterator rhs
+  ) noexcept -> DifferenceType
+  {
+    return static_cast<DifferenceType>(lhs.index_) - static_cast<DifferenceType>(rhs.index_);
+  }
+
+  [[nodiscard]] friend constexpr auto operator==(
+    const IndexIterator lhs,  //
+    const IndexIterator rhs
+  ) noexcept -> bool
+  {
+    return lhs.index_ == rhs.index_;
+  }
+
+  [[nodiscard]] friend constexpr auto operator<=>(
+    const IndexIterator lhs,  //
+    const IndexIterator rhs
+  ) noexcept -> std::strong_ordering
+  {
+    return lhs.index_ <=> rhs.index_;
+  }
+
+ private:
+  constexpr auto At(
+    SizeType index
+  ) const noexcept -> Reference
+  {
+    if constexpr (requires { container_->ReferenceAt(index); })
+    {
+      return container_->ReferenceAt(index);
+    }
+    else
+    {
+      return (*container_)[index];
+    }
+  }
+
+  ContainerPointer container_{nullptr};
+  SizeType index_{};
+};
+
+}  // namespace detail
+
+}  // namespace lab
+
+END_EXPORT_SECTION
@@ -0,0 +1,166 @@
+import lab_bit_vector;
+import lab_simd;
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <iterator>
+#include <memory_resource>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Restores the detected dispatch level after a test forced another one.
+ */
+struct LevelGuard {
+  ~LevelGuard() { lab::simd::SetLevel(lab::simd::DetectedLevel()); }
+};
+
+auto MakeRandom(
+  std::size_t size,  //
+  std::mt19937_64& engine
+) -> std::vector<bool> {
+  std::vector<bool> bits(size);
+  for (auto&& bit : bits) {
+    bit = engine() % 3 == 0;
+  }
+  return bits;
+}
+
+auto MakeBitVector(const std::vector<bool>& bits) -> lab::BitVector<> {
+  lab::BitVector<> vector;
+  for (const bool bit : bits) {
+    vector.PushBack(bit);
+  }
+  return vector;
+}
+
+}  // namespace
+
+static_assert(std::random_access_iterator<lab::BitVector<>::Iterator>);
+static_assert(std::random_access_iterator<lab::BitVector<>::ConstIterator>);
+static_assert(std::indirectly_writable<lab::BitVector<>::Iterator, bool>);
+
+TEST_CASE("BitVector element access and growth test") {
+  lab::BitVector<> bits{true, false, true};
+  REQUIRE(bits.Size() == 3);
+  REQUIRE(bits.Front());
+  REQUIRE_FALSE(bits[1]);
+  REQUIRE(bits.At(2));
+  REQUIRE_THROWS_AS(bits.At(3), std::out_of_range);
+
+  bits[1] = true;
+  bits.Back() = false;
+  bits.Flip(0);
+  REQUIRE(std::ranges::equal(bits, std::array{false, true, false}));
+  std::ranges::fill(bits, true);
+  REQUIRE(bits.Count() == 3);
+  swap(bits[0], bits[2]);
+  bits.Reset(2);
+  REQUIRE(std::ranges::equal(bits, std::array{true, true, false}));
+
+  // Words follow the same growth policy as `Vector`: one reallocation per policy step, not per bit.
+  lab::BitVector<> grown;
+  lab::Vector<lab::BitVector<>::WordType> words;
+  for (std::size_t i{}; i < 10'000; ++i) {
+    grown.PushBack(i % 5 == 0);
+    if (i % lab::BitVector<>::kWordBits == 0) {
+      words.PushBack(0);
+    }
+    REQUIRE(grown.Capacity() == words.Capacity() * lab::BitVector<>::kWordBits);
+  }
+  REQUIRE(grown.Count() == 2'000);
+  REQUIRE(grown.Words().size() == words.Size());
+  while (grown.Size() > 63) {
+    grown.PopBack();
+  }
+  REQUIRE(grown.Words().size() == 1);
+  REQUIRE(grown.Count() == 13);
+
+  grown.Resize(130, true);
+  REQUIRE(grown.Count() == 13 + 67);
+  grown.Resize(70);
+  REQUIRE(grown.Count() == 13 + 7);
+  grown.Flip();
+  REQUIRE(grown.Count() == 70 - 20);
+  REQUIRE(lab::BitVector<>(70, true).Count() == 70);
+  grown.Clear();
+  REQUIRE(grown.Empty());
+  REQUIRE(grown.FindFirst() == 0);
+}
+
+TEST_CASE("BitVector word kernels against std::vector<bool> test") {
+  const LevelGuard guard;
+  std::mt19937_64 engine{5};
+  for (const auto level : {lab::simd::Level::kScalar, lab::simd::Level::kSse2, lab::simd::Level::kAvx2,
+                           lab::simd::Level::kAvx512, lab::simd::Level::kNeon}) {
+    if (!lab::simd::SetLevel(level)) {
+      continue;
+    }
+    for (const std::size_t size : {0U, 1U, 63U, 64U, 65U, 300U, 1000U, 4099U}) {
+      const auto lhs_bits{MakeRandom(size, engine)};
+      const auto rhs_bits{MakeRandom(size, engine)};
+      auto lhs{MakeBitVector(lhs_bits)};
+      const auto rhs{MakeBitVector(rhs_bits)};
+      REQUIRE(lhs.Count() == static_cast<std::size_t>(std::ranges::count(lhs_bits, true)));
+
+      std::vector<std::size_t> expected;
+      for (std::size_t i{}; i < size; ++i) {
+        if (lhs_bits[i]) {
+          expected.push_back(i);
+        }
+      }
+      std::vector<std::size_t> found;
+      for (auto i{lhs.FindFirst()}; i != lhs.Size(); i = lhs.FindNext(i)) {
+        found.push_back(i);
+      }
+      REQUIRE(found == expected);
+
+      auto result{lhs};
+      REQUIRE(result == lhs);
+      result.And(rhs);
+      for (std::size_t i{}; i < size; ++i) {
+        REQUIRE(result[i] == (lhs_bits[i] && rhs_bits[i]));
+      }
+      result = lhs;
+      result |= rhs;
+      for (std::size_t i{}; i < size; ++i) {
+        REQUIRE(result[i] == (lhs_bits[i] || rhs_bits[i]));
+      }
+      result = lhs;
+      result.Xor(rhs).Xor(rhs);
+      REQUIRE(result == lhs);
+      result ^= result;
+      REQUIRE(result.Count() == 0);
+      REQUIRE(result.FindFirst() == size);
+    }
+  }
+}
+
+TEST_CASE("BitVector copy and move test") {
+  lab::BitVector<> bits(100, true);
+  auto copy{bits};
+  copy.Reset(99);
+  REQUIRE(copy != bits);
+  REQUIRE(copy.FindNext(98) == copy.Size());
+  auto moved{std::move(copy)};
+  REQUIRE(copy.Empty());
+  REQUIRE(moved.Count() == 99);
+  copy = bits;
+  copy.Swap(moved);
+  REQUIRE(moved == bits);
+  REQUIRE(copy.Count() == 99);
+
+  std::pmr::monotonic_buffer_resource resource;
+  const lab::pmr::BitVector<> pmr_bits(100, true, &resource);
+  REQUIRE(pmr_bits.GetAllocator().resource() == &resource);
+  REQUIRE(std::ranges::equal(pmr_bits, bits));
+  const lab::pmr::BitVector<> pmr_copy{pmr_bits, std::pmr::get_default_resource()};
+  REQUIRE(pmr_copy == pmr_bits);
+}
@@ -0,0 +1,134 @@
+import lab_concurrent_forward_stack;
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using IntStack = lab::containers::ConcurrentForwardStack<int>;
+
+struct ThrowOnCopy {
+  ThrowOnCopy(int value) : value_{value} { }
+
+  ThrowOnCopy(const ThrowOnCopy& other) : value_{other.value_} {
+    if (value_ < 0) {
+      throw std::runtime_error{"copy"};
+    }
+  }
+
+  ThrowOnCopy(ThrowOnCopy&&) noexcept = default;
+
+  int value_;
+};
+
+}  // namespace
+
+TEST_CASE("ConcurrentForwardStack single-threaded push and pop test") {
+  IntStack stack;
+  REQUIRE(stack.Empty());
+  REQUIRE(!stack.PopFront());
+  stack.PushFront(1);
+  stack.EmplaceFront(2);
+  REQUIRE(!stack.Empty());
+  REQUIRE(stack.PopFront() == 2);
+  REQUIRE(stack.PopFront() == 1);
+  REQUIRE(!stack.PopFront());
+
+  lab::containers::ConcurrentForwardStack<std::string> strings;
+  strings.PushFront(std::string(64, 'a'));
+  strings.EmplaceFront(64, 'b');
+  REQUIRE(strings.PopFront() == std::string(64, 'b'));
+  strings.PushFront("c");
+}
+
+TEST_CASE("ConcurrentForwardStack PushFrontRange and TakeAll test") {
+  IntStack stack;
+  stack.PushFrontRange(std::views::iota(0, 5));
+  stack.PushFrontRange(std::vector<int>{});
+  REQUIRE(stack.PopFront() == 4);
+
+  auto batch{stack.TakeAll()};
+  REQUIRE(stack.Empty());
+  REQUIRE(std::ranges::equal(batch, std::vector{3, 2, 1, 0}));
+  batch.Reverse();
+  REQUIRE(std::ranges::equal(batch, std::vector{0, 1, 2, 3}));
+  REQUIRE(batch.PopFront() == 0);
+  REQUIRE(std::ranges::equal(std::as_const(batch), std::vector{1, 2, 3}));
+
+  auto empty{stack.TakeAll()};
+  REQUIRE(empty.Empty());
+  empty = std::move(batch);
+  REQUIRE(batch.Empty());
+  REQUIRE(std::ranges::distance(empty) == 3);
+  empty.Clear();
+  REQUIRE(empty.Empty());
+
+  stack.PushFront(7);
+  REQUIRE(stack.PopFront() == 7);
+}
+
+TEST_CASE("ConcurrentForwardStack PushFrontRange strong guarantee test") {
+  lab::containers::ConcurrentForwardStack<ThrowOnCopy> stack;
+  stack.EmplaceFront(1);
+  std::vector<ThrowOnCopy> values;
+  for (const int value : {2, 3, -1, 4}) {
+    values.emplace_back(value);
+  }
+  REQUIRE_THROWS_AS(stack.PushFrontRange(std::as_const(values)), std::runtime_error);
+  auto batch{stack.TakeAll()};
+  REQUIRE(std::ranges::distance(batch) == 1);
+  REQUIRE(batch.begin()->value_ == 1);
+}
+
+TEST_CASE("ConcurrentForwardStack multi-producer multi-consumer test") {
+  constexpr int kThreads{4};
+  constexpr int kPerThread{20'000};
+  IntStack stack;
+  std::atomic<long long> popped_sum{0};
+  std::atomic<int> popped_count{0};
+
+  {
+    std::vector<std::jthread> threads;
+    for (int thread{}; thread < kThreads; ++thread) {
+      threads.emplace_back([&stack, thread] {
+        for (int i{}; i < kPerThread; i += 2) {
+          const int value{thread * kPerThread + i};
+          if (i % 64 == 0) {
+            stack.PushFrontRange(std::vector{value, value + 1});
+          } else {
+            stack.PushFront(value);
+            stack.PushFront(value + 1);
+          }
+        }
+      });
+      threads.emplace_back([&] {
+        while (popped_count.load() < kThreads * kPerThread) {
+          if (auto value{stack.PopFront()}) {
+            popped_sum += *value;
+            ++popped_count;
+          } else if (auto batch{stack.TakeAll()}; !batch.Empty()) {
+            for (const int value : batch) {
+              popped_sum += value;
+              ++popped_count;
+            }
+          }
+        }
+      });
+    }
+  }
+
+  constexpr long long kTotal{kThreads * kPerThread};
+  REQUIRE(popped_count.load() == kTotal);
+  REQUIRE(popped_sum.load() == kTotal * (kTotal - 1) / 2);
+  REQUIRE(stack.Empty());
+}
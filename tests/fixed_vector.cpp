@@ -0,0 +1,127 @@
+import lab_fixed_vector;
+import lab_vector;
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+/**
+ * @brief Squares up to `limit` built with a growing `lab::Vector`, whose size is not known up front.
+ */
+constexpr auto Squares(int limit) -> lab::Vector<int> {
+  lab::Vector<int> squares;
+  for (int i{}; i * i < limit; ++i) {
+    squares.PushBack(i * i);
+  }
+  return squares;
+}
+
+/**
+ * @brief Two-pass table embedding: the first pass sizes the `FixedVector`, the second one fills it.
+ */
+template<int kLimit>
+constexpr auto kSquares{[] {
+  const auto squares{Squares(kLimit)};
+  return lab::FixedVector<int, Squares(kLimit).Size()>{squares.begin(), squares.end()};
+}()};
+
+}  // namespace
+
+static_assert(std::is_trivially_copyable_v<lab::FixedVector<int, 8>>);
+static_assert(!std::is_trivially_copyable_v<lab::FixedVector<std::string, 8>>);
+static_assert(sizeof(lab::FixedVector<std::uint8_t, 7>) == 8);
+static_assert(lab::kIsTriviallyRelocatable<lab::FixedVector<int, 8>>);
+static_assert(std::contiguous_iterator<lab::FixedVector<int, 8>::Iterator>);
+
+TEST_CASE("FixedVector compile-time table test") {
+  STATIC_REQUIRE(kSquares<100>.Size() == 10);
+  STATIC_REQUIRE(kSquares<100>.Capacity() == 10);
+  STATIC_REQUIRE(kSquares<100>.Back() == 81);
+  STATIC_REQUIRE(std::ranges::is_sorted(kSquares<1'000>));
+
+  constexpr auto kTable{[] {
+    lab::FixedVector<int, 16> table(4, 7);
+    table.PushBack(1);
+    table.Erase(table.begin());
+    table.Resize(8);
+    auto copy{table};
+    copy.Swap(table);
+    table.PopBack();
+    return table;
+  }()};
+  STATIC_REQUIRE(kTable == lab::FixedVector<int, 16>{7, 7, 7, 1, 0, 0, 0});
+  STATIC_REQUIRE(kTable < lab::FixedVector<int, 16>{7, 8});
+
+  constexpr auto kLength{[] {
+    lab::FixedVector<std::string, 4> strings{"fixed", "vector"};
+    strings.PushBack("test");
+    auto copy{strings};
+    copy.Erase(copy.begin());
+    return copy.Size() + copy.Front().size();
+  }()};
+  STATIC_REQUIRE(kLength == 2 + 6);
+
+  // The embedded table is plain data, copying it to the stack is a memcpy.
+  auto copy{kSquares<100>};
+  copy[0] = -1;
+  REQUIRE(copy.Front() == -1);
+  REQUIRE(kSquares<100>.Front() == 0);
+  REQUIRE(std::ranges::equal(copy | std::views::drop(1), Squares(100) | std::views::drop(1)));
+}
+
+TEST_CASE("FixedVector capacity and modification test") {
+  lab::FixedVector<std::string, 4> strings{"a", "b"};
+  strings.EmplaceBack(3, 'c');
+  REQUIRE(strings.TryPushBack("d"));
+  REQUIRE(strings.Full());
+  REQUIRE_FALSE(strings.TryEmplaceBack("e"));
+  REQUIRE_THROWS_AS(strings.PushBack("e"), std::length_error);
+  REQUIRE_THROWS_AS(strings.At(4), std::out_of_range);
+  REQUIRE_THROWS_AS(strings.Resize(5), std::length_error);
+  REQUIRE(strings.Size() == 4);
+
+  const std::array<std::string, 2> extra{"x", "y"};
+  REQUIRE_THROWS_AS(strings.AppendRange(extra), std::length_error);
+  REQUIRE(strings.Size() == 4);
+  REQUIRE(*strings.Erase(strings.begin() + 1, strings.begin() + 3) == "d");
+  strings.AppendRange(extra);
+  REQUIRE(std::ranges::equal(strings, std::array<std::string, 4>{"a", "d", "x", "y"}));
+
+  auto copy{strings};
+  auto moved{std::move(copy)};
+  REQUIRE(moved == strings);
+  lab::FixedVector<std::string, 4> other{"z"};
+  other.Swap(moved);
+  REQUIRE(other == strings);
+  REQUIRE(moved == lab::FixedVector<std::string, 4>{"z"});
+  moved = other;
+  REQUIRE(moved == strings);
+  other.Resize(1);
+  moved = std::move(other);
+  REQUIRE(moved.Size() == 1);
+  moved.Clear();
+  REQUIRE(moved.Empty());
+
+  lab::FixedVector<std::unique_ptr<int>, 3> pointers;
+  pointers.EmplaceBack(std::make_unique<int>(1));
+  pointers.EmplaceBack(std::make_unique<int>(2));
+  auto stolen{std::move(pointers)};
+  REQUIRE(*stolen.Back() == 2);
+
+  // Vector of FixedVector relocates its elements with memcpy.
+  lab::Vector<lab::FixedVector<int, 3>> rows;
+  for (int i{}; i < 100; ++i) {
+    rows.PushBack({i, i + 1});
+  }
+  REQUIRE(rows[99] == lab::FixedVector<int, 3>{99, 100});
+}
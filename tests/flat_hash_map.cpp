@@ -0,0 +1,277 @@
+import lab_flat_hash_map;
+import lab_instrumentation;
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct StringHash {
+  using is_transparent = void;
+
+  auto operator()(std::string_view value) const noexcept -> std::size_t { return std::hash<std::string_view>{}(value); }
+};
+
+/**
+ * @brief Every key lands in the same group, so lookups go through H2 matches and probing.
+ */
+struct CollidingHash {
+  auto operator()(int value) const noexcept -> std::size_t { return static_cast<std::size_t>(value & 1); }
+};
+
+struct ThrowingCopy {
+  explicit ThrowingCopy(int value)
+    : value{value} { }
+
+  ThrowingCopy(const ThrowingCopy& other)
+    : value{other.value} {
+    if (value < 0) {
+      throw std::runtime_error{"copy"};
+    }
+  }
+
+  // NOLINTNEXTLINE(performance-noexcept-move-constructor) forces the copying rehash path
+  ThrowingCopy(ThrowingCopy&& other) noexcept(false)
+    : value{other.value} { }
+
+  auto operator=(const ThrowingCopy&) -> ThrowingCopy& = default;
+  ~ThrowingCopy() = default;
+
+  int value;
+};
+
+/**
+ * @brief Throws when hashing the key `*poison`, forces the rehash to hash every key up front.
+ */
+struct ThrowingHash {
+  auto operator()(int value) const -> std::size_t {
+    if (poison && value == *poison) {
+      throw std::runtime_error{"hash"};
+    }
+    return std::hash<int>{}(value);
+  }
+
+  const int* poison;
+};
+
+/**
+ * @brief Stateful allocator that propagates on copy assignment only, tagged to observe propagation.
+ */
+template<typename T>
+struct CopyPropagatingAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using is_always_equal = std::false_type;
+
+  explicit CopyPropagatingAllocator(int tag = 0) noexcept
+    : tag{tag} { }
+
+  template<typename U>
+  CopyPropagatingAllocator(const CopyPropagatingAllocator<U>& other) noexcept
+    : tag{other.tag} { }
+
+  auto allocate(std::size_t n) -> T* { return std::allocator<T>{}.allocate(n); }
+
+  auto deallocate(T* pointer, std::size_t n) noexcept -> void { std::allocator<T>{}.deallocate(pointer, n); }
+
+  template<typename U>
+  friend auto operator==(const CopyPropagatingAllocator& lhs, const CopyPropagatingAllocator<U>& rhs) noexcept
+    -> bool {
+    return lhs.tag == rhs.tag;
+  }
+
+  int tag;
+};
+
+}  // namespace
+
+static_assert(std::forward_iterator<lab::FlatHashMap<int, int>::Iterator>);
+static_assert(std::forward_iterator<lab::FlatHashMap<int, int>::ConstIterator>);
+
+TEST_CASE("FlatHashMap insert, lookup and erase test") {
+  lab::FlatHashMap<int, int> map;
+  REQUIRE(map.Empty());
+  REQUIRE(map.Find(1) == map.end());
+  REQUIRE(map.begin() == map.end());
+
+  for (int i{}; i < 1000; ++i) {
+    REQUIRE(map.Insert({i, i * i}).second);
+  }
+  REQUIRE(map.Size() == 1000);
+  REQUIRE(map.LoadFactor() <= lab::FlatHashMap<int, int>::MaxLoadFactor());
+  REQUIRE_FALSE(map.Insert({7, 0}).second);
+  REQUIRE(map.At(7) == 49);
+  REQUIRE_THROWS_AS(map.At(1000), std::out_of_range);
+  REQUIRE(map.Contains(999));
+  REQUIRE(map.Count(1000) == 0);
+
+  map[1000] = 1;
+  ++map[1001];
+  REQUIRE(map.At(1001) == 1);
+  REQUIRE_FALSE(map.TryEmplace(1000, 5).second);
+  REQUIRE(map.InsertOrAssign(1000, 5).first->second == 5);
+
+  std::size_t sum{};
+  for (const auto& [key, value] : std::as_const(map)) {
+    sum += static_cast<std::size_t>(key);
+  }
+  REQUIRE(sum == 1001 * 1002 / 2);
+
+  for (int i{}; i < 1000; i += 2) {
+    REQUIRE(map.Erase(i) == 1);
+  }
+  REQUIRE(map.Erase(0) == 0);
+  REQUIRE(map.Size() == 502);
+  for (auto it{map.begin()}; it != map.end();) {
+    it = it->first % 3 == 0 ? map.Erase(it) : std::next(it);
+  }
+  for (int i{}; i < 1002; ++i) {
+    const bool expected{(i >= 1000 || i % 2 == 1) && i % 3 != 0};
+    REQUIRE(map.Contains(i) == expected);
+  }
+
+  const auto capacity{map.Capacity()};
+  map.Clear();
+  REQUIRE(map.Empty());
+  REQUIRE(map.Capacity() == capacity);
+  map.Rehash(0);
+  REQUIRE(map.Capacity() == 0);
+}
+
+TEST_CASE("FlatHashMap randomized against std::unordered_map test") {
+  lab::FlatHashMap<int, std::string, CollidingHash> colliding;
+  lab::FlatHashMap<std::uint64_t, std::uint64_t> map;
+  std::unordered_map<std::uint64_t, std::uint64_t> reference;
+  std::mt19937_64 engine{7};
+  for (int step{}; step < 20'000; ++step) {
+    const std::uint64_t key{engine() % 512};
+    if (engine() % 3 == 0) {
+      REQUIRE(map.Erase(key) == reference.erase(key));
+    } else {
+      REQUIRE(map.InsertOrAssign(key, step).second == reference.insert_or_assign(key, step).second);
+    }
+    if (step % 64 == 0) {
+      colliding.TryEmplace(step % 40, std::to_string(step));
+      colliding.Erase(static_cast<int>(key % 40));
+    }
+  }
+  REQUIRE(map.Size() == reference.size());
+  for (const auto& [key, value] : reference) {
+    REQUIRE(map.At(key) == value);
+  }
+  for (const auto& [key, value] : colliding) {
+    REQUIRE(colliding.Find(key)->second == value);
+  }
+
+  auto copy{map};
+  REQUIRE(copy == map);
+  copy[100'000] = 1;
+  REQUIRE(copy != map);
+  auto moved{std::move(copy)};
+  REQUIRE(copy.Empty());
+  REQUIRE(moved.Size() == map.Size() + 1);
+  copy = moved;
+  REQUIRE(copy == moved);
+  copy.Swap(map);
+  REQUIRE(map.Contains(100'000));
+}
+
+TEST_CASE("FlatHashMap heterogeneous lookup and InsertRange test") {
+  lab::FlatHashMap<std::string, int, StringHash, std::equal_to<>> map;
+  const std::vector<std::pair<std::string, int>> values{
+    {"alpha", 1},
+    {"beta", 2},
+    {"gamma", 3},
+    {"alpha", 4},
+  };
+  map.InsertRange(values);
+  REQUIRE(map.Size() == 3);
+  REQUIRE(map.At("alpha") == 1);
+  REQUIRE(map.Find(std::string_view{"beta"})->second == 2);
+  REQUIRE(map.Contains("gamma"));
+  REQUIRE_FALSE(map.Contains("delta"));
+  REQUIRE(map.TryEmplace("delta", 4).second);
+  REQUIRE(map.Erase("alpha") == 1);
+  REQUIRE(map.Size() == 3);
+
+  std::vector<std::pair<std::string, int>> many;
+  for (int i{}; i < 10'000; ++i) {
+    many.emplace_back(std::to_string(i), i);
+  }
+  lab::ContainerStats stats;
+  using Allocator = lab::InstrumentedAllocator<std::allocator<std::pair<const std::string, int>>>;
+  lab::FlatHashMap<std::string, int, StringHash, std::equal_to<>, Allocator> bulk{Allocator{&stats}};
+  bulk.InsertRange(many);
+  // One control byte buffer and one slot buffer, no intermediate tables.
+  REQUIRE(stats.allocations == 2);
+  REQUIRE(bulk.Capacity() == 16'384);
+  REQUIRE(bulk.Size() == 10'000);
+  REQUIRE(bulk.At("9999") == 9999);
+
+  lab::FlatHashMap<int, int> reserved;
+  reserved.Reserve(1000);
+  const auto reserved_capacity{reserved.Capacity()};
+  for (int i{}; i < 1000; ++i) {
+    reserved.Emplace(i, i);
+  }
+  REQUIRE(reserved.Capacity() == reserved_capacity);
+
+  const lab::FlatHashMap<int, int> list{{1, 2}, {3, 4}};
+  REQUIRE(list.Size() == 2);
+  REQUIRE(list.At(3) == 4);
+}
+
+TEST_CASE("FlatHashMap rehash strong guarantee test") {
+  lab::FlatHashMap<int, ThrowingCopy> map;
+  for (int i{}; i < 14; ++i) {
+    map.TryEmplace(i, i == 5 ? -1 : i);
+  }
+  REQUIRE(map.Capacity() == 16);
+  REQUIRE_THROWS_AS(map.TryEmplace(14, 14), std::runtime_error);
+  REQUIRE(map.Size() == 14);
+  REQUIRE(map.Capacity() == 16);
+  REQUIRE(map.At(5).value == -1);
+  REQUIRE(map.At(13).value == 13);
+}
+
+TEST_CASE("FlatHashMap rehash with a throwing hasher test") {
+  int poison{-1};
+  lab::FlatHashMap<int, std::string, ThrowingHash> map{0, ThrowingHash{&poison}};
+  for (int i{}; i < 14; ++i) {
+    map.TryEmplace(i, std::string(32, static_cast<char>('a' + i)));
+  }
+  REQUIRE(map.Capacity() == 16);
+  poison = 5;
+  REQUIRE_THROWS_AS(map.TryEmplace(14, "o"), std::runtime_error);
+  REQUIRE(map.Size() == 14);
+  REQUIRE(map.Capacity() == 16);
+  poison = -1;
+  for (int i{}; i < 14; ++i) {
+    REQUIRE(map.At(i) == std::string(32, static_cast<char>('a' + i)));
+  }
+}
+
+TEST_CASE("FlatHashMap copy assignment propagates the allocator test") {
+  using Allocator = CopyPropagatingAllocator<std::pair<const int, std::string>>;
+  using Map = lab::FlatHashMap<int, std::string, std::hash<int>, std::equal_to<int>, Allocator>;
+  const Map source{{{1, "one"}, {2, "two"}}, 0, std::hash<int>{}, std::equal_to<int>{}, Allocator{1}};
+  Map target{{{3, "three"}}, 0, std::hash<int>{}, std::equal_to<int>{}, Allocator{2}};
+  target = source;
+  REQUIRE(target.GetAllocator() == source.GetAllocator());
+  REQUIRE(target == source);
+  target.TryEmplace(3, "three");
+  REQUIRE(target.Size() == 3);
+  REQUIRE(source.Size() == 2);
+}
@@ -0,0 +1,167 @@
+import lab_flat_map;
+import lab_vector;
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct ThrowingCopy {
+  explicit ThrowingCopy(int value)
+    : value{value} { }
+
+  ThrowingCopy(const ThrowingCopy& other)
+    : value{other.value} {
+    if (value < 0) {
+      throw std::runtime_error{"copy"};
+    }
+  }
+
+  // NOLINTNEXTLINE(performance-noexcept-move-constructor) forces the copying merge path
+  ThrowingCopy(ThrowingCopy&& other) noexcept(false)
+    : value{other.value} { }
+
+  auto operator=(const ThrowingCopy&) -> ThrowingCopy& = default;
+  ~ThrowingCopy() = default;
+
+  int value;
+};
+
+}  // namespace
+
+static_assert(lab::IsFlatContainer<lab::Vector<int>>);
+static_assert(std::random_access_iterator<lab::FlatSet<int>::Iterator>);
+#ifdef __cpp_lib_ranges_zip
+static_assert(std::random_access_iterator<lab::FlatMap<int, int>::Iterator>);
+static_assert(std::random_access_iterator<lab::FlatMap<int, int>::ConstIterator>);
+#endif
+
+TEST_CASE("Vector positional Emplace, Insert and Erase test") {
+  lab::Vector<std::string> strings{"b", "d"};
+  REQUIRE(*strings.Emplace(strings.begin(), 1, 'a') == "a");
+  REQUIRE(*strings.Insert(strings.begin() + 2, std::string{"c"}) == "c");
+  REQUIRE(*strings.Insert(strings.end(), strings.Front()) == "a");
+  REQUIRE(std::ranges::equal(strings, std::vector<std::string>{"a", "b", "c", "d", "a"}));
+
+  REQUIRE(*strings.Erase(strings.begin() + 1) == "c");
+  const auto tail{strings.Erase(strings.begin() + 2, strings.end())};
+  REQUIRE(tail == strings.end());
+  REQUIRE(std::ranges::equal(strings, std::vector<std::string>{"a", "c"}));
+
+  lab::Vector<int> numbers{1, 2, 3, 4, 5};
+  REQUIRE(*numbers.Erase(numbers.begin(), numbers.begin() + 2) == 3);
+  REQUIRE(numbers.Erase(numbers.begin(), numbers.begin()) == numbers.begin());
+  REQUIRE(*numbers.Emplace(numbers.begin() + 1, 7) == 7);
+  REQUIRE(std::ranges::equal(numbers, std::vector<int>{3, 7, 4, 5}));
+}
+
+TEST_CASE("FlatSet and FlatMap lookup and modification test") {
+  lab::FlatSet<int> set{5, 1, 3, 1};
+  REQUIRE(set.Size() == 3);
+  REQUIRE(std::ranges::is_sorted(set));
+  REQUIRE(set.Insert(2).second);
+  REQUIRE_FALSE(set.Insert(3).second);
+  REQUIRE(*set.LowerBound(4) == 5);
+  REQUIRE(set.LowerBound(6) == set.end());
+  REQUIRE(set.Erase(1) == 1);
+  REQUIRE(set.Erase(1) == 0);
+  REQUIRE(set == lab::FlatSet<int>{2, 3, 5});
+
+  lab::FlatMap<std::string, int, std::less<>> map{{"b", 2}, {"a", 1}, {"b", 3}};
+  REQUIRE(map.Size() == 2);
+  REQUIRE(map.At("b") == 2);
+  REQUIRE_THROWS_AS(map.At("c"), std::out_of_range);
+  REQUIRE(map.Find(std::string_view{"a"})->second == 1);
+  REQUIRE(map.Contains(std::string_view{"b"}));
+  REQUIRE_FALSE(map.TryEmplace("a", 5).second);
+  REQUIRE(map.InsertOrAssign("a", 5).first->second == 5);
+  map["c"] = 3;
+  ++map["d"];
+  REQUIRE(std::ranges::equal(map.Keys(), std::vector<std::string>{"a", "b", "c", "d"}));
+  REQUIRE(std::ranges::equal(map.Values(), std::vector<int>{5, 2, 3, 1}));
+
+  for (auto [key, value] : map) {
+    value *= 10;
+  }
+  REQUIRE(map.Erase(map.Find("b"))->first == "c");
+  REQUIRE(map.Erase("e") == 0);
+  REQUIRE(std::ranges::equal(map.Values(), std::vector<int>{50, 30, 10}));
+
+  lab::FlatMap<int, int> adopted{lab::Vector<int>{3, 1, 3}, lab::Vector<int>{30, 10, 31}};
+  REQUIRE(adopted.Size() == 2);
+  REQUIRE(adopted.At(3) == 30);
+  adopted.Clear();
+  REQUIRE(adopted.Empty());
+  REQUIRE(adopted.Find(3) == adopted.end());
+}
+
+TEST_CASE("FlatMap InsertRange merge test") {
+  std::mt19937 engine{11};
+  lab::FlatMap<int, int> map;
+  lab::FlatMap<int, int, std::less<int>, lab::Vector<int>, lab::Vector<int>, lab::FlatEytzingerLayout> eytzinger;
+  std::map<int, int> reference;
+  for (int batch{}; batch < 20; ++batch) {
+    std::vector<std::pair<int, int>> values;
+    for (int i{}; i < 100; ++i) {
+      values.emplace_back(static_cast<int>(engine() % 1000), batch * 100 + i);
+    }
+    map.InsertRange(values);
+    eytzinger.InsertRange(values);
+    for (const auto& [key, value] : values) {
+      reference.emplace(key, value);
+    }
+    // Old elements and the first of equivalent new ones win, like repeated `emplace`.
+    REQUIRE(map.Size() == reference.size());
+    REQUIRE(std::ranges::equal(map.Keys(), std::views::keys(reference)));
+    REQUIRE(std::ranges::equal(map.Values(), std::views::values(reference)));
+    REQUIRE(std::ranges::equal(map.Keys(), eytzinger.Keys()));
+    REQUIRE(std::ranges::equal(map.Values(), eytzinger.Values()));
+  }
+
+  for (int key{-1}; key <= 1001; ++key) {
+    const auto expected{reference.lower_bound(key)};
+    const auto index{std::distance(reference.begin(), expected)};
+    REQUIRE(std::distance(map.begin(), map.LowerBound(key)) == index);
+    REQUIRE(std::distance(eytzinger.begin(), eytzinger.LowerBound(key)) == index);
+    REQUIRE(eytzinger.Contains(key) == reference.contains(key));
+  }
+
+  REQUIRE(eytzinger.Erase(eytzinger.begin()->first) == 1);
+  REQUIRE(eytzinger.TryEmplace(-5, 0).second);
+  REQUIRE(eytzinger.begin()->first == -5);
+  REQUIRE(eytzinger.Find(reference.rbegin()->first) == std::prev(eytzinger.end()));
+
+  lab::FlatSet<std::string, std::less<>, lab::Vector<std::string>, lab::FlatEytzingerLayout> strings;
+  strings.InsertRange(std::vector<std::string>{"m", "c", "x", "c", "a"});
+  REQUIRE(std::ranges::equal(strings.Keys(), std::vector<std::string>{"a", "c", "m", "x"}));
+  REQUIRE(strings.Contains(std::string_view{"m"}));
+  REQUIRE(*strings.Find("x") == "x");
+  REQUIRE(strings.Find("b") == strings.end());
+}
+
+TEST_CASE("FlatMap InsertRange strong guarantee test") {
+  lab::FlatMap<int, ThrowingCopy> map;
+  map.TryEmplace(2, 2);
+  map.TryEmplace(4, 4);
+  std::vector<std::pair<int, ThrowingCopy>> values;
+  values.emplace_back(3, 3);
+  values.emplace_back(1, -1);
+  REQUIRE_THROWS_AS(map.InsertRange(values), std::runtime_error);
+  REQUIRE(std::ranges::equal(map.Keys(), std::vector<int>{2, 4}));
+  REQUIRE(map.At(4).value == 4);
+
+  values.back().second.value = 1;
+  map.InsertRange(values);
+  REQUIRE(std::ranges::equal(map.Keys(), std::vector<int>{1, 2, 3, 4}));
+}
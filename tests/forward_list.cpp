@@ -3,10 +3,14 @@ import lab_forward_list;
 #include <algorithm>
 #include <array>
 #include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <memory>
 #include <memory_resource>
 #include <ranges>
+#include <utility>
 
 constexpr auto kTestNumbers = {1, 2, 3, 4};
 
@@ -37,6 +41,13 @@ TEST_CASE("Move constructor test") {
   REQUIRE(list.GetAllocator() == moved_list.GetAllocator());
 }
 
+TEST_CASE("Count constructor test") {
+  const lab::containers::ForwardList<int> list(3);
+  REQUIRE(std::ranges::distance(list) == 3);
+  REQUIRE(std::ranges::all_of(list, [](int value) { return value == 0; }));
+  REQUIRE(lab::containers::ForwardList<int>(0).Empty());
+}
+
 TEST_CASE("Initializer list constructor test") {
   lab::containers::ForwardList<int> list{kTestNumbers};
   REQUIRE(!list.Empty());
@@ -152,3 +163,177 @@ TEST_CASE("Constexpr test") {
   }()};
   REQUIRE(front_value == 120);
 }
+
+TEST_CASE("Sort method test") {
+  lab::containers::ForwardList<int> list{5, 3, 9, 1, 3, 7, 2, 8, 6, 4, 0};
+  list.Sort();
+  REQUIRE(std::ranges::equal(list, std::initializer_list{0, 1, 2, 3, 3, 4, 5, 6, 7, 8, 9}));
+  list.Sort(std::greater<>{});
+  REQUIRE(std::ranges::equal(list, std::initializer_list{9, 8, 7, 6, 5, 4, 3, 3, 2, 1, 0}));
+  lab::containers::ForwardList<int> empty_list;
+  empty_list.Sort();
+  REQUIRE(empty_list.Empty());
+}
+
+TEST_CASE("Sort stability test") {
+  const std::array<std::pair<int, int>, 8> values{{{2, 0}, {1, 1}, {2, 2}, {0, 3}, {1, 4}, {2, 5}, {0, 6}, {1, 7}}};
+  lab::containers::ForwardList<std::pair<int, int>> list{values.begin(), values.end()};
+  list.Sort([](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  auto expected{values};
+  std::ranges::stable_sort(expected, {}, &std::pair<int, int>::first);
+  REQUIRE(std::ranges::equal(list, expected));
+}
+
+TEST_CASE("Sort keeps nodes test") {
+  lab::containers::ForwardList<int> list{3, 1, 2};
+  const auto* const one{&*std::ranges::find(list, 1)};
+  list.Sort();
+  REQUIRE(&list.Front() == one);
+}
+
+TEST_CASE("Merge method test") {
+  lab::containers::ForwardList<int> list{1, 3, 5, 7};
+  lab::containers::ForwardList<int> other{0, 2, 3, 8, 9};
+  list.Merge(other);
+  REQUIRE(other.Empty());
+  REQUIRE(std::ranges::equal(list, std::initializer_list{0, 1, 2, 3, 3, 5, 7, 8, 9}));
+  list.Merge(lab::containers::ForwardList<int>{4});
+  REQUIRE(std::ranges::equal(list, std::initializer_list{0, 1, 2, 3, 3, 4, 5, 7, 8, 9}));
+}
+
+TEST_CASE("SpliceAfter method test") {
+  lab::containers::ForwardList<int> list{1, 5};
+  lab::containers::ForwardList<int> other{2, 3, 4, 6};
+  list.SpliceAfter(list.cbegin(), other, other.cend(), std::ranges::find(other, 4));
+  REQUIRE(std::ranges::equal(list, std::initializer_list{1, 2, 3, 4, 5}));
+  REQUIRE(std::ranges::equal(other, std::initializer_list{6}));
+  list.SpliceAfter(list.cend(), other, other.cend());
+  REQUIRE(other.Empty());
+  REQUIRE(list.Front() == 6);
+  list.SpliceAfter(std::ranges::find(list, 5), lab::containers::ForwardList<int>{7, 8});
+  REQUIRE(std::ranges::equal(list, std::initializer_list{6, 1, 2, 3, 4, 5, 7, 8}));
+}
+
+TEST_CASE("Reverse method test") {
+  lab::containers::ForwardList<int> list{kTestNumbers};
+  list.Reverse();
+  REQUIRE(std::ranges::equal(list, std::initializer_list{4, 3, 2, 1}));
+}
+
+TEST_CASE("Unique method test") {
+  lab::containers::ForwardList<int> list{1, 1, 2, 2, 2, 3, 1, 1};
+  REQUIRE(list.Unique() == 4);
+  REQUIRE(std::ranges::equal(list, std::initializer_list{1, 2, 3, 1}));
+  REQUIRE(list.Unique([](int lhs, int rhs) { return lhs + 1 == rhs; }) == 1);
+  REQUIRE(std::ranges::equal(list, std::initializer_list{1, 3, 1}));
+}
+
+TEST_CASE("BeforeBegin method test") {
+  lab::containers::ForwardList<int> list{kTestNumbers};
+  REQUIRE(std::next(list.BeforeBegin()) == list.begin());
+  REQUIRE(std::next(list.CBeforeBegin()) == list.cbegin());
+  list.InsertAfter(list.BeforeBegin(), 0);
+  REQUIRE(std::ranges::equal(list, std::initializer_list{0, 1, 2, 3, 4}));
+  lab::containers::ForwardList<int> empty_list;
+  empty_list.InsertAfter(empty_list.CBeforeBegin(), 1);
+  REQUIRE(std::ranges::equal(empty_list, std::initializer_list{1}));
+}
+
+TEST_CASE("EraseAfter method test") {
+  lab::containers::ForwardList<int> list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto position{list.EraseAfter(list.BeforeBegin())};
+  REQUIRE(*position == 1);
+  position = list.EraseAfter(list.cbegin(), std::ranges::find(list, 5));
+  REQUIRE(*position == 5);
+  REQUIRE(std::ranges::equal(list, std::initializer_list{1, 5, 6, 7, 8, 9}));
+  position = list.EraseAfter(position, list.cend());
+  REQUIRE(position == list.end());
+  REQUIRE(std::ranges::equal(list, std::initializer_list{1, 5}));
+}
+
+TEST_CASE("Erase loop with EraseAfter test") {
+  lab::containers::ForwardList<int> list{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  for (auto previous{list.BeforeBegin()}; std::next(previous) != list.end();) {
+    if (*std::next(previous) % 2 == 0) {
+      list.EraseAfter(previous);
+    } else {
+      ++previous;
+    }
+  }
+  REQUIRE(std::ranges::equal(list, std::initializer_list{1, 3, 5, 7, 9}));
+}
+
+template<typename List>
+concept HasSize = requires(const List& list) { list.Size(); };
+
+TEST_CASE("Tracked size test") {
+  using TrackedForwardList = lab::containers::ForwardList<int, std::allocator<int>, lab::containers::TrackedSize>;
+  static_assert(!HasSize<lab::containers::ForwardList<int>>);
+  static_assert(HasSize<TrackedForwardList>);
+  TrackedForwardList list{kTestNumbers};
+  REQUIRE(list.Size() == 4);
+  list.PushFront(0);
+  list.InsertAfter(list.cbegin(), 10);
+  REQUIRE(list.Size() == 6);
+  list.EraseAfter(list.BeforeBegin());
+  list.Erase(list.cbegin());
+  REQUIRE(list.Size() == 4);
+  TrackedForwardList other{5, 6, 7};
+  list.SpliceAfter(list.cbegin(), other, other.cbegin(), std::next(other.cbegin(), 2));
+  REQUIRE(list.Size() == 6);
+  REQUIRE(other.Size() == 1);
+  list.Merge(other);
+  REQUIRE(list.Size() == 7);
+  REQUIRE(other.Size() == 0);
+  list.Sort();
+  REQUIRE(list.Unique() == 0);
+  TrackedForwardList moved{std::move(list)};
+  REQUIRE(moved.Size() == 7);
+  REQUIRE(list.Size() == 0);
+  list = moved;
+  REQUIRE(list.Size() == 7);
+  list.Clear();
+  REQUIRE(list.Size() == 0);
+}
+
+TEST_CASE("ForEachBatched method test") {
+  lab::containers::ForwardList<int> list{kTestNumbers};
+  for (std::size_t distance : {0, 1, 3, 100}) {
+    int sum{};
+    std::as_const(list).ForEachBatched([&sum](const int& value) { sum = sum * 10 + value; }, distance);
+    REQUIRE(sum == 1'234);
+  }
+  list.ForEachBatched([](int& value) { value *= 2; });
+  REQUIRE(std::ranges::equal(list, std::initializer_list{2, 4, 6, 8}));
+  lab::containers::ForwardList<int>{}.ForEachBatched([](int&) { FAIL(); });
+
+  constexpr auto kSum{[] {
+    lab::containers::ForwardList<int> constant_list{1, 2, 3};
+    int sum{};
+    constant_list.ForEachBatched([&sum](int value) { sum += value; });
+    return sum;
+  }()};
+  STATIC_REQUIRE(kSum == 6);
+}
+
+TEST_CASE("Compact method test") {
+  using TrackedForwardList = lab::containers::ForwardList<int, std::allocator<int>, lab::containers::TrackedSize>;
+  TrackedForwardList list{5, 3, 1, 4, 2};
+  list.Sort();
+  list.Compact();
+  REQUIRE(list.Size() == 5);
+  REQUIRE(std::ranges::equal(list, std::initializer_list{1, 2, 3, 4, 5}));
+
+  lab::containers::ForwardList<std::unique_ptr<int>> pointers;
+  pointers.PushFront(std::make_unique<int>(2));
+  pointers.PushFront(std::make_unique<int>(1));
+  pointers.Compact();
+  REQUIRE(*pointers.Front() == 1);
+  REQUIRE(*std::next(pointers.begin())->get() == 2);
+
+  std::pmr::monotonic_buffer_resource resource;
+  lab::pmr::ForwardList<int> pmr_list{{1, 2, 3}, &resource};
+  pmr_list.Compact();
+  REQUIRE(pmr_list.GetAllocator().resource() == &resource);
+  REQUIRE(std::ranges::equal(pmr_list, std::initializer_list{1, 2, 3}));
+}
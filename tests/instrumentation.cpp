@@ -0,0 +1,160 @@
+import lab_instrumentation;
+import lab_forward_list;
+import lab_list;
+import lab_node_pool;
+import lab_vector;
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <utility>
+
+static_assert(lab::IsContainerObserver<lab::NullObserver>);
+static_assert(lab::IsContainerObserver<lab::StatsObserver>);
+static_assert(sizeof(lab::Vector<int>) == 3 * sizeof(int*));
+static_assert(sizeof(lab::containers::ForwardList<int>) == sizeof(void*));
+
+TEST_CASE("InstrumentedAllocator counts Vector allocations test") {
+  lab::ContainerStats stats;
+  {
+    lab::Vector<int, lab::InstrumentedAllocator<std::allocator<int>>> vector{
+      lab::InstrumentedAllocator<std::allocator<int>>{&stats}
+    };
+    for (int i{}; i < 100; ++i) {
+      vector.PushBack(i);
+    }
+    REQUIRE(stats.allocations > 1);
+    REQUIRE(stats.deallocations == stats.allocations - 1);
+    REQUIRE(stats.LiveBytes() == vector.Capacity() * sizeof(int));
+    REQUIRE(stats.peak_bytes >= stats.LiveBytes());
+
+    const auto copy{vector};
+    REQUIRE(copy.GetAllocator().Stats() == &stats);
+    REQUIRE(stats.LiveBytes() == (vector.Capacity() + copy.Capacity()) * sizeof(int));
+  }
+  REQUIRE(stats.allocations == stats.deallocations);
+  REQUIRE(stats.LiveBytes() == 0);
+}
+
+TEST_CASE("StatsObserver records Vector reallocations test") {
+  lab::ContainerStats stats;
+  lab::Vector<std::string, std::allocator<std::string>, lab::OneAndHalfGrowth, lab::StatsObserver> vector;
+  vector.GetObserver() = lab::StatsObserver{&stats};
+  vector.PushBack("a");
+  REQUIRE(stats.reallocations == 0);
+  REQUIRE(stats.capacity == vector.Capacity());
+
+  std::size_t expected_relocations{};
+  std::size_t reallocations{};
+  for (int i{}; i < 200; ++i) {
+    if (vector.Size() == vector.Capacity()) {
+      expected_relocations += vector.Size();
+      ++reallocations;
+    }
+    vector.EmplaceBack(32, 'x');
+  }
+  REQUIRE(stats.reallocations == reallocations);
+  REQUIRE(stats.relocated_elements == expected_relocations);
+  REQUIRE(stats.relocated_bytes == expected_relocations * sizeof(std::string));
+  REQUIRE(stats.peak_capacity == vector.Capacity());
+
+  vector.Resize(10);
+  vector.ShrinkToFit();
+  REQUIRE(stats.peak_capacity > stats.capacity);
+
+  auto moved{std::move(vector)};
+  REQUIRE(moved.GetObserver().Stats() == &stats);
+  REQUIRE(vector.GetObserver().Stats() == nullptr);
+}
+
+TEST_CASE("StatsObserver tracks live nodes test") {
+  lab::ContainerStats stats;
+  lab::containers::ForwardList<int, std::allocator<int>, lab::containers::UntrackedSize, lab::StatsObserver> list;
+  list.GetObserver() = lab::StatsObserver{&stats};
+  for (int i{}; i < 10; ++i) {
+    list.PushFront(i);
+  }
+  REQUIRE(stats.capacity == 10);
+  list.PopFront();
+  REQUIRE(stats.capacity == 9);
+
+  const decltype(list) source{1, 2, 3};
+  list = source;
+  REQUIRE(stats.capacity == 3);
+  REQUIRE(stats.peak_capacity == 12);
+  list.Clear();
+  REQUIRE(stats.capacity == 0);
+
+  lab::containers::List<int, std::allocator<int>, lab::StatsObserver> doubly;
+  doubly.GetObserver() = lab::StatsObserver{&stats};
+  doubly.PushBack(1);
+  doubly.PushBack(2);
+  REQUIRE(stats.capacity == 2);
+  const decltype(doubly) unobserved{4, 5, 6, 7};
+  doubly = unobserved;
+  REQUIRE(stats.capacity == 4);
+  REQUIRE(unobserved.GetObserver().Stats() == nullptr);
+}
+
+TEST_CASE("InstrumentedAllocator counts node allocations test") {
+  lab::ContainerStats stats;
+  {
+    lab::containers::List<int, lab::InstrumentedAllocator<std::allocator<int>>> list{
+      lab::InstrumentedAllocator<std::allocator<int>>{&stats}
+    };
+    for (int i{}; i < 16; ++i) {
+      list.PushBack(i);
+    }
+    REQUIRE(stats.allocations == 16);
+    REQUIRE(stats.bytes_allocated > 16 * sizeof(int));
+    REQUIRE(std::ranges::equal(list, std::views::iota(0, 16)));
+  }
+  REQUIRE(stats.deallocations == 16);
+  REQUIRE(stats.LiveBytes() == 0);
+}
+
+TEST_CASE("StatsObserver bulk release keeps other containers counts test") {
+  using PooledList = lab::containers::
+    ForwardList<int, lab::NodePool<int, 16>, lab::containers::UntrackedSize, lab::StatsObserver>;
+  lab::ContainerStats stats;
+  PooledList first;
+  PooledList second;
+  first.GetObserver() = lab::StatsObserver{&stats};
+  second.GetObserver() = lab::StatsObserver{&stats};
+  for (int i{}; i < 10; ++i) {
+    first.PushFront(i);
+    second.PushFront(i);
+  }
+  second.PushFront(10);
+  REQUIRE(stats.capacity == 21);
+  first.Clear();
+  REQUIRE(first.GetAllocator().ChunkCount() == 0);
+  REQUIRE(stats.capacity == 11);
+  second.Clear();
+  REQUIRE(stats.capacity == 0);
+}
+
+#ifdef __cpp_lib_allocate_at_least
+TEST_CASE("InstrumentedAllocator forwards allocate_at_least test") {
+  struct SlackAllocator : std::allocator<int> {
+    using value_type = int;
+
+    auto allocate_at_least(std::size_t n) -> std::allocation_result<int*> {
+      return {std::allocator<int>::allocate(n + 8), n + 8};
+    }
+  };
+
+  lab::ContainerStats stats;
+  {
+    lab::Vector<int, lab::InstrumentedAllocator<SlackAllocator>> vector{
+      lab::InstrumentedAllocator<SlackAllocator>{&stats}
+    };
+    vector.PushBack(1);
+    REQUIRE(vector.Capacity() >= vector.Size() + 8);
+    REQUIRE(stats.bytes_allocated == vector.Capacity() * sizeof(int));
+  }
+  REQUIRE(stats.LiveBytes() == 0);
+}
+#endif
@@ -0,0 +1,116 @@
+import lab_intrusive_list;
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+
+namespace {
+
+struct Task {
+  int id{};
+  lab::containers::IntrusiveForwardListHook<Task> stack_hook;
+  lab::containers::IntrusiveListHook<Task> queue_hook;
+};
+
+using TaskStack = lab::containers::IntrusiveForwardList<Task, &Task::stack_hook>;
+using TaskQueue = lab::containers::IntrusiveList<Task, &Task::queue_hook>;
+
+auto MakeTasks() -> std::array<Task, 5> { return {{{.id = 0}, {.id = 1}, {.id = 2}, {.id = 3}, {.id = 4}}}; }
+
+}  // namespace
+
+static_assert(std::forward_iterator<TaskStack::Iterator>);
+static_assert(std::forward_iterator<TaskStack::ConstIterator>);
+static_assert(std::bidirectional_iterator<TaskQueue::Iterator>);
+static_assert(std::bidirectional_iterator<TaskQueue::ConstIterator>);
+
+TEST_CASE("IntrusiveForwardList push and pop test") {
+  auto tasks{MakeTasks()};
+  TaskStack stack;
+  REQUIRE(stack.Empty());
+  for (auto& task : tasks) {
+    stack.PushFront(task);
+  }
+  REQUIRE(std::ranges::equal(stack | std::views::transform(&Task::id), std::initializer_list{4, 3, 2, 1, 0}));
+  REQUIRE(&stack.PopFront() == &tasks[4]);
+  REQUIRE(tasks[4].stack_hook.next_ == nullptr);
+  REQUIRE(stack.Front().id == 3);
+}
+
+TEST_CASE("IntrusiveForwardList insert and erase test") {
+  auto tasks{MakeTasks()};
+  TaskStack stack;
+  auto position{stack.InsertAfter(stack.cend(), tasks[0])};
+  for (auto& task : tasks | std::views::drop(1)) {
+    position = stack.InsertAfter(position, task);
+  }
+  REQUIRE(std::ranges::equal(stack | std::views::transform(&Task::id), std::initializer_list{0, 1, 2, 3, 4}));
+  REQUIRE(stack.EraseAfter(stack.IteratorTo(tasks[1]))->id == 3);
+  REQUIRE(stack.Erase(tasks[4]) == stack.end());
+  REQUIRE(stack.Erase(tasks[0])->id == 1);
+  REQUIRE(std::ranges::equal(stack | std::views::transform(&Task::id), std::initializer_list{1, 3}));
+  stack.Clear();
+  REQUIRE(stack.Empty());
+  REQUIRE(tasks[1].stack_hook.next_ == nullptr);
+}
+
+TEST_CASE("IntrusiveList queue test") {
+  auto tasks{MakeTasks()};
+  TaskQueue queue;
+  for (auto& task : tasks) {
+    queue.PushBack(task);
+  }
+  REQUIRE(queue.Size() == 5);
+  REQUIRE(std::ranges::equal(queue | std::views::transform(&Task::id), std::initializer_list{0, 1, 2, 3, 4}));
+  REQUIRE(
+    std::ranges::equal(queue | std::views::reverse | std::views::transform(&Task::id), std::initializer_list{4, 3, 2, 1, 0})
+  );
+  REQUIRE(queue.PopFront().id == 0);
+  REQUIRE(queue.PopBack().id == 4);
+  REQUIRE(queue.Erase(tasks[2])->id == 3);
+  REQUIRE(queue.Size() == 2);
+  REQUIRE(std::ranges::equal(queue | std::views::transform(&Task::id), std::initializer_list{1, 3}));
+  REQUIRE(tasks[2].queue_hook.prev_ == nullptr);
+  REQUIRE(tasks[2].queue_hook.next_ == nullptr);
+  queue.Insert(queue.IteratorTo(tasks[3]), tasks[2]);
+  queue.PushFront(tasks[0]);
+  REQUIRE(std::ranges::equal(queue | std::views::transform(&Task::id), std::initializer_list{0, 1, 2, 3}));
+  REQUIRE(std::prev(queue.end())->id == 3);
+}
+
+TEST_CASE("Object in several lists test") {
+  auto tasks{MakeTasks()};
+  TaskStack stack;
+  TaskQueue queue;
+  for (auto& task : tasks) {
+    stack.PushFront(task);
+    queue.PushBack(task);
+  }
+  queue.Erase(tasks[2]);
+  REQUIRE(std::ranges::distance(stack) == 5);
+  REQUIRE(queue.Size() == 4);
+}
+
+TEST_CASE("IntrusiveList splice and move test") {
+  auto tasks{MakeTasks()};
+  TaskQueue queue;
+  TaskQueue other;
+  queue.PushBack(tasks[0]);
+  queue.PushBack(tasks[4]);
+  other.PushBack(tasks[1]);
+  other.PushBack(tasks[2]);
+  other.PushBack(tasks[3]);
+  queue.Splice(queue.IteratorTo(tasks[4]), other);
+  REQUIRE(other.Empty());
+  REQUIRE(queue.Size() == 5);
+  REQUIRE(std::ranges::equal(queue | std::views::transform(&Task::id), std::initializer_list{0, 1, 2, 3, 4}));
+  TaskQueue moved{std::move(queue)};
+  REQUIRE(queue.Empty());
+  REQUIRE(moved.Back().id == 4);
+  queue.Swap(moved);
+  REQUIRE(queue.Size() == 5);
+  REQUIRE(moved.Empty());
+}
@@ -0,0 +1,205 @@
+import lab_list;
+import lab_node_pool;
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <list>
+#include <ranges>
+#include <string>
+#include <utility>
+
+constexpr auto kTestNumbers = {1, 2, 3, 4};
+
+TEST_CASE("Default constructor test") {
+  lab::containers::List<int> list;
+  REQUIRE(list.Empty());
+  REQUIRE(list.Size() == 0);
+  REQUIRE(list.begin() == list.end());
+  static_assert(std::bidirectional_iterator<lab::containers::List<int>::Iterator>);
+  static_assert(std::bidirectional_iterator<lab::containers::List<int>::ConstIterator>);
+}
+
+TEST_CASE("Constructors test") {
+  lab::containers::List<int> list{kTestNumbers};
+  REQUIRE(list.Size() == 4);
+  REQUIRE(std::ranges::equal(kTestNumbers, list));
+  lab::containers::List<int> copied_list{list};
+  REQUIRE(std::ranges::equal(list, copied_list));
+  lab::containers::List<int> moved_list{std::move(list)};
+  REQUIRE(list.Empty());
+  REQUIRE(list.begin() == list.end());
+  REQUIRE(moved_list.Size() == 4);
+  REQUIRE(std::ranges::equal(kTestNumbers, moved_list));
+  REQUIRE(std::ranges::equal(std::initializer_list{4, 3, 2, 1}, moved_list | std::views::reverse));
+  lab::containers::List<std::string> default_list(3);
+  REQUIRE(default_list.Size() == 3);
+  REQUIRE(std::ranges::all_of(default_list, &std::string::empty));
+}
+
+TEST_CASE("Assignment operators test") {
+  lab::containers::List<int> list{kTestNumbers};
+  lab::containers::List<int> another_list{5};
+  another_list = list;
+  REQUIRE(std::ranges::equal(list, another_list));
+  lab::containers::List<int> moved_list;
+  moved_list = std::move(another_list);
+  REQUIRE(another_list.Empty());
+  REQUIRE(std::ranges::equal(kTestNumbers, moved_list));
+  REQUIRE(moved_list.Back() == 4);
+}
+
+TEST_CASE("Push and pop test") {
+  lab::containers::List<int> list;
+  list.PushBack(2);
+  list.PushFront(1);
+  list.EmplaceBack(3);
+  list.EmplaceFront(0);
+  REQUIRE(std::ranges::equal(list, std::initializer_list{0, 1, 2, 3}));
+  REQUIRE(list.Front() == 0);
+  REQUIRE(list.Back() == 3);
+  list.PopBack();
+  list.PopFront();
+  REQUIRE(std::ranges::equal(list, std::initializer_list{1, 2}));
+  REQUIRE(list.Size() == 2);
+}
+
+TEST_CASE("Insert and erase test") {
+  lab::containers::List<int> list{kTestNumbers};
+  auto position{list.Insert(std::ranges::find(list, 3), 10)};
+  REQUIRE(*position == 10);
+  REQUIRE(std::ranges::equal(list, std::initializer_list{1, 2, 10, 3, 4}));
+  position = list.Erase(position);
+  REQUIRE(*position == 3);
+  position = list.Erase(list.cbegin(), position);
+  REQUIRE(std::ranges::equal(list, std::initializer_list{3, 4}));
+  REQUIRE(list.Size() == 2);
+  list.Erase(std::prev(list.cend()));
+  REQUIRE(std::ranges::equal(list, std::initializer_list{3}));
+}
+
+TEST_CASE("ForwardList compatible interface test") {
+  lab::containers::List<int> list;
+  auto iter{list.CBeforeBegin()};
+  for (int value : kTestNumbers) {
+    iter = list.InsertAfter(iter, value);
+  }
+  REQUIRE(std::ranges::equal(kTestNumbers, list));
+  REQUIRE(std::next(list.BeforeBegin()) == list.begin());
+  REQUIRE(*list.EraseAfter(list.BeforeBegin()) == 2);
+  REQUIRE(list.EraseAfter(list.cbegin(), list.cend()) == list.end());
+  REQUIRE(std::ranges::equal(list, std::initializer_list{2}));
+}
+
+TEST_CASE("Splice test") {
+  lab::containers::List<int> list{1, 5};
+  lab::containers::List<int> other{2, 3, 4, 6};
+  list.Splice(std::ranges::find(list, 5), other, other.cbegin(), std::ranges::find(other, 6));
+  REQUIRE(std::ranges::equal(list, std::initializer_list{1, 2, 3, 4, 5}));
+  REQUIRE(list.Size() == 5);
+  REQUIRE(other.Size() == 1);
+  list.Splice(list.cbegin(), other, other.cbegin());
+  REQUIRE(other.Empty());
+  REQUIRE(list.Front() == 6);
+  list.Splice(list.cend(), lab::containers::List<int>{7, 8});
+  REQUIRE(std::ranges::equal(list, std::initializer_list{6, 1, 2, 3, 4, 5, 7, 8}));
+  REQUIRE(list.Size() == 8);
+  list.Splice(list.cend(), list, list.cbegin());
+  REQUIRE(std::ranges::equal(list, std::initializer_list{1, 2, 3, 4, 5, 7, 8, 6}));
+  REQUIRE(list.Size() == 8);
+}
+
+TEST_CASE("Sort and merge test") {
+  lab::containers::List<int> list{5, 3, 9, 1, 3, 7, 2, 8, 6, 4, 0};
+  list.Sort();
+  REQUIRE(std::ranges::equal(list, std::initializer_list{0, 1, 2, 3, 3, 4, 5, 6, 7, 8, 9}));
+  REQUIRE(std::ranges::equal(list | std::views::reverse, std::initializer_list{9, 8, 7, 6, 5, 4, 3, 3, 2, 1, 0}));
+  list.Sort(std::greater<>{});
+  REQUIRE(std::ranges::equal(list, std::initializer_list{9, 8, 7, 6, 5, 4, 3, 3, 2, 1, 0}));
+  list.Reverse();
+  lab::containers::List<int> other{-1, 4, 10};
+  list.Merge(other);
+  REQUIRE(other.Empty());
+  REQUIRE(list.Size() == 14);
+  REQUIRE(std::ranges::equal(list, std::initializer_list{-1, 0, 1, 2, 3, 3, 4, 4, 5, 6, 7, 8, 9, 10}));
+  REQUIRE(list.Unique() == 2);
+  REQUIRE(list.Size() == 12);
+  REQUIRE(std::ranges::equal(list | std::views::reverse, std::initializer_list{10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, -1}));
+}
+
+TEST_CASE("Sort stability test") {
+  const std::array<std::pair<int, int>, 8> values{{{2, 0}, {1, 1}, {2, 2}, {0, 3}, {1, 4}, {2, 5}, {0, 6}, {1, 7}}};
+  lab::containers::List<std::pair<int, int>> list{values.begin(), values.end()};
+  list.Sort([](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  auto expected{values};
+  std::ranges::stable_sort(expected, {}, &std::pair<int, int>::first);
+  REQUIRE(std::ranges::equal(list, expected));
+}
+
+TEST_CASE("Swap test") {
+  lab::containers::List<int> empty_list;
+  lab::containers::List<int> filled_list{kTestNumbers};
+  empty_list.Swap(filled_list);
+  REQUIRE(filled_list.Empty());
+  REQUIRE(filled_list.begin() == filled_list.end());
+  REQUIRE(std::ranges::equal(kTestNumbers, empty_list));
+  REQUIRE(empty_list.Size() == 4);
+}
+
+TEST_CASE("NodePool allocator test") {
+  lab::containers::List<int, lab::NodePool<int, 16>> list;
+  std::list<int> expected;
+  for (int i{}; i < 100; ++i) {
+    list.PushBack(i);
+    expected.push_back(i);
+  }
+  REQUIRE(list.GetAllocator().ChunkCount() == 7);
+  for (auto it{list.cbegin()}; it != list.cend();) {
+    if (*it % 3 == 0) {
+      it = list.Erase(it);
+    } else {
+      ++it;
+    }
+  }
+  std::erase_if(expected, [](int value) { return value % 3 == 0; });
+  REQUIRE(std::ranges::equal(expected, list));
+}
+
+TEST_CASE("NodePool copy assignment test") {
+  using PooledList = lab::containers::List<int, lab::NodePool<int, 16>>;
+  PooledList source;
+  for (int i{}; i < 100; ++i) {
+    source.PushBack(i);
+  }
+  PooledList empty_target;
+  empty_target = source;
+  PooledList filled_target{1, 2, 3};
+  filled_target = source;
+  source.Clear();
+  for (int i{}; i < 100; ++i) {
+    source.PushBack(-i);
+  }
+  REQUIRE(std::ranges::equal(empty_target, std::views::iota(0, 100)));
+  REQUIRE(std::ranges::equal(filled_target, std::views::iota(0, 100)));
+  empty_target.PushBack(100);
+  filled_target.PopFront();
+  REQUIRE(empty_target.Back() == 100);
+  REQUIRE(filled_target.Front() == 1);
+
+  const PooledList copy{filled_target};
+  REQUIRE(std::ranges::equal(copy, filled_target));
+  REQUIRE(copy.GetAllocator() != filled_target.GetAllocator());
+}
+
+TEST_CASE("Constexpr test") {
+  constexpr int back_value{[] consteval -> int {
+    lab::containers::List<int> list;
+    list.PushBack(120);
+    list.PushFront(1);
+    return list.Back() + static_cast<int>(list.Size());
+  }()};
+  REQUIRE(back_value == 122);
+}
@@ -0,0 +1,135 @@
+import lab_mapped_vector;
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Record {
+  std::uint64_t id;
+  double value;
+
+  friend auto operator==(const Record&, const Record&) -> bool = default;
+};
+
+/**
+ * @brief Unique file in the temporary directory, removed on destruction.
+ */
+class TemporaryFile {
+ public:
+  explicit TemporaryFile(const std::string& name)
+    : path_{std::filesystem::temp_directory_path() / ("lab-mapped-vector-" + name + ".bin")} {
+    std::filesystem::remove(path_);
+  }
+
+  TemporaryFile(const TemporaryFile&) = delete;
+  auto operator=(const TemporaryFile&) -> TemporaryFile& = delete;
+
+  ~TemporaryFile() { std::filesystem::remove(path_); }
+
+  [[nodiscard]] auto Path() const -> const std::filesystem::path& { return path_; }
+
+ private:
+  std::filesystem::path path_;
+};
+
+}  // namespace
+
+static_assert(std::contiguous_iterator<lab::MappedVector<Record>::Iterator>);
+static_assert(std::same_as<lab::MappedVector<const Record>::Iterator, const Record*>);
+
+TEST_CASE("MappedVector growth and reopening test") {
+  const TemporaryFile file{"growth"};
+  {
+    lab::MappedVector<Record> records{file.Path()};
+    REQUIRE(records.IsOpen());
+    REQUIRE(records.Empty());
+    REQUIRE(records.Data() == nullptr);
+    for (std::uint64_t i{}; i < 10'000; ++i) {
+      records.PushBack({i, static_cast<double>(i) / 2});
+    }
+    REQUIRE(records.Size() == 10'000);
+    // Capacities are whole pages, the file is as long as the mapping while it is open.
+    REQUIRE(records.Capacity() * sizeof(Record) % 4096 == 0);
+    REQUIRE(std::filesystem::file_size(file.Path()) == records.Capacity() * sizeof(Record));
+    REQUIRE(records.At(9'999).id == 9'999);
+    REQUIRE_THROWS_AS(records.At(10'000), std::out_of_range);
+
+    records.PopBack();
+    records.EmplaceBack(records.Front());
+    const auto capacity{records.Capacity()};
+    records.Flush();
+    // Flushing keeps the mapping, appending right after it does not remap.
+    REQUIRE(records.Capacity() == capacity);
+    REQUIRE(std::filesystem::file_size(file.Path()) == capacity * sizeof(Record));
+    const auto* const data{records.Data()};
+    records.PushBack({10'000, 0.0});
+    records.Flush();
+    REQUIRE(records.Data() == data);
+    records.PopBack();
+    records.ShrinkToFit();
+    REQUIRE(records.Capacity() == records.Size());
+    REQUIRE(std::filesystem::file_size(file.Path()) == 10'000 * sizeof(Record));
+    REQUIRE(records.Back() == Record{0, 0.0});
+  }
+  {
+    const lab::MappedVector<const Record> records{file.Path(), lab::AccessHint::kSequential};
+    REQUIRE(records.Size() == 10'000);
+    REQUIRE(records[1] == Record{1, 0.5});
+    REQUIRE(std::ranges::all_of(std::views::iota(std::size_t{}, std::size_t{9'999}), [&records](std::size_t i) {
+      return records[i].id == i;
+    }));
+  }
+  {
+    lab::MappedVector<Record> records{file.Path(), lab::AccessHint::kRandom};
+    records.Resize(20'000);
+    REQUIRE(records[19'999] == Record{});
+    records.Resize(3);
+    records.AppendRange(std::vector<Record>{{7, 7.0}, {8, 8.0}});
+    records.Advise(lab::AccessHint::kWillNeed);
+  }
+  // Closing truncates the file back to the records.
+  REQUIRE(std::filesystem::file_size(file.Path()) == 5 * sizeof(Record));
+  lab::MappedVector<const Record> records{file.Path()};
+  REQUIRE(std::ranges::equal(
+    records | std::views::transform(&Record::id),
+    std::vector<std::uint64_t>{0, 1, 2, 7, 8}
+  ));
+}
+
+TEST_CASE("MappedVector ownership and errors test") {
+  const TemporaryFile file{"errors"};
+  REQUIRE_THROWS_AS(lab::MappedVector<const Record>{file.Path()}, std::system_error);
+
+  std::ofstream{file.Path(), std::ios::binary} << "odd";
+  REQUIRE_THROWS_AS(lab::MappedVector<const Record>{file.Path()}, std::runtime_error);
+  std::filesystem::resize_file(file.Path(), 0);
+
+  lab::MappedVector<Record> records{file.Path()};
+  records.Reserve(10);
+  REQUIRE(records.Capacity() >= 10);
+  records.PushBack({1, 1.0});
+  auto moved{std::move(records)};
+  REQUIRE_FALSE(records.IsOpen());
+  REQUIRE(moved.Size() == 1);
+  lab::MappedVector<Record> other;
+  other.Swap(moved);
+  REQUIRE(other.Front().id == 1);
+  other.Clear();
+  other.ShrinkToFit();
+  REQUIRE(other.Data() == nullptr);
+  other.PushBack({2, 2.0});
+  other.Close();
+  REQUIRE_FALSE(other.IsOpen());
+  REQUIRE(std::filesystem::file_size(file.Path()) == sizeof(Record));
+}
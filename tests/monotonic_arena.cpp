@@ -0,0 +1,184 @@
+import lab_monotonic_arena;
+import lab_forward_list;
+import lab_list;
+import lab_vector;
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+/**
+ * @brief Stateful allocator that propagates on copy, move and swap, tagged to observe propagation.
+ */
+template<typename T>
+struct TaggedAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  explicit TaggedAllocator(int tag = 0) noexcept
+    : tag{tag} { }
+
+  template<typename U>
+  TaggedAllocator(const TaggedAllocator<U>& other) noexcept
+    : tag{other.tag} { }
+
+  auto allocate(std::size_t n) -> T* { return std::allocator<T>{}.allocate(n); }
+
+  auto deallocate(T* pointer, std::size_t n) noexcept -> void { std::allocator<T>{}.deallocate(pointer, n); }
+
+  template<typename U>
+  friend auto operator==(const TaggedAllocator& lhs, const TaggedAllocator<U>& rhs) noexcept -> bool {
+    return lhs.tag == rhs.tag;
+  }
+
+  int tag;
+};
+
+/**
+ * @brief Checks copy, move and swap of a container over `std::pmr::polymorphic_allocator`, which never propagates.
+ */
+template<template<typename> typename Container>
+auto CheckNonPropagatingResource() -> void {
+  lab::MonotonicArena first_arena;
+  lab::MonotonicArena second_arena;
+  const std::array<std::string, 3> kValues{std::string(40, 'a'), std::string(40, 'b'), std::string(40, 'c')};
+
+  Container<std::string> source{kValues.begin(), kValues.end(), &first_arena};
+  REQUIRE(source.GetAllocator().resource() == &first_arena);
+  REQUIRE(first_arena.BytesAllocated() > 0);
+
+  const Container<std::string> copy{source};
+  REQUIRE(copy.GetAllocator().resource() == std::pmr::get_default_resource());
+  REQUIRE(std::ranges::equal(copy, kValues));
+
+  Container<std::string> destination{&second_arena};
+  destination = source;
+  REQUIRE(destination.GetAllocator().resource() == &second_arena);
+  REQUIRE(std::ranges::equal(destination, kValues));
+
+  destination = std::move(source);
+  REQUIRE(destination.GetAllocator().resource() == &second_arena);
+  // Unequal resources move element-wise, `source` keeps its (moved-from) storage.
+  REQUIRE(!source.Empty());
+  REQUIRE(std::ranges::equal(destination, kValues));
+
+  Container<std::string> same_arena{&second_arena};
+  same_arena = std::move(destination);
+  REQUIRE(std::ranges::equal(same_arena, kValues));
+
+  Container<std::string> moved{std::move(same_arena), &first_arena};
+  REQUIRE(moved.GetAllocator().resource() == &first_arena);
+  REQUIRE(std::ranges::equal(moved, kValues));
+}
+
+/**
+ * @brief Checks that a propagating stateful allocator follows the elements on copy, move and swap.
+ */
+template<typename Container>
+auto CheckPropagatingAllocator() -> void {
+  const auto kValues = {1, 2, 3};
+  using Allocator = TaggedAllocator<int>;
+
+  const Container source{kValues.begin(), kValues.end(), Allocator{1}};
+  Container destination{Allocator{2}};
+  destination = source;
+  REQUIRE(destination.GetAllocator().tag == 1);
+  REQUIRE(std::ranges::equal(destination, kValues));
+
+  Container moved{Allocator{3}};
+  moved = std::move(destination);
+  REQUIRE(moved.GetAllocator().tag == 1);
+  REQUIRE(std::ranges::equal(moved, kValues));
+
+  Container other{Allocator{4}};
+  moved.Swap(other);
+  REQUIRE(moved.GetAllocator().tag == 4);
+  REQUIRE(other.GetAllocator().tag == 1);
+  REQUIRE(std::ranges::equal(other, kValues));
+}
+
+template<typename T>
+using PmrList = lab::pmr::List<T>;
+
+template<typename T>
+using PmrForwardList = lab::pmr::ForwardList<T>;
+
+template<typename T>
+using PmrVector = lab::pmr::Vector<T>;
+
+}  // namespace
+
+TEST_CASE("MonotonicArena bump allocation test") {
+  alignas(std::max_align_t) std::array<std::byte, 256> buffer{};
+  lab::MonotonicArena arena{buffer};
+  void* first{arena.allocate(24, 8)};
+  void* second{arena.allocate(8, 64)};
+  REQUIRE(first == buffer.data());
+  REQUIRE(reinterpret_cast<std::uintptr_t>(second) % 64 == 0);
+  REQUIRE(arena.BytesAllocated() == 32);
+
+  arena.deallocate(second, 8, 64);
+  REQUIRE(arena.BytesAllocated() == 24);
+  REQUIRE(arena.allocate(8, 64) == second);
+
+  void* large{arena.allocate(10'000, 16)};
+  REQUIRE((large < buffer.data() || large >= buffer.data() + buffer.size()));
+  REQUIRE(reinterpret_cast<std::uintptr_t>(large) % 16 == 0);
+
+  arena.Release();
+  REQUIRE(arena.BytesAllocated() == 0);
+  REQUIRE(arena.allocate(16, 8) == buffer.data());
+
+  lab::MonotonicArena other;
+  REQUIRE(arena.is_equal(arena));
+  REQUIRE(!arena.is_equal(other));
+  REQUIRE(arena.Upstream() == std::pmr::get_default_resource());
+}
+
+TEST_CASE("MonotonicArena backs pmr containers test") {
+  lab::MonotonicArena arena{std::size_t{1} << 10, std::pmr::null_memory_resource()};
+  REQUIRE_THROWS_AS(lab::pmr::Vector<int>(4, &arena), std::bad_alloc);
+
+  lab::MonotonicArena request_arena;
+  {
+    lab::pmr::Vector<int> vector{&request_arena};
+    lab::pmr::ForwardList<int> forward_list{&request_arena};
+    lab::pmr::List<int> list{&request_arena};
+    for (int i{}; i < 1'000; ++i) {
+      vector.PushBack(i);
+      forward_list.PushFront(i);
+      list.PushBack(i);
+    }
+    REQUIRE(std::ranges::equal(vector, std::views::iota(0, 1'000)));
+    REQUIRE(std::ranges::equal(forward_list, std::views::iota(0, 1'000) | std::views::reverse));
+    REQUIRE(std::ranges::equal(list, std::views::iota(0, 1'000)));
+    REQUIRE(request_arena.BytesAllocated() > 1'000 * sizeof(int));
+  }
+  request_arena.Release();
+  REQUIRE(request_arena.BytesAllocated() == 0);
+}
+
+TEST_CASE("Non-propagating pmr allocator test") {
+  CheckNonPropagatingResource<PmrVector>();
+  CheckNonPropagatingResource<PmrForwardList>();
+  CheckNonPropagatingResource<PmrList>();
+}
+
+TEST_CASE("Propagating stateful allocator test") {
+  CheckPropagatingAllocator<lab::Vector<int, TaggedAllocator<int>>>();
+  CheckPropagatingAllocator<lab::containers::ForwardList<int, TaggedAllocator<int>>>();
+  CheckPropagatingAllocator<lab::containers::List<int, TaggedAllocator<int>>>();
+}
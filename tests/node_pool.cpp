@@ -0,0 +1,176 @@
+import lab_forward_list;
+import lab_node_pool;
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <initializer_list>
+#include <ranges>
+#include <utility>
+
+namespace {
+
+using PooledForwardList = lab::containers::ForwardList<int, lab::NodePool<int, 16>>;
+
+struct Wide {
+  std::array<long, 4> values;
+};
+
+}  // namespace
+
+TEST_CASE("Allocate and deallocate test") {
+  lab::NodePool<int, 4> pool;
+  REQUIRE(pool.ChunkCount() == 0);
+  int* first{pool.allocate(1)};
+  int* second{pool.allocate(1)};
+  REQUIRE(first != second);
+  REQUIRE(pool.ChunkCount() == 1);
+  pool.deallocate(second, 1);
+  REQUIRE(pool.allocate(1) == second);
+  for (int i{}; i < 4; ++i) {
+    static_cast<void>(pool.allocate(1));
+  }
+  REQUIRE(pool.ChunkCount() == 2);
+  pool.Release();
+  REQUIRE(pool.ChunkCount() == 0);
+  static_cast<void>(first);
+}
+
+TEST_CASE("Array allocation fallback test") {
+  lab::NodePool<int> pool;
+  int* array{pool.allocate(8)};
+  std::ranges::fill(array, array + 8, 1);
+  pool.deallocate(array, 8);
+  REQUIRE(pool.ChunkCount() == 0);
+}
+
+TEST_CASE("Copies share the pool test") {
+  lab::NodePool<int> pool;
+  static_cast<void>(pool.allocate(1));
+  lab::NodePool<int> copy{pool};
+  REQUIRE(copy == pool);
+  REQUIRE(!pool.IsUnique());
+  REQUIRE(pool.select_on_container_copy_construction() != pool);
+}
+
+TEST_CASE("Copies and rebinds compare equal test") {
+  const lab::NodePool<int> first;
+  const lab::NodePool<int> second;
+  REQUIRE(first == first);
+  REQUIRE(first != second);
+  lab::NodePool<int> pool;
+  const lab::NodePool<int> early_copy{pool};
+  int* slot{pool.allocate(1)};
+  REQUIRE(early_copy == pool);
+  lab::NodePool<Wide> rebound{pool};
+  REQUIRE(rebound == pool);
+  lab::NodePool<int> round_trip{rebound};
+  REQUIRE(round_trip == pool);
+  // Every rebound allocator frees the nodes of the others.
+  round_trip.deallocate(slot, 1);
+  REQUIRE(pool.allocate(1) == slot);
+  // Nodes of another size get their own slab in the same pool.
+  Wide* other_slot{rebound.allocate(1)};
+  REQUIRE(pool.ChunkCount() == 2);
+  lab::NodePool<Wide>{pool}.deallocate(other_slot, 1);
+  REQUIRE(rebound.allocate(1) == other_slot);
+  const lab::NodePool<int> moved{std::move(round_trip)};
+  REQUIRE(moved == round_trip);
+  pool.deallocate(slot, 1);
+}
+
+TEST_CASE("ForwardList splice across lists sharing a NodePool test") {
+  const lab::NodePool<int, 16> pool;
+  PooledForwardList first{{1, 2, 3}, pool};
+  PooledForwardList second{{4, 5}, pool};
+  REQUIRE(first.GetAllocator() == second.GetAllocator());
+  first.SpliceAfter(first.CBeforeBegin(), second);
+  REQUIRE(second.Empty());
+  REQUIRE(std::ranges::equal(first, std::initializer_list<int>{4, 5, 1, 2, 3}));
+}
+
+TEST_CASE("ForwardList with NodePool allocator test") {
+  PooledForwardList list;
+  for (int i{}; i < 100; ++i) {
+    list.PushFront(i);
+  }
+  REQUIRE(std::ranges::equal(list, std::views::iota(0, 100) | std::views::reverse));
+  REQUIRE(list.GetAllocator().ChunkCount() == 7);
+  while (!list.Empty()) {
+    list.PopFront();
+  }
+  for (int i{}; i < 100; ++i) {
+    list.PushFront(i);
+  }
+  REQUIRE(list.GetAllocator().ChunkCount() == 7);
+  PooledForwardList copied_list{list};
+  REQUIRE(std::ranges::equal(list, copied_list));
+  REQUIRE(copied_list.GetAllocator() != list.GetAllocator());
+}
+
+TEST_CASE("ForwardList teardown releases whole chunks test") {
+  static_assert(lab::containers::CanReleaseAllNodes<lab::NodePool<int>>);
+  PooledForwardList list;
+  for (int i{}; i < 100; ++i) {
+    list.PushFront(i);
+  }
+  list.Clear();
+  REQUIRE(list.Empty());
+  REQUIRE(list.GetAllocator().ChunkCount() == 0);
+  list.PushFront(1);
+  REQUIRE(list.Front() == 1);
+}
+
+TEST_CASE("ForwardList teardown with shared pool test") {
+  PooledForwardList list;
+  for (int i{}; i < 100; ++i) {
+    list.PushFront(i);
+  }
+  const auto allocator{list.GetAllocator()};
+  list.Clear();
+  REQUIRE(list.Empty());
+  REQUIRE(allocator.ChunkCount() == 7);
+}
+
+TEST_CASE("ForwardList Compact with NodePool test") {
+  PooledForwardList list;
+  for (int i{}; i < 100; ++i) {
+    list.PushFront(i % 7);
+  }
+  list.Sort();
+  const auto old_allocator{list.GetAllocator()};
+  list.Compact();
+  REQUIRE(list.GetAllocator() != old_allocator);
+  REQUIRE(std::ranges::is_sorted(list));
+  REQUIRE(std::ranges::distance(list) == 100);
+  // A fresh pool holds the list in traversal order.
+  REQUIRE(list.GetAllocator().ChunkCount() == 7);
+  const auto stride{&*std::next(list.begin()) - &list.Front()};
+  REQUIRE(stride > 0);
+  auto node{list.begin()};
+  for (int i{}; i < 15; ++i, ++node) {
+    REQUIRE(&*std::next(node) - &*node == stride);
+  }
+}
+
+TEST_CASE("ForwardList copy assignment with NodePool test") {
+  PooledForwardList source;
+  for (int i{}; i < 100; ++i) {
+    source.PushFront(i);
+  }
+  PooledForwardList empty_target;
+  empty_target = source;
+  PooledForwardList filled_target{1, 2, 3};
+  filled_target = source;
+  // Reusing the freed slots of the source would overwrite the targets if they still pointed into them.
+  source.Clear();
+  for (int i{}; i < 100; ++i) {
+    source.PushFront(-i);
+  }
+  REQUIRE(std::ranges::equal(empty_target, std::views::iota(0, 100) | std::views::reverse));
+  REQUIRE(std::ranges::equal(filled_target, std::views::iota(0, 100) | std::views::reverse));
+  empty_target.PushFront(100);
+  filled_target.PopFront();
+  REQUIRE(empty_target.Front() == 100);
+  REQUIRE(filled_target.Front() == 98);
+}
@@ -0,0 +1,115 @@
+import lab_parallel;
+import lab_vector;
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kLargeSize{std::size_t{1} << 20};
+
+auto MakeIota(std::size_t size) -> lab::Vector<std::int64_t> {
+  lab::Vector<std::int64_t> vector(size);
+  std::iota(vector.begin(), vector.end(), std::int64_t{0});
+  return vector;
+}
+
+}  // namespace
+
+TEST_CASE("ThreadPool ParallelFor test") {
+  lab::ThreadPool pool{3};
+  REQUIRE(pool.Concurrency() == 4);
+  std::vector<std::atomic<int>> visits(1000);
+  pool.ParallelFor(visits.size(), [&](std::size_t i) { ++visits[i]; });
+  REQUIRE(std::ranges::all_of(visits, [](const auto& visit) { return visit.load() == 1; }));
+
+  std::atomic<int> nested{0};
+  pool.ParallelFor(8, [&](std::size_t) { pool.ParallelFor(8, [&](std::size_t) { ++nested; }); });
+  REQUIRE(nested.load() == 64);
+
+  REQUIRE_THROWS_AS(
+    pool.ParallelFor(
+      100,
+      [](std::size_t i) {
+        if (i == 42) {
+          throw std::runtime_error{"chunk"};
+        }
+      }
+    ),
+    std::runtime_error
+  );
+
+  lab::ThreadPool empty{0};
+  int calls{};
+  empty.ParallelFor(5, [&](std::size_t) { ++calls; });
+  REQUIRE(calls == 5);
+}
+
+TEST_CASE("ForEach, Fill and Transform test") {
+  auto vector{MakeIota(kLargeSize)};
+  lab::ForEach(lab::execution::kPar, vector, [](std::int64_t& value) { value *= 2; });
+  REQUIRE(vector[kLargeSize - 1] == static_cast<std::int64_t>(kLargeSize - 1) * 2);
+
+  lab::Vector<double> output(kLargeSize);
+  lab::Transform(lab::execution::kParUnseq, vector, output, [](std::int64_t value) { return value * 0.5; });
+  REQUIRE(std::ranges::equal(output, std::views::iota(std::size_t{0}, kLargeSize), {}, {}, [](std::size_t i) {
+    return static_cast<double>(i);
+  }));
+
+  lab::Fill(lab::execution::kPar, output, 3.0);
+  REQUIRE(std::ranges::all_of(output, [](double value) { return value == 3.0; }));
+  lab::Fill(lab::execution::kSeq, output, 1.0);
+  REQUIRE(std::ranges::all_of(output, [](double value) { return value == 1.0; }));
+}
+
+TEST_CASE("Copy and Reduce test") {
+  const auto vector{MakeIota(kLargeSize + 3)};
+  lab::Vector<std::int64_t> copy(vector.Size());
+  lab::Copy(lab::execution::kPar, vector, copy);
+  REQUIRE(std::ranges::equal(copy, vector));
+
+  const auto expected{static_cast<std::int64_t>((kLargeSize + 3) * (kLargeSize + 2) / 2)};
+  REQUIRE(lab::Reduce(lab::execution::kSeq, vector, std::int64_t{0}) == expected);
+  REQUIRE(lab::Reduce(lab::execution::kPar, vector, std::int64_t{0}) == expected);
+  REQUIRE(lab::Reduce(lab::execution::kParUnseq, vector, std::int64_t{0}) == expected);
+
+  lab::Vector<std::string> words(20'000);
+  lab::Fill(lab::execution::kPar, words, std::string{"ab"});
+  words[0] = "x";
+  const auto joined{lab::Reduce(lab::execution::kPar, words, std::string{">"})};
+  REQUIRE(joined.size() == 1 + 1 + 2 * (words.Size() - 1));
+  REQUIRE(joined.starts_with(">xab"));
+}
+
+TEST_CASE("Sort test") {
+  lab::Vector<std::int64_t> vector(kLargeSize);
+  std::mt19937_64 generator{42};
+  std::ranges::generate(vector, [&] { return static_cast<std::int64_t>(generator() % 1000); });
+  auto expected{vector};
+  std::ranges::sort(expected);
+  lab::Sort(lab::execution::kPar, vector);
+  REQUIRE(std::ranges::equal(vector, expected));
+  lab::Sort(lab::execution::kParUnseq, vector, std::ranges::greater{});
+  REQUIRE(std::ranges::is_sorted(vector, std::ranges::greater{}));
+}
+
+TEST_CASE("Vector parallel construction test") {
+  constexpr std::size_t kSize{lab::Vector<std::int64_t>::kParallelConstructionThreshold / sizeof(std::int64_t) + 5};
+  const lab::Vector<std::int64_t> zeroes(kSize);
+  REQUIRE(zeroes.Size() == kSize);
+  REQUIRE(std::ranges::all_of(zeroes, [](std::int64_t value) { return value == 0; }));
+
+  const auto vector{MakeIota(kSize)};
+  const lab::Vector<std::int64_t> copy{vector};
+  REQUIRE(std::ranges::equal(copy, vector));
+}
@@ -0,0 +1,201 @@
+import lab_ring_deque;
+import lab_instrumentation;
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace {
+
+struct ThrowingCopy {
+  explicit ThrowingCopy(int value)
+    : value{value} { }
+
+  ThrowingCopy(const ThrowingCopy& other)
+    : value{other.value} {
+    if (value < 0) {
+      throw std::runtime_error{"copy"};
+    }
+  }
+
+  // NOLINTNEXTLINE(performance-noexcept-move-constructor) forces the copying growth path
+  ThrowingCopy(ThrowingCopy&& other) noexcept(false)
+    : value{other.value} { }
+
+  auto operator=(const ThrowingCopy&) -> ThrowingCopy& = default;
+  ~ThrowingCopy() = default;
+
+  int value;
+};
+
+}  // namespace
+
+static_assert(std::random_access_iterator<lab::RingDeque<int>::Iterator>);
+static_assert(std::random_access_iterator<lab::RingDeque<int>::ConstIterator>);
+
+TEST_CASE("RingDeque both ends and wrap-around test") {
+  lab::RingDeque<int> deque;
+  REQUIRE(deque.Empty());
+  REQUIRE(deque.Capacity() == 0);
+  for (int i{}; i < 4; ++i) {
+    deque.PushBack(i);
+    deque.PushFront(-i - 1);
+  }
+  REQUIRE(deque.Capacity() == lab::RingDeque<int>::kMinCapacity);
+  REQUIRE(std::ranges::equal(deque, std::views::iota(-4, 4)));
+  REQUIRE(deque.Front() == -4);
+  REQUIRE(deque.Back() == 3);
+  REQUIRE(deque.At(4) == 0);
+  REQUIRE_THROWS_AS(deque.At(8), std::out_of_range);
+
+  // FIFO use keeps the buffer size while head and tail wrap around it.
+  for (int i{4}; i < 1000; ++i) {
+    deque.PopFront();
+    deque.PushBack(i);
+  }
+  REQUIRE(deque.Capacity() == lab::RingDeque<int>::kMinCapacity);
+  REQUIRE(std::ranges::equal(deque, std::views::iota(992, 1000)));
+  REQUIRE(std::ranges::equal(deque | std::views::reverse, std::views::iota(992, 1000) | std::views::reverse));
+
+  deque.PushBack(1000);
+  REQUIRE(deque.Capacity() == 16);
+  REQUIRE(std::ranges::equal(deque, std::views::iota(992, 1001)));
+  deque.PopBack();
+  REQUIRE(deque.Back() == 999);
+  deque.Reserve(100);
+  REQUIRE(deque.Capacity() == 128);
+  REQUIRE(std::ranges::equal(deque, std::views::iota(992, 1000)));
+  deque.Clear();
+  REQUIRE(deque.Empty());
+  REQUIRE(deque.Capacity() == 128);
+}
+
+TEST_CASE("RingDeque randomized against std::deque test") {
+  lab::RingDeque<std::string> deque;
+  std::deque<std::string> reference;
+  std::mt19937 engine{3};
+  for (int step{}; step < 20'000; ++step) {
+    const auto value{std::to_string(step) + std::string(16, 'x')};
+    switch (engine() % 5) {
+      case 0:
+        deque.PushFront(value);
+        reference.push_front(value);
+        break;
+      case 1:
+      case 2:
+        deque.EmplaceBack(value);
+        reference.push_back(value);
+        break;
+      case 3:
+        if (!reference.empty()) {
+          deque.PopFront();
+          reference.pop_front();
+        }
+        break;
+      default:
+        if (!reference.empty()) {
+          deque.PopBack();
+          reference.pop_back();
+        }
+        break;
+    }
+  }
+  REQUIRE(deque.Size() == reference.size());
+  REQUIRE(std::ranges::equal(deque, reference));
+
+  // Arguments that alias an element stay valid while the buffer grows.
+  while (deque.Size() != deque.Capacity()) {
+    deque.PushBack("fill");
+  }
+  deque.PushBack(deque.Front());
+  REQUIRE(deque.Back() == deque.Front());
+  deque.PushFront(deque.Back());
+  REQUIRE(deque.Front() == deque.Back());
+
+  auto copy{deque};
+  REQUIRE(copy == deque);
+  copy.PopFront();
+  REQUIRE(copy != deque);
+  auto moved{std::move(copy)};
+  REQUIRE(copy.Empty());
+  REQUIRE(moved.Size() == deque.Size() - 1);
+  copy = deque;
+  REQUIRE(copy == deque);
+  copy.Swap(moved);
+  REQUIRE(moved == deque);
+}
+
+TEST_CASE("RingDeque growth relocation test") {
+  lab::ContainerStats stats;
+  using Allocator = lab::InstrumentedAllocator<std::allocator<std::string>>;
+  lab::RingDeque<std::string, Allocator> strings{Allocator{&stats}};
+  for (int i{}; i < 1024; ++i) {
+    strings.PushFront(std::to_string(i));
+  }
+  // One buffer per doubling from kMinCapacity, no per-element allocations besides the strings themselves.
+  REQUIRE(stats.allocations == 8);
+  REQUIRE(strings.Front() == "1023");
+  REQUIRE(strings.Back() == "0");
+
+  lab::RingDeque<ThrowingCopy> deque;
+  for (int i{}; i < 8; ++i) {
+    deque.EmplaceBack(i == 5 ? -1 : i);
+  }
+  deque.PopFront();
+  deque.EmplaceBack(8);
+  REQUIRE(deque.Size() == deque.Capacity());
+  REQUIRE_THROWS_AS(deque.EmplaceFront(9), std::runtime_error);
+  REQUIRE(deque.Size() == 8);
+  REQUIRE(deque.Capacity() == 8);
+  REQUIRE(deque.Front().value == 1);
+  REQUIRE(deque.Back().value == 8);
+}
+
+TEST_CASE("SpscRingQueue producer/consumer test") {
+  lab::SpscRingQueue<std::string> small{3};
+  REQUIRE(small.Capacity() == 4);
+  REQUIRE(small.Empty());
+  REQUIRE_FALSE(small.TryPopFront());
+  for (int i{}; i < 4; ++i) {
+    REQUIRE(small.TryPushBack(std::to_string(i)));
+  }
+  REQUIRE_FALSE(small.TryEmplaceBack("full"));
+  REQUIRE(small.Size() == 4);
+  REQUIRE(small.TryPopFront() == "0");
+  REQUIRE(small.TryEmplaceBack(3, 'x'));
+  REQUIRE(small.TryPopFront() == "1");
+
+  constexpr int kCount{200'000};
+  lab::SpscRingQueue<std::unique_ptr<int>> queue{64};
+  std::jthread producer{[&queue] {
+    for (int i{}; i < kCount;) {
+      if (queue.TryEmplaceBack(std::make_unique<int>(i))) {
+        ++i;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }};
+  bool ordered{true};
+  for (int expected{}; expected < kCount;) {
+    if (auto value{queue.TryPopFront()}) {
+      ordered = ordered && **value == expected;
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  REQUIRE(ordered);
+  REQUIRE(queue.Empty());
+}
@@ -0,0 +1,134 @@
+import lab_segmented_vector;
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using SmallSegmentVector = lab::SegmentedVector<int, std::allocator<int>, 2>;
+
+}  // namespace
+
+static_assert(std::random_access_iterator<SmallSegmentVector::Iterator>);
+static_assert(std::random_access_iterator<SmallSegmentVector::ConstIterator>);
+
+TEST_CASE("SegmentedVector indexed access across segments test") {
+  SmallSegmentVector vector;
+  REQUIRE(vector.Empty());
+  REQUIRE(vector.Capacity() == 0);
+  for (int i{}; i < 100; ++i) {
+    REQUIRE(vector.PushBack(i) == i);
+  }
+  REQUIRE(vector.Size() == 100);
+  REQUIRE(vector.Capacity() == 126);
+  for (int i{}; i < 100; ++i) {
+    REQUIRE(vector[static_cast<std::size_t>(i)] == i);
+  }
+  REQUIRE(vector.Front() == 0);
+  REQUIRE(vector.Back() == 99);
+  REQUIRE(vector.At(42) == 42);
+  REQUIRE_THROWS_AS(vector.At(100), std::out_of_range);
+  REQUIRE(std::ranges::equal(vector, std::views::iota(0, 100)));
+  REQUIRE(std::ranges::equal(vector | std::views::reverse, std::views::iota(0, 100) | std::views::reverse));
+  REQUIRE(vector.end() - vector.begin() == 100);
+  REQUIRE(*(vector.cbegin() + 50) == 50);
+}
+
+TEST_CASE("SegmentedVector stable references test") {
+  lab::SegmentedVector<std::string> vector;
+  const std::string& first{vector.EmplaceBack(64, 'a')};
+  const std::string* const address{std::addressof(first)};
+  for (int i{}; i < 10'000; ++i) {
+    vector.PushBack(std::to_string(i));
+  }
+  REQUIRE(std::addressof(vector[0]) == address);
+  REQUIRE(first == std::string(64, 'a'));
+  REQUIRE(vector.Back() == "9999");
+}
+
+TEST_CASE("SegmentedVector copy, move and clear test") {
+  SmallSegmentVector vector{1, 2, 3, 4, 5, 6, 7};
+  SmallSegmentVector copy{vector};
+  REQUIRE(std::ranges::equal(copy, vector));
+  SmallSegmentVector moved{std::move(copy)};
+  REQUIRE(copy.Empty());
+  REQUIRE(std::ranges::equal(moved, vector));
+  copy = moved;
+  moved.Clear();
+  REQUIRE(moved.Empty());
+  REQUIRE(moved.Capacity() >= 7);
+  moved.PushBack(8);
+  moved.Swap(copy);
+  REQUIRE(std::ranges::equal(moved, vector));
+  REQUIRE(std::ranges::equal(copy, std::vector{8}));
+}
+
+TEST_CASE("SegmentedVector move assignment with unequal allocators test") {
+  using PmrVector = lab::SegmentedVector<std::string, std::pmr::polymorphic_allocator<std::string>, 2>;
+  std::pmr::monotonic_buffer_resource source_resource;
+  std::pmr::monotonic_buffer_resource target_resource;
+  PmrVector source{{"a", "b", "c", "d", "e"}, &source_resource};
+  PmrVector target{{"x"}, &target_resource};
+  const auto* const source_first{&source.Front()};
+
+  target = std::move(source);
+  REQUIRE(std::ranges::equal(target, std::vector<std::string>{"a", "b", "c", "d", "e"}));
+  REQUIRE(&target.Front() != source_first);
+  REQUIRE(target.GetAllocator().resource() == &target_resource);
+
+  // Equal allocators still steal the segments.
+  PmrVector other{{"y"}, &target_resource};
+  const auto* const target_first{&target.Front()};
+  other = std::move(target);
+  REQUIRE(&other.Front() == target_first);
+  REQUIRE(target.Empty());
+}
+
+TEST_CASE("SegmentedVector concurrent append and read test") {
+  constexpr int kWriters{4};
+  constexpr int kPerWriter{25'000};
+  lab::SegmentedVector<int, std::allocator<int>, 16> vector;
+  std::atomic<bool> done{false};
+  std::atomic<bool> consistent{true};
+
+  {
+    std::jthread reader{[&] {
+      while (!done.load()) {
+        const auto size{vector.Size()};
+        for (std::size_t i{}; i < size; i += 97) {
+          if (vector[i] < 0) {
+            consistent = false;
+          }
+        }
+      }
+    }};
+    std::vector<std::jthread> writers;
+    for (int writer{}; writer < kWriters; ++writer) {
+      writers.emplace_back([&vector, writer] {
+        for (int i{}; i < kPerWriter; ++i) {
+          vector.EmplaceBack(writer * kPerWriter + i);
+        }
+      });
+    }
+    writers.clear();
+    done = true;
+  }
+
+  REQUIRE(consistent.load());
+  REQUIRE(vector.Size() == kWriters * kPerWriter);
+  std::vector<int> values(vector.begin(), vector.end());
+  std::ranges::sort(values);
+  REQUIRE(std::ranges::equal(values, std::views::iota(0, kWriters * kPerWriter)));
+}
@@ -0,0 +1,162 @@
+import lab_forward_list;
+import lab_serialize;
+import lab_vector;
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace {
+
+struct Sample {
+  std::int32_t channel;
+  float value;
+
+  friend auto operator==(const Sample&, const Sample&) -> bool = default;
+};
+
+struct Bytes {
+  std::array<char, sizeof(int)> bytes;
+};
+
+/**
+ * @brief Read-write descriptor of a fresh file in the temporary directory, removed on destruction.
+ */
+class TemporaryFile {
+ public:
+  explicit TemporaryFile(const std::string& name)
+    : path_{std::filesystem::temp_directory_path() / ("lab-serialize-" + name + ".bin")},
+      fd_{::open(path_.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644)} {
+    REQUIRE(fd_ >= 0);
+  }
+
+  TemporaryFile(const TemporaryFile&) = delete;
+  auto operator=(const TemporaryFile&) -> TemporaryFile& = delete;
+
+  ~TemporaryFile() {
+    ::close(fd_);
+    std::filesystem::remove(path_);
+  }
+
+  [[nodiscard]] auto Fd() const -> int { return fd_; }
+
+  [[nodiscard]] auto Size() const -> std::uintmax_t { return std::filesystem::file_size(path_); }
+
+  auto Rewind() const -> void { REQUIRE(::lseek(fd_, 0, SEEK_SET) == 0); }
+
+ private:
+  std::filesystem::path path_;
+  int fd_;
+};
+
+}  // namespace
+
+TEST_CASE("Serialize Vector round trip test") {
+  const TemporaryFile file{"vector"};
+  lab::Vector<Sample> samples;
+  for (std::int32_t i{}; i < 100'000; ++i) {
+    samples.PushBack({i % 8, static_cast<float>(i)});
+  }
+  lab::WriteVector(file.Fd(), samples);
+  lab::WriteVector(file.Fd(), lab::Vector<Sample>{});
+  REQUIRE(file.Size() == 2 * sizeof(lab::SerializedHeader) + samples.Size() * sizeof(Sample));
+
+  file.Rewind();
+  REQUIRE(std::ranges::equal(lab::ReadVector<Sample>(file.Fd()), samples));
+  REQUIRE(lab::ReadVector<Sample>(file.Fd()).Empty());
+
+  // Streaming appends chunk by chunk after the existing elements.
+  file.Rewind();
+  lab::VectorReader<Sample> reader{file.Fd()};
+  REQUIRE(reader.Header().size == samples.Size());
+  lab::Vector<Sample> streamed{{-1, -1.0F}};
+  REQUIRE(reader.ReadChunk(streamed, 1'000) == 1'000);
+  REQUIRE(reader.Remaining() == 99'000);
+  reader.ReadAll(streamed, 4'096);
+  REQUIRE(reader.Done());
+  REQUIRE(reader.ReadChunk(streamed) == 0);
+  REQUIRE(streamed.Size() == samples.Size() + 1);
+  REQUIRE(std::ranges::equal(streamed | std::views::drop(1), samples));
+}
+
+TEST_CASE("Serialize ForwardList round trip test") {
+  const TemporaryFile file{"forward-list"};
+  lab::containers::ForwardList<std::int64_t> untracked;
+  lab::Vector<std::int64_t> expected(20'000);
+  std::iota(expected.begin(), expected.end(), std::int64_t{-100});
+  for (auto value : expected | std::views::reverse) {
+    untracked.PushFront(value);
+  }
+  lab::containers::ForwardList<std::int64_t, std::allocator<std::int64_t>, lab::containers::TrackedSize> tracked{
+    expected.begin(),
+    expected.begin() + 1'023
+  };
+  lab::WriteForwardList(file.Fd(), untracked);
+  lab::WriteForwardList(file.Fd(), tracked);
+  lab::WriteForwardList(file.Fd(), lab::containers::ForwardList<std::int64_t>{});
+
+  file.Rewind();
+  REQUIRE(std::ranges::equal(lab::ReadVector<std::int64_t>(file.Fd()), expected));
+  const auto prefix{lab::ReadVector<std::int64_t>(file.Fd(), 100)};
+  REQUIRE(std::ranges::equal(prefix, expected | std::views::take(1'023)));
+  REQUIRE(lab::ReadVector<std::int64_t>(file.Fd()).Empty());
+
+  // Large values are written straight from the nodes, one iovec each.
+  using Block = std::array<std::int64_t, 40>;
+  lab::containers::ForwardList<Block> blocks;
+  for (std::int64_t i{}; i < 2'000; ++i) {
+    blocks.PushFront(Block{i, -i});
+  }
+  const auto position{::lseek(file.Fd(), 0, SEEK_CUR)};
+  lab::WriteForwardList(file.Fd(), blocks);
+  REQUIRE(::lseek(file.Fd(), position, SEEK_SET) == position);
+  const auto read_blocks{lab::ReadVector<Block>(file.Fd())};
+  REQUIRE(std::ranges::equal(read_blocks, blocks));
+  REQUIRE(read_blocks.Front() == Block{1'999, -1'999});
+}
+
+TEST_CASE("Serialize validation test") {
+  const TemporaryFile file{"validation"};
+  REQUIRE_THROWS_AS(lab::VectorReader<int>{file.Fd()}, std::runtime_error);
+  REQUIRE_THROWS_AS(lab::WriteVector(-1, lab::Vector<int>{1}), std::system_error);
+
+  lab::WriteVector(file.Fd(), lab::Vector<int>{1, 2, 3});
+  file.Rewind();
+  REQUIRE_THROWS_AS(lab::VectorReader<double>{file.Fd()}, std::runtime_error);
+  // Alignment is recorded too: same size, different layout.
+  file.Rewind();
+  REQUIRE_THROWS_AS(lab::VectorReader<Bytes>{file.Fd()}, std::runtime_error);
+
+  auto swapped{lab::SerializedHeader::For<int>(0)};
+  swapped.byte_order = 0xFFFE;
+  REQUIRE_THROWS_AS(swapped.Validate<int>(), std::runtime_error);
+  // Every field of a header from the other byte order is swapped, the magic too.
+  auto foreign{lab::SerializedHeader::For<int>(3)};
+  foreign.magic = std::byteswap(foreign.magic);
+  foreign.version = std::byteswap(foreign.version);
+  foreign.byte_order = std::byteswap(foreign.byte_order);
+  foreign.element_size = std::byteswap(foreign.element_size);
+  foreign.element_alignment = std::byteswap(foreign.element_alignment);
+  foreign.size = std::byteswap(foreign.size);
+  REQUIRE_THROWS_WITH(foreign.Validate<int>(), "SerializedHeader::Validate: written with a different byte order");
+  REQUIRE_THROWS_AS(lab::SerializedHeader{.magic = 0}.Validate<int>(), std::runtime_error);
+
+  // Truncated payload: the complete elements are kept, then the error surfaces.
+  REQUIRE(::ftruncate(file.Fd(), static_cast<::off_t>(sizeof(lab::SerializedHeader) + 2 * sizeof(int) + 1)) == 0);
+  file.Rewind();
+  lab::VectorReader<int> reader{file.Fd()};
+  lab::Vector<int> partial;
+  REQUIRE_THROWS_AS(reader.ReadAll(partial), std::runtime_error);
+  REQUIRE(std::ranges::equal(partial, std::array{1, 2}));
+}
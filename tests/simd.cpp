@@ -0,0 +1,117 @@
+import lab_simd;
+import lab_vector;
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <ranges>
+#include <vector>
+
+namespace {
+
+constexpr std::array kLevels{
+  lab::simd::Level::kScalar,
+  lab::simd::Level::kSse2,
+  lab::simd::Level::kAvx2,
+  lab::simd::Level::kAvx512,
+  lab::simd::Level::kNeon,
+};
+
+/**
+ * @brief Restores the detected dispatch level after a test forced another one.
+ */
+struct LevelGuard {
+  ~LevelGuard() { lab::simd::SetLevel(lab::simd::DetectedLevel()); }
+};
+
+template<typename T>
+auto MakeRandom(std::size_t size, std::mt19937_64& generator) -> lab::Vector<T> {
+  lab::Vector<T> vector(size);
+  for (auto& value : vector) {
+    value = static_cast<T>(generator() % 7);
+  }
+  return vector;
+}
+
+template<typename T>
+auto CheckMatchesStdRanges() -> void {
+  const LevelGuard guard;
+  std::mt19937_64 generator{42};
+  for (const auto level : kLevels) {
+    if (!lab::simd::SetLevel(level)) {
+      continue;
+    }
+    for (const std::size_t size : {1U, 3U, 15U, 16U, 17U, 63U, 64U, 65U, 200U, 1000U}) {
+      const auto vector{MakeRandom<T>(size, generator)};
+      auto other{vector};
+      for (T value{}; value < T{8}; ++value) {
+        REQUIRE(lab::Find(vector, value) == std::ranges::find(vector, value));
+        REQUIRE(lab::Count(vector, value) == static_cast<std::size_t>(std::ranges::count(vector, value)));
+        REQUIRE(lab::Contains(vector, value) == (std::ranges::find(vector, value) != vector.end()));
+      }
+      const auto [min, max]{lab::MinMax(vector)};
+      const auto expected{std::ranges::minmax(vector)};
+      REQUIRE(min == expected.min);
+      REQUIRE(max == expected.max);
+
+      REQUIRE(lab::Equal(vector, other));
+      other[size - 1] = T{9};
+      REQUIRE(!lab::Equal(vector, other));
+      REQUIRE(!lab::Equal(vector, std::vector<T>(size + 1)));
+    }
+  }
+}
+
+}  // namespace
+
+TEST_CASE("SIMD level detection test") {
+  REQUIRE(lab::simd::IsSupported(lab::simd::Level::kScalar));
+  REQUIRE(lab::simd::IsSupported(lab::simd::DetectedLevel()));
+  REQUIRE(lab::simd::ActiveLevel() == lab::simd::DetectedLevel());
+  const LevelGuard guard;
+  REQUIRE(lab::simd::SetLevel(lab::simd::Level::kScalar));
+  REQUIRE(lab::simd::ActiveLevel() == lab::simd::Level::kScalar);
+}
+
+TEST_CASE("SIMD algorithms match std::ranges test") {
+  CheckMatchesStdRanges<std::int8_t>();
+  CheckMatchesStdRanges<std::uint8_t>();
+  CheckMatchesStdRanges<std::int16_t>();
+  CheckMatchesStdRanges<std::uint16_t>();
+  CheckMatchesStdRanges<std::int32_t>();
+  CheckMatchesStdRanges<std::uint32_t>();
+  CheckMatchesStdRanges<std::int64_t>();
+  CheckMatchesStdRanges<std::uint64_t>();
+  CheckMatchesStdRanges<float>();
+  CheckMatchesStdRanges<double>();
+}
+
+TEST_CASE("SIMD Count does not overflow lane counters test") {
+  const LevelGuard guard;
+  const lab::Vector<std::int8_t> vector(100'000);
+  for (const auto level : kLevels) {
+    if (lab::simd::SetLevel(level)) {
+      REQUIRE(lab::Count(vector, std::int8_t{0}) == vector.Size());
+    }
+  }
+}
+
+TEST_CASE("SIMD floating point semantics test") {
+  const LevelGuard guard;
+  std::vector<double> values(40, 1.0);
+  values[20] = std::numeric_limits<double>::quiet_NaN();
+  values[30] = -0.0;
+  for (const auto level : kLevels) {
+    if (!lab::simd::SetLevel(level)) {
+      continue;
+    }
+    REQUIRE(!lab::Contains(values, std::numeric_limits<double>::quiet_NaN()));
+    REQUIRE(lab::Find(values, 0.0) - values.begin() == 30);
+    REQUIRE(!lab::Equal(values, values));
+  }
+}
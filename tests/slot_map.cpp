@@ -0,0 +1,112 @@
+import lab_slot_map;
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST_CASE("SlotMap insert, erase and lookup test") {
+  lab::SlotMap<std::string> names;
+  const auto alice{names.Insert("alice")};
+  const auto bob{names.Emplace(3, 'b')};
+  auto carol_name{std::string{"carol"}};
+  const auto carol{names.Insert(std::move(carol_name))};
+  REQUIRE(names.Size() == 3);
+  REQUIRE(names[bob] == "bbb");
+  REQUIRE(*names.Find(carol) == "carol");
+
+  // Erasing moves the last value into the gap, the other handles keep working.
+  REQUIRE(names.Erase(alice));
+  REQUIRE_FALSE(names.Erase(alice));
+  REQUIRE_FALSE(names.Contains(alice));
+  REQUIRE(names.Find(alice) == nullptr);
+  REQUIRE_THROWS_AS(names.At(alice), std::out_of_range);
+  REQUIRE(names.At(carol) == "carol");
+  REQUIRE(names.Values().front() == "carol");
+  REQUIRE(names.HandleAt(0) == carol);
+  REQUIRE(names.HandleAt(1) == bob);
+
+  // The slot is reused with a new generation, stale handles stay stale.
+  const auto dave{names.Insert("dave")};
+  REQUIRE(dave.index == alice.index);
+  REQUIRE(dave != alice);
+  REQUIRE_FALSE(names.Contains(alice));
+  REQUIRE(names[dave] == "dave");
+  REQUIRE_FALSE(names.Contains(decltype(names)::Handle{}));
+  // A free slot has an even generation, a handle forged with it refers to nothing.
+  REQUIRE(names.Erase(dave));
+  const decltype(names)::Handle forged{dave.index, dave.generation + 1};
+  REQUIRE_FALSE(names.Contains(forged));
+  REQUIRE(names.Find(forged) == nullptr);
+  REQUIRE_THROWS_AS(names.At(forged), std::out_of_range);
+  const auto erin{names.Insert("erin")};
+  REQUIRE(erin.generation == dave.generation + 2);
+
+  const auto copy{names};
+  names.Clear();
+  REQUIRE(names.Empty());
+  REQUIRE_FALSE(names.Contains(bob));
+  REQUIRE(copy.Size() == 3);
+  REQUIRE(copy[bob] == "bbb");
+  REQUIRE(std::ranges::equal(copy, std::vector<std::string>{"carol", "bbb", "erin"}));
+}
+
+TEST_CASE("SlotMap insert of a stored value on growth test") {
+  lab::SlotMap<std::string> names;
+  const auto first{names.Insert(std::string(32, 'a'))};
+  while (names.Size() < names.Capacity()) {
+    names.Insert(std::string(32, 'b'));
+  }
+  const auto copy{names.Insert(names[first])};
+  REQUIRE(names[copy] == std::string(32, 'a'));
+  REQUIRE(names[first] == std::string(32, 'a'));
+}
+
+TEST_CASE("SlotMap dense iteration test") {
+  lab::SlotMap<int> numbers;
+  numbers.Reserve(1'000);
+  std::vector<lab::SlotMap<int>::Handle> handles;
+  for (int i{}; i < 1'000; ++i) {
+    handles.push_back(numbers.Insert(i));
+  }
+  for (std::size_t i{}; i < handles.size(); i += 2) {
+    REQUIRE(numbers.Erase(handles[i]));
+  }
+  REQUIRE(numbers.Size() == 500);
+  REQUIRE(std::accumulate(numbers.begin(), numbers.end(), 0) == 250'000);
+  for (std::size_t i{1}; i < handles.size(); i += 2) {
+    REQUIRE(numbers[handles[i]] == static_cast<int>(i));
+  }
+  for (std::size_t position{}; position < numbers.Size(); ++position) {
+    REQUIRE(&numbers[numbers.HandleAt(position)] == &numbers.Values()[position]);
+  }
+  for (int& value : numbers) {
+    value = -value;
+  }
+  REQUIRE(numbers[handles[999]] == -999);
+
+  lab::SlotMap<int> moved{std::move(numbers)};
+  REQUIRE(numbers.Empty());
+  REQUIRE(moved.Size() == 500);
+  numbers.Insert(1);
+  numbers = std::move(moved);
+  REQUIRE(numbers.Contains(handles[1]));
+  moved.Insert(2);
+  numbers.Swap(moved);
+  REQUIRE(numbers.Size() == 1);
+
+  // Handles and bookkeeping follow the memory resource too.
+  std::pmr::monotonic_buffer_resource resource;
+  lab::pmr::SlotMap<std::unique_ptr<int>> pointers{&resource};
+  const auto first{pointers.Emplace(std::make_unique<int>(1))};
+  const auto second{pointers.Emplace(std::make_unique<int>(2))};
+  REQUIRE(pointers.Erase(first));
+  REQUIRE(*pointers[second] == 2);
+  REQUIRE(pointers.GetAllocator().resource() == &resource);
+}
@@ -0,0 +1,162 @@
+import lab_small_vector;
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+/**
+ * @brief Stateful allocator that propagates on copy assignment, tagged to observe propagation.
+ */
+template<typename T>
+struct TaggedAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using is_always_equal = std::false_type;
+
+  explicit TaggedAllocator(int tag = 0) noexcept
+    : tag{tag} { }
+
+  template<typename U>
+  TaggedAllocator(const TaggedAllocator<U>& other) noexcept
+    : tag{other.tag} { }
+
+  auto allocate(std::size_t n) -> T* { return std::allocator<T>{}.allocate(n); }
+
+  auto deallocate(T* pointer, std::size_t n) noexcept -> void { std::allocator<T>{}.deallocate(pointer, n); }
+
+  template<typename U>
+  friend auto operator==(const TaggedAllocator& lhs, const TaggedAllocator<U>& rhs) noexcept -> bool {
+    return lhs.tag == rhs.tag;
+  }
+
+  int tag;
+};
+
+}  // namespace
+
+constexpr auto kTestNumbers = {1, 2, 3, 4};
+
+TEST_CASE("Default constructor test") {
+  lab::SmallVector<int, 4> vector;
+  REQUIRE(vector.Empty());
+  REQUIRE(vector.IsInline());
+  REQUIRE(vector.Capacity() == 4);
+}
+
+TEST_CASE("Initializer list constructor test") {
+  lab::SmallVector<int, 4> inline_vector{kTestNumbers};
+  REQUIRE(inline_vector.IsInline());
+  REQUIRE(std::ranges::equal(inline_vector, kTestNumbers));
+  lab::SmallVector<int, 2> spilled_vector{kTestNumbers};
+  REQUIRE(!spilled_vector.IsInline());
+  REQUIRE(std::ranges::equal(spilled_vector, kTestNumbers));
+}
+
+TEST_CASE("PushBack spills to the heap on overflow test") {
+  lab::SmallVector<std::string, 4> vector;
+  for (int i{}; i < 4; ++i) {
+    vector.PushBack(std::to_string(i));
+  }
+  REQUIRE(vector.IsInline());
+  vector.EmplaceBack("4");
+  REQUIRE(!vector.IsInline());
+  REQUIRE(vector.Size() == 5);
+  for (int i{}; i < 5; ++i) {
+    REQUIRE(vector[i] == std::to_string(i));
+  }
+}
+
+TEST_CASE("EmplaceBack growth with an element of the vector itself test") {
+  lab::SmallVector<std::string, 2> vector{std::string(32, 'a'), std::string(32, 'b')};
+  vector.EmplaceBack(vector[0]);
+  REQUIRE(!vector.IsInline());
+  REQUIRE(vector.Back() == std::string(32, 'a'));
+
+  while (vector.Size() < vector.Capacity()) {
+    vector.EmplaceBack(32, 'c');
+  }
+  vector.EmplaceBack(vector[1]);
+  REQUIRE(vector.Back() == std::string(32, 'b'));
+  vector.PushBack(std::move(vector[0]));
+  REQUIRE(vector.Back() == std::string(32, 'a'));
+}
+
+TEST_CASE("Copy constructor test") {
+  lab::SmallVector<std::string, 2> vector{"a", "b", "c"};
+  lab::SmallVector<std::string, 2> copied_vector{vector};
+  REQUIRE(std::ranges::equal(vector, copied_vector));
+}
+
+TEST_CASE("Move constructor steals heap buffer test") {
+  lab::SmallVector<std::string, 2> vector{"a", "b", "c"};
+  const auto* data{vector.Data()};
+  lab::SmallVector<std::string, 2> moved_vector{std::move(vector)};
+  REQUIRE(moved_vector.Data() == data);
+  REQUIRE(vector.Empty());
+  REQUIRE(vector.IsInline());
+  REQUIRE(moved_vector.Back() == "c");
+}
+
+TEST_CASE("Move constructor relocates inline elements test") {
+  lab::SmallVector<std::string, 4> vector{"a", "b"};
+  lab::SmallVector<std::string, 4> moved_vector{std::move(vector)};
+  REQUIRE(moved_vector.IsInline());
+  REQUIRE(vector.Empty());
+  REQUIRE(std::ranges::equal(moved_vector, std::initializer_list<std::string>{"a", "b"}));
+}
+
+TEST_CASE("Assignment operators test") {
+  lab::SmallVector<int, 2> vector{kTestNumbers};
+  lab::SmallVector<int, 2> another_vector;
+  another_vector = vector;
+  REQUIRE(std::ranges::equal(another_vector, kTestNumbers));
+  lab::SmallVector<int, 2> moved_vector{1};
+  moved_vector = std::move(vector);
+  REQUIRE(vector.Empty());
+  REQUIRE(std::ranges::equal(moved_vector, kTestNumbers));
+}
+
+TEST_CASE("Copy assignment propagates the allocator test") {
+  using Vector = lab::SmallVector<std::string, 2, TaggedAllocator<std::string>>;
+  const Vector source{{"a", "b", "c"}, TaggedAllocator<std::string>{1}};
+  Vector spilled_target{{"d", "e", "f", "g"}, TaggedAllocator<std::string>{2}};
+  spilled_target = source;
+  REQUIRE(spilled_target.GetAllocator() == source.GetAllocator());
+  REQUIRE(std::ranges::equal(spilled_target, source));
+  spilled_target.PushBack("h");
+  REQUIRE(spilled_target.Size() == 4);
+
+  Vector inline_target{TaggedAllocator<std::string>{3}};
+  inline_target = source;
+  REQUIRE(inline_target.GetAllocator() == source.GetAllocator());
+  REQUIRE(std::ranges::equal(inline_target, source));
+}
+
+TEST_CASE("ShrinkToFit returns to inline storage test") {
+  lab::SmallVector<int, 4> vector;
+  for (int i{}; i < 10; ++i) {
+    vector.PushBack(i);
+  }
+  while (vector.Size() > 3) {
+    vector.PopBack();
+  }
+  vector.ShrinkToFit();
+  REQUIRE(vector.IsInline());
+  REQUIRE(std::ranges::equal(vector, std::views::iota(0, 3)));
+}
+
+TEST_CASE("Swap method test") {
+  lab::SmallVector<int, 2> inline_vector{1};
+  lab::SmallVector<int, 2> spilled_vector{kTestNumbers};
+  inline_vector.Swap(spilled_vector);
+  REQUIRE(std::ranges::equal(inline_vector, kTestNumbers));
+  REQUIRE(std::ranges::equal(spilled_vector, std::initializer_list{1}));
+}
@@ -0,0 +1,177 @@
+import lab_soa_vector;
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace {
+
+struct ThrowingCopy {
+  ThrowingCopy() = default;
+
+  explicit ThrowingCopy(int value)
+    : value{value} { }
+
+  ThrowingCopy(const ThrowingCopy& other)
+    : value{other.value} {
+    if (value < 0) {
+      throw std::runtime_error{"copy"};
+    }
+  }
+
+  // NOLINTNEXTLINE(performance-noexcept-move-constructor) forces the copying relocation path
+  ThrowingCopy(ThrowingCopy&& other) noexcept(false)
+    : value{other.value} { }
+
+  auto operator=(const ThrowingCopy&) -> ThrowingCopy& = default;
+  ~ThrowingCopy() = default;
+
+  int value{};
+};
+
+using Particles = lab::SoAVector<float, float, std::uint8_t>;
+
+}  // namespace
+
+static_assert(std::random_access_iterator<Particles::Iterator>);
+#ifdef __cpp_lib_ranges_zip
+// Proxy references of const rows need the C++23 `std::tuple` common_reference specializations.
+static_assert(std::random_access_iterator<Particles::ConstIterator>);
+#endif
+static_assert(Particles::kRowSize == 2 * sizeof(float) + 1);
+
+TEST_CASE("SoAVector rows and columns test") {
+  Particles particles;
+  REQUIRE(particles.Empty());
+  for (int i{}; i < 100; ++i) {
+    particles.EmplaceBack(static_cast<float>(i), static_cast<float>(2 * i), static_cast<std::uint8_t>(i % 3));
+  }
+  REQUIRE(particles.Size() == 100);
+  REQUIRE(particles.Capacity() >= 100);
+
+  const auto x{particles.Column<0>()};
+  const auto y{particles.Column<1>()};
+  const auto tag{std::as_const(particles).Column<2>()};
+  REQUIRE(x.size() == 100);
+  REQUIRE(reinterpret_cast<std::uintptr_t>(x.data()) % 64 == 0);
+  REQUIRE(reinterpret_cast<std::uintptr_t>(y.data()) % 64 == 0);
+  REQUIRE(reinterpret_cast<std::uintptr_t>(tag.data()) % 64 == 0);
+  REQUIRE(std::accumulate(x.begin(), x.end(), 0.0F) == 4950.0F);
+  REQUIRE(std::accumulate(y.begin(), y.end(), 0.0F) == 9900.0F);
+  REQUIRE(tag[5] == 2);
+
+  auto [px, py, ptag]{particles[10]};
+  px = -1.0F;
+  ptag = 7;
+  REQUIRE(x[10] == -1.0F);
+  REQUIRE(py == 20.0F);
+  REQUIRE(std::get<2>(std::as_const(particles)[10]) == 7);
+
+  int rows{};
+  for (auto [row_x, row_y, row_tag] : particles) {
+    row_y += 1.0F;
+    ++rows;
+  }
+  REQUIRE(rows == 100);
+  REQUIRE(particles.Column<1>()[0] == 1.0F);
+  REQUIRE(particles.end() - particles.begin() == 100);
+  REQUIRE(std::get<0>(*(particles.cbegin() + 3)) == 3.0F);
+  REQUIRE(std::get<0>(*particles.rbegin()) == 99.0F);
+
+  particles.PopBack();
+  REQUIRE(particles.Size() == 99);
+  REQUIRE(std::get<0>(particles.Back()) == 98.0F);
+  particles.Resize(120);
+  REQUIRE(particles.Size() == 120);
+  REQUIRE(std::get<0>(particles.Back()) == 0.0F);
+  particles.Resize(5);
+  REQUIRE(particles.Column<2>().size() == 5);
+  particles.Clear();
+  REQUIRE(particles.Empty());
+}
+
+TEST_CASE("SoAVector non-trivial columns test") {
+  lab::SoAVector<std::string, int> vector;
+  for (int i{}; i < 50; ++i) {
+    vector.PushBack({std::string(32, static_cast<char>('a' + i % 26)), i});
+  }
+  vector.EmplaceBack(std::get<0>(vector[0]), std::get<1>(vector[0]));
+  REQUIRE(std::get<0>(vector.Back()) == std::string(32, 'a'));
+
+  auto copy{vector};
+  REQUIRE(copy.Size() == vector.Size());
+  for (std::size_t i{}; i < vector.Size(); ++i) {
+    REQUIRE(copy[i] == vector[i]);
+  }
+
+  auto moved{std::move(copy)};
+  REQUIRE(copy.Empty());
+  REQUIRE(moved.Size() == 51);
+  REQUIRE(std::get<1>(moved[49]) == 49);
+
+  lab::SoAVector<std::string, int> assigned;
+  assigned = moved;
+  assigned.Swap(moved);
+  REQUIRE(assigned.Size() == 51);
+  assigned.ShrinkToFit();
+  REQUIRE(assigned.Capacity() == 51);
+  REQUIRE(std::get<0>(assigned[25]) == std::string(32, 'z'));
+}
+
+TEST_CASE("SoAVector move assignment with unequal allocators test") {
+  using PmrRows = lab::BasicSoAVector<
+    std::pmr::polymorphic_allocator<std::byte>,
+    lab::SoAVector<int>::GrowthPolicyType,
+    std::string,
+    int>;
+  std::pmr::monotonic_buffer_resource source_resource;
+  std::pmr::monotonic_buffer_resource target_resource;
+  PmrRows source{&source_resource};
+  for (int i{}; i < 20; ++i) {
+    source.EmplaceBack(std::string(32, static_cast<char>('a' + i)), i);
+  }
+  PmrRows target{&target_resource};
+  target.EmplaceBack("x", -1);
+  const auto* const source_first{&std::get<1>(source.Front())};
+
+  target = std::move(source);
+  REQUIRE(target.Size() == 20);
+  REQUIRE(&std::get<1>(target.Front()) != source_first);
+  REQUIRE(target.GetAllocator().resource() == &target_resource);
+  for (int i{}; i < 20; ++i) {
+    REQUIRE(std::get<0>(target[i]) == std::string(32, static_cast<char>('a' + i)));
+    REQUIRE(std::get<1>(target[i]) == i);
+  }
+
+  // Equal allocators still steal the block.
+  PmrRows other{&target_resource};
+  const auto* const target_first{&std::get<1>(target.Front())};
+  other = std::move(target);
+  REQUIRE(&std::get<1>(other.Front()) == target_first);
+  REQUIRE(target.Empty());
+}
+
+TEST_CASE("SoAVector reallocation strong guarantee test") {
+  lab::SoAVector<std::string, ThrowingCopy> vector;
+  vector.Reserve(2);
+  vector.EmplaceBack("first", ThrowingCopy{1});
+  vector.EmplaceBack("second", ThrowingCopy{-1});
+  REQUIRE(vector.Capacity() == 2);
+  REQUIRE_THROWS_AS(vector.EmplaceBack("third", ThrowingCopy{3}), std::runtime_error);
+  REQUIRE(vector.Size() == 2);
+  REQUIRE(vector.Capacity() == 2);
+  REQUIRE(std::get<0>(vector[0]) == "first");
+  REQUIRE(std::get<0>(vector[1]) == "second");
+  REQUIRE(std::get<1>(vector[1]).value == -1);
+
+  REQUIRE_THROWS_AS(vector.EmplaceBack("fourth", std::get<1>(vector[1])), std::runtime_error);
+  REQUIRE(vector.Size() == 2);
+}
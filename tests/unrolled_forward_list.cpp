@@ -0,0 +1,155 @@
+import lab_unrolled_forward_list;
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <forward_list>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <string>
+
+constexpr auto kTestNumbers = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+template<typename T>
+using SmallNodeList = lab::containers::UnrolledForwardList<T, 4>;
+
+TEST_CASE("Default constructor test") {
+  SmallNodeList<int> list;
+  REQUIRE(list.Empty());
+  REQUIRE(list.NodeCount() == 0);
+  static_assert(lab::containers::UnrolledForwardList<int>::kNodeCapacity == 12);
+}
+
+TEST_CASE("Range constructor fills nodes test") {
+  SmallNodeList<int> list{kTestNumbers};
+  REQUIRE(std::ranges::equal(kTestNumbers, list));
+  REQUIRE(list.NodeCount() == 3);
+  REQUIRE(list.Front() == 1);
+  static_assert(std::forward_iterator<SmallNodeList<int>::Iterator>);
+  static_assert(std::forward_iterator<SmallNodeList<int>::ConstIterator>);
+}
+
+TEST_CASE("Count constructor test") {
+  SmallNodeList<std::string> list(9);
+  REQUIRE(std::ranges::distance(list) == 9);
+  REQUIRE(std::ranges::all_of(list, [](const std::string& value) { return value.empty(); }));
+  REQUIRE(list.NodeCount() == 3);
+}
+
+TEST_CASE("Copy and move test") {
+  SmallNodeList<std::string> list{"a", "b", "c", "d", "e"};
+  SmallNodeList<std::string> copied_list{list};
+  REQUIRE(std::ranges::equal(list, copied_list));
+  SmallNodeList<std::string> moved_list{std::move(list)};
+  REQUIRE(list.Empty());
+  REQUIRE(std::ranges::equal(copied_list, moved_list));
+  list = moved_list;
+  REQUIRE(std::ranges::equal(list, moved_list));
+  moved_list = std::move(list);
+  REQUIRE(list.Empty());
+  REQUIRE(std::ranges::equal(copied_list, moved_list));
+  list.Swap(moved_list);
+  REQUIRE(moved_list.Empty());
+  REQUIRE(std::ranges::equal(copied_list, list));
+}
+
+TEST_CASE("Move assignment with unequal allocators test") {
+  using PmrList = lab::containers::UnrolledForwardList<std::string, 4, std::pmr::polymorphic_allocator<std::string>>;
+  std::pmr::monotonic_buffer_resource source_resource;
+  std::pmr::monotonic_buffer_resource target_resource;
+  PmrList source{{"a", "b", "c", "d", "e", "f"}, &source_resource};
+  PmrList target{{"x"}, &target_resource};
+  const auto* const source_first{&source.Front()};
+
+  target = std::move(source);
+  REQUIRE(std::ranges::equal(target, std::initializer_list<std::string>{"a", "b", "c", "d", "e", "f"}));
+  REQUIRE(&target.Front() != source_first);
+  REQUIRE(target.GetAllocator().resource() == &target_resource);
+
+  // Equal allocators still steal the nodes.
+  PmrList other{{"y"}, &target_resource};
+  const auto* const target_first{&target.Front()};
+  other = std::move(target);
+  REQUIRE(&other.Front() == target_first);
+  REQUIRE(target.Empty());
+}
+
+TEST_CASE("PushFront test") {
+  SmallNodeList<int> list;
+  std::forward_list<int> expected;
+  for (int i{}; i < 10; ++i) {
+    list.PushFront(i);
+    expected.push_front(i);
+  }
+  REQUIRE(std::ranges::equal(expected, list));
+  REQUIRE(list.NodeCount() == 3);
+  list.PopFront();
+  expected.pop_front();
+  REQUIRE(std::ranges::equal(expected, list));
+}
+
+TEST_CASE("InsertAfter splits full nodes test") {
+  SmallNodeList<int> list{1, 2, 3, 4};
+  REQUIRE(list.NodeCount() == 1);
+  auto it{list.InsertAfter(std::next(list.cbegin()), 10)};
+  REQUIRE(*it == 10);
+  REQUIRE(std::ranges::equal(std::initializer_list<int>{1, 2, 10, 3, 4}, list));
+  REQUIRE(list.NodeCount() == 2);
+  it = list.InsertAfter(std::next(list.cbegin(), 4), 20);
+  REQUIRE(*it == 20);
+  REQUIRE(std::ranges::equal(std::initializer_list<int>{1, 2, 10, 3, 4, 20}, list));
+  list.InsertAfter(list.cend(), 0);
+  REQUIRE(list.Front() == 0);
+}
+
+TEST_CASE("Unit node capacity test") {
+  lab::containers::UnrolledForwardList<int, 1> list{1, 3};
+  list.InsertAfter(list.cbegin(), 2);
+  REQUIRE(std::ranges::equal(std::initializer_list<int>{1, 2, 3}, list));
+  REQUIRE(list.NodeCount() == 3);
+  list.Erase(std::next(list.cbegin()));
+  list.Erase(std::next(list.cbegin()));
+  REQUIRE(std::ranges::equal(std::initializer_list<int>{1}, list));
+  REQUIRE(list.NodeCount() == 1);
+}
+
+TEST_CASE("Erase merges nodes test") {
+  SmallNodeList<int> list{kTestNumbers};
+  auto it{list.Erase(std::next(list.cbegin(), 4))};
+  REQUIRE(*it == 6);
+  it = list.Erase(it);
+  REQUIRE(*it == 7);
+  REQUIRE(std::ranges::equal(std::initializer_list<int>{1, 2, 3, 4, 7, 8, 9, 10}, list));
+  REQUIRE(list.NodeCount() == 2);
+  it = list.Erase(std::next(list.cbegin(), 3));
+  REQUIRE(*it == 7);
+  REQUIRE(list.NodeCount() == 2);
+  while (!list.Empty()) {
+    list.Erase(std::next(list.cbegin(), std::ranges::distance(list) - 1));
+  }
+  REQUIRE(list.NodeCount() == 0);
+}
+
+TEST_CASE("Mixed operations match std::forward_list test") {
+  SmallNodeList<std::string> list;
+  std::forward_list<std::string> expected;
+  for (int i{}; i < 200; ++i) {
+    const auto value{std::to_string(i)};
+    const auto offset{static_cast<std::ptrdiff_t>(i * 7 % (std::ranges::distance(expected) + 1))};
+    if (offset == 0) {
+      list.PushFront(value);
+      expected.push_front(value);
+    } else {
+      list.InsertAfter(std::next(list.cbegin(), offset - 1), value);
+      expected.insert_after(std::next(expected.cbegin(), offset - 1), value);
+    }
+    if (i % 3 == 0) {
+      const auto position{static_cast<std::ptrdiff_t>(i % std::ranges::distance(expected))};
+      list.Erase(std::next(list.cbegin(), position));
+      expected.erase_after(std::next(expected.cbefore_begin(), position));
+    }
+    REQUIRE(std::ranges::equal(expected, list));
+  }
+}
@@ -0,0 +1,379 @@
+import lab_vector;
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <list>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace {
+
+struct Point {
+  int x;
+  int y;
+};
+
+struct Handle {
+  explicit Handle(int value) : value_{std::make_unique<int>(value)} { }
+
+  std::unique_ptr<int> value_;
+};
+
+/**
+ * @brief Bump arena that can extend its most recent block in place.
+ */
+struct Arena {
+  alignas(std::max_align_t) std::byte buffer[1 << 16];
+  std::size_t used{};
+  std::byte* last_block{};
+  std::size_t expansions{};
+};
+
+Arena arena;
+
+template<typename T>
+struct ExpandingAllocator {
+  using value_type = T;
+
+  ExpandingAllocator() noexcept = default;
+
+  template<typename U>
+  ExpandingAllocator(const ExpandingAllocator<U>& /* other */) noexcept { }
+
+  auto allocate(std::size_t n) -> T* {
+    if (arena.used + n * sizeof(T) > sizeof(arena.buffer)) {
+      throw std::bad_alloc{};
+    }
+    arena.last_block = arena.buffer + arena.used;
+    arena.used += n * sizeof(T);
+    return reinterpret_cast<T*>(arena.last_block);
+  }
+
+  auto deallocate(T* /* pointer */, std::size_t /* n */) noexcept -> void { }
+
+  auto TryExpandInPlace(T* pointer, std::size_t count, std::size_t new_count) noexcept -> bool {
+    const std::size_t extra{(new_count - count) * sizeof(T)};
+    if (reinterpret_cast<std::byte*>(pointer) != arena.last_block || arena.used + extra > sizeof(arena.buffer)) {
+      return false;
+    }
+    arena.used += extra;
+    ++arena.expansions;
+    return true;
+  }
+
+  friend auto operator==(ExpandingAllocator, ExpandingAllocator) noexcept -> bool { return true; }
+};
+
+/**
+ * @brief Allocator that fills fresh storage with a pattern, so untouched bytes stay observable.
+ */
+template<typename T>
+struct PoisonAllocator {
+  using value_type = T;
+
+  static constexpr unsigned char kPattern{0xAB};
+
+  PoisonAllocator() noexcept = default;
+
+  template<typename U>
+  PoisonAllocator(const PoisonAllocator<U>& /* other */) noexcept { }
+
+  auto allocate(std::size_t n) -> T* {
+    T* pointer{std::allocator<T>{}.allocate(n)};
+    std::memset(static_cast<void*>(pointer), kPattern, n * sizeof(T));
+    return pointer;
+  }
+
+  auto deallocate(T* pointer, std::size_t n) noexcept -> void { std::allocator<T>{}.deallocate(pointer, n); }
+
+  friend auto operator==(const PoisonAllocator&, const PoisonAllocator&) noexcept -> bool = default;
+};
+
+}  // namespace
+
+static_assert(lab::CanExpandInPlace<ExpandingAllocator<int>>);
+static_assert(!lab::CanExpandInPlace<std::allocator<int>>);
+
+template<>
+struct lab::IsTriviallyRelocatable<Handle> : std::true_type { };
+
+static_assert(lab::kIsTriviallyRelocatable<int>);
+static_assert(lab::kIsTriviallyRelocatable<Point>);
+static_assert(!lab::kIsTriviallyRelocatable<std::string>);
+static_assert(lab::kIsTriviallyRelocatable<Handle>);
+
+TEST_CASE("PushBack growth with trivially relocatable type test") {
+  lab::Vector<int> vector;
+  for (int i{}; i < 1'000; ++i) {
+    vector.PushBack(i);
+  }
+  REQUIRE(vector.Size() == 1'000);
+  REQUIRE(std::ranges::equal(vector, std::views::iota(0, 1'000)));
+}
+
+TEST_CASE("PushBack growth with non trivially relocatable type test") {
+  lab::Vector<std::string> vector;
+  for (int i{}; i < 100; ++i) {
+    vector.PushBack(std::string(32, static_cast<char>('a' + i % 26)));
+  }
+  REQUIRE(vector.Size() == 100);
+  for (int i{}; i < 100; ++i) {
+    REQUIRE(vector[i] == std::string(32, static_cast<char>('a' + i % 26)));
+  }
+}
+
+TEST_CASE("EmplaceBack growth with an element of the vector itself test") {
+  lab::Vector<std::string> vector;
+  vector.EmplaceBack(32, 'a');
+  while (vector.Size() < vector.Capacity()) {
+    vector.EmplaceBack(32, 'b');
+  }
+  const auto size{vector.Size()};
+  vector.EmplaceBack(vector[0]);
+  REQUIRE(vector.Size() == size + 1);
+  REQUIRE(vector.Back() == std::string(32, 'a'));
+
+  while (vector.Size() < vector.Capacity()) {
+    vector.EmplaceBack(32, 'c');
+  }
+  vector.PushBack(std::move(vector[0]));
+  REQUIRE(vector.Back() == std::string(32, 'a'));
+}
+
+TEST_CASE("EmplaceBack growth with opt-in relocatable type test") {
+  lab::Vector<Handle> vector;
+  for (int i{}; i < 100; ++i) {
+    vector.EmplaceBack(i);
+  }
+  REQUIRE(vector.Size() == 100);
+  for (int i{}; i < 100; ++i) {
+    REQUIRE(*vector[i].value_ == i);
+  }
+}
+
+TEST_CASE("ShrinkToFit method test") {
+  lab::Vector<std::string> vector;
+  for (int i{}; i < 10; ++i) {
+    vector.EmplaceBack(std::to_string(i));
+  }
+  REQUIRE(vector.Capacity() > vector.Size());
+  vector.ShrinkToFit();
+  REQUIRE(vector.Capacity() == vector.Size());
+  REQUIRE(vector.Back() == "9");
+}
+
+TEST_CASE("PushBack growth with in place expansion test") {
+  lab::Vector<int, ExpandingAllocator<int>> vector;
+  vector.PushBack(0);
+  const int* data{vector.Data()};
+  for (int i{1}; i < 1'000; ++i) {
+    vector.PushBack(i);
+  }
+  REQUIRE(vector.Data() == data);
+  REQUIRE(arena.expansions > 0);
+  REQUIRE(std::ranges::equal(vector, std::views::iota(0, 1'000)));
+}
+
+#ifdef __cpp_lib_allocate_at_least
+TEST_CASE("Capacity records allocate_at_least slack test") {
+  struct SlackAllocator : std::allocator<int> {
+    using value_type = int;
+
+    auto allocate_at_least(std::size_t n) -> std::allocation_result<int*> {
+      return {std::allocator<int>::allocate(n + 8), n + 8};
+    }
+  };
+
+  lab::Vector<int, SlackAllocator> vector;
+  vector.PushBack(1);
+  REQUIRE(vector.Capacity() >= vector.Size() + 8);
+}
+#endif
+
+TEST_CASE("DoubleGrowth policy test") {
+  lab::Vector<int, std::allocator<int>, lab::DoubleGrowth> vector;
+  vector.PushBack(0);
+  REQUIRE(vector.Capacity() == 4);
+  for (int i{1}; i < 5; ++i) {
+    vector.PushBack(i);
+  }
+  REQUIRE(vector.Capacity() == 8);
+  REQUIRE(std::ranges::equal(vector, std::views::iota(0, 5)));
+}
+
+TEST_CASE("GoldenRatioGrowth policy test") {
+  constexpr lab::GoldenRatioGrowth kPolicy;
+  REQUIRE(kPolicy.Grow(0, 1, sizeof(int)) == 2);
+  REQUIRE(kPolicy.Grow(1'000, 1'001, sizeof(int)) == 1'620);
+}
+
+TEST_CASE("PageGrowth policy test") {
+  lab::Vector<int, std::allocator<int>, lab::PageGrowth> vector;
+  for (int i{}; i < 2'000; ++i) {
+    vector.PushBack(i);
+    REQUIRE(vector.Capacity() * sizeof(int) % 4'096 == 0);
+  }
+  vector.ShrinkToFit();
+  REQUIRE(vector.Capacity() == 2'048);
+  REQUIRE(std::ranges::equal(vector, std::views::iota(0, 2'000)));
+}
+
+TEST_CASE("HintedGrowth policy test") {
+  lab::Vector<int, std::allocator<int>, lab::HintedGrowth<>> vector;
+  vector.GetGrowthPolicy().SetHint(500);
+  vector.PushBack(0);
+  REQUIRE(vector.Capacity() == 500);
+  for (int i{1}; i < 501; ++i) {
+    vector.PushBack(i);
+  }
+  REQUIRE(vector.Capacity() > 500);
+  REQUIRE(std::ranges::equal(vector, std::views::iota(0, 501)));
+}
+
+TEST_CASE("Reserve method test") {
+  lab::Vector<int> vector;
+  vector.Reserve(100);
+  REQUIRE(vector.Capacity() >= 100);
+  const int* data{vector.Data()};
+  for (int i{}; i < 100; ++i) {
+    vector.PushBack(i);
+  }
+  REQUIRE(vector.Data() == data);
+}
+
+TEST_CASE("Resize method test") {
+  lab::Vector<std::string> vector;
+  vector.Resize(3);
+  REQUIRE(vector.Size() == 3);
+  REQUIRE(vector.Back().empty());
+  vector.Resize(5, "x");
+  REQUIRE(vector.Size() == 5);
+  REQUIRE(vector[4] == "x");
+  vector.Resize(1);
+  REQUIRE(vector.Size() == 1);
+  vector.Clear();
+  REQUIRE(vector.Empty());
+}
+
+TEST_CASE("AppendRange method test") {
+  lab::Vector<int> vector{0, 1};
+  vector.AppendRange(std::views::iota(2, 1'000));
+  REQUIRE(std::ranges::equal(vector, std::views::iota(0, 1'000)));
+  const std::list<int> list{1'000, 1'001};
+  vector.AppendRange(list);
+  REQUIRE(vector.Back() == 1'001);
+  std::istringstream stream{"1002 1003"};
+  vector.AppendRange(std::views::istream<int>(stream));
+  REQUIRE(std::ranges::equal(vector, std::views::iota(0, 1'004)));
+}
+
+TEST_CASE("InsertRange method test") {
+  const std::initializer_list<int> kInserted{10, 20, 30};
+  lab::Vector<int> vector{1, 2, 3};
+  auto position{vector.InsertRange(vector.cbegin() + 1, kInserted)};
+  REQUIRE(*position == 10);
+  REQUIRE(std::ranges::equal(vector, std::initializer_list{1, 10, 20, 30, 2, 3}));
+  vector.Reserve(20);
+  vector.InsertRange(vector.cend(), kInserted);
+  vector.InsertRange(vector.cbegin(), kInserted);
+  REQUIRE(std::ranges::equal(vector, std::initializer_list{10, 20, 30, 1, 10, 20, 30, 2, 3, 10, 20, 30}));
+
+  lab::Vector<std::string> strings{"a", "d"};
+  const std::initializer_list<std::string> kStrings{"b", "c"};
+  strings.InsertRange(strings.cbegin() + 1, kStrings);
+  strings.Reserve(10);
+  strings.InsertRange(strings.cbegin(), kStrings);
+  REQUIRE(std::ranges::equal(strings, std::initializer_list<std::string>{"b", "c", "a", "b", "c", "d"}));
+
+  std::istringstream stream{"7 8"};
+  vector.InsertRange(vector.cbegin(), std::views::istream<int>(stream));
+  REQUIRE(vector[0] == 7);
+  REQUIRE(vector[1] == 8);
+  REQUIRE(vector[2] == 10);
+}
+
+TEST_CASE("Default-initializing construction test") {
+  using Buffer = lab::Vector<std::byte, PoisonAllocator<std::byte>>;
+  const auto kPattern{std::byte{PoisonAllocator<std::byte>::kPattern}};
+  const Buffer zeroed(64);
+  REQUIRE(std::ranges::all_of(zeroed, [](std::byte value) { return value == std::byte{}; }));
+  const Buffer staging(64, lab::default_init);
+  REQUIRE(staging.Size() == 64);
+  REQUIRE(std::ranges::all_of(staging, [kPattern](std::byte value) { return value == kPattern; }));
+
+  const lab::Vector<std::string> strings(3, lab::default_init);
+  REQUIRE(strings.Size() == 3);
+  REQUIRE(strings[2].empty());
+  REQUIRE(lab::Vector<int>(0, lab::default_init).Empty());
+}
+
+TEST_CASE("ResizeForOverwrite method test") {
+  lab::Vector<std::byte, PoisonAllocator<std::byte>> buffer;
+  buffer.ResizeForOverwrite(100);
+  REQUIRE(buffer.Size() == 100);
+  REQUIRE(buffer[99] == std::byte{PoisonAllocator<std::byte>::kPattern});
+  buffer.ResizeForOverwrite(10);
+  REQUIRE(buffer.Size() == 10);
+
+  lab::Vector<std::string> strings{"a"};
+  strings.ResizeForOverwrite(4);
+  REQUIRE(strings[0] == "a");
+  REQUIRE(strings[3].empty());
+}
+
+TEST_CASE("AppendUninitialized method test") {
+  lab::Vector<char> buffer{'a', 'b'};
+  const std::string_view kChunk{"0123456789"};
+  auto tail{buffer.AppendUninitialized(16)};
+  REQUIRE(tail.size() == 16);
+  REQUIRE(buffer.Size() == 2);
+  REQUIRE(buffer.Capacity() >= 18);
+  std::ranges::copy(kChunk, tail.begin());
+  buffer.CommitAppend(kChunk.size());
+  REQUIRE(buffer.Size() == 12);
+  REQUIRE(std::string_view{buffer.Data(), buffer.Size()} == "ab0123456789");
+
+  const char* data{buffer.Data()};
+  tail = buffer.AppendUninitialized(2);
+  REQUIRE(buffer.Data() == data);
+  buffer.CommitAppend(0);
+  REQUIRE(buffer.Size() == 12);
+}
+
+TEST_CASE("Constant evaluation test") {
+  constexpr auto kSum{[] {
+    lab::Vector<int> vector{1, 2, 3};
+    for (int i{4}; i <= 100; ++i) {
+      vector.PushBack(i);
+    }
+    vector.InsertRange(vector.cbegin(), std::views::iota(-2, 1));
+    vector.Erase(vector.cbegin(), vector.cbegin() + 3);
+    vector.Emplace(vector.cbegin() + 1, 1'000);
+    auto copy{vector};
+    copy.Resize(50);
+    copy.Reserve(200);
+    copy.ShrinkToFit();
+    int sum{copy.At(1)};
+    for (const int value : copy) {
+      sum += value;
+    }
+    return sum;
+  }()};
+  STATIC_REQUIRE(kSum == 1'000 + 50 * 49 / 2 + 1'000);
+
+  constexpr auto kLength{[] {
+    lab::Vector<std::string> strings(3, lab::default_init);
+    strings.PushBack("constant");
+    strings.AppendRange(std::initializer_list<std::string_view>{"evaluation", "test"});
+    return strings.Size() + strings[3].size() + strings.Back().size();
+  }()};
+  STATIC_REQUIRE(kLength == 6 + 8 + 4);
+}